@@ -0,0 +1,597 @@
+//                                               -*- C++ -*-
+/**
+ *  @brief Benchmark suite of the otmeshing algorithms
+ *
+ *  Copyright 2005-2026 Airbus-EDF-IMACS-ONERA-Phimeca
+ *
+ *  This library is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License
+ *  along with this library.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+#include <openturns/IntervalMesher.hxx>
+#include <openturns/Normal.hxx>
+#include <openturns/PlatformInfo.hxx>
+#include <openturns/RandomGenerator.hxx>
+
+#include "otmeshing/CloudMesher.hxx"
+#include "otmeshing/ConvexDecompositionMesher.hxx"
+#include "otmeshing/ConvexHullMesher.hxx"
+#include "otmeshing/Cylinder.hxx"
+#include "otmeshing/IntersectionMesher.hxx"
+#include "otmeshing/MeshDomain2.hxx"
+#include "otmeshing/PolygonMesher.hxx"
+#include "otmeshing/UnionMesher.hxx"
+
+using namespace OT;
+using namespace OTMESHING;
+
+/* Usage:
+ *   otmeshing_bench [--output FILE] [--filter SUBSTRING] [--repeat N] [--seed N] [--quick]
+ *
+ * Each case is timed on the same seeded input N times, the report is a JSON
+ * document (written to stdout by default) so that runs of different releases
+ * or builds (eg with/without Qhull) can be compared.
+ */
+
+namespace
+{
+
+struct BenchOptions
+{
+  String output_;
+  String filter_;
+  UnsignedInteger repeat_ = 3;
+  UnsignedInteger seed_ = 0;
+  Bool quick_ = false;
+};
+
+/* Size of the output of a case */
+struct BenchOutput
+{
+  UnsignedInteger vertices_ = 0;
+  UnsignedInteger simplices_ = 0;
+  UnsignedInteger parts_ = 0;
+};
+
+BenchOutput MeshOutput(const Mesh & mesh)
+{
+  BenchOutput output;
+  output.vertices_ = mesh.getVerticesNumber();
+  output.simplices_ = mesh.getSimplicesNumber();
+  output.parts_ = 1;
+  return output;
+}
+
+struct BenchResult
+{
+  String name_;
+  String variant_;
+  UnsignedInteger dimension_ = 0;
+  UnsignedInteger size_ = 0;
+  Collection<Scalar> timings_;
+  BenchOutput output_;
+  String error_;
+};
+
+String EscapeJSON(const String & text)
+{
+  std::ostringstream oss;
+  for (const char c : text)
+  {
+    switch (c)
+    {
+      case '"':
+        oss << "\\\"";
+        break;
+      case '\\':
+        oss << "\\\\";
+        break;
+      case '\n':
+        oss << "\\n";
+        break;
+      case '\t':
+        oss << "\\t";
+        break;
+      default:
+        if (static_cast<unsigned char>(c) < 0x20)
+          oss << "\\u" << std::hex << std::setw(4) << std::setfill('0') << static_cast<int>(c) << std::dec << std::setfill(' ');
+        else
+          oss << c;
+    }
+  }
+  return oss.str();
+}
+
+class BenchRunner
+{
+public:
+  explicit BenchRunner(const BenchOptions & options)
+    : options_(options)
+  {
+    // Nothing to do
+  }
+
+  Bool quick() const
+  {
+    return options_.quick_;
+  }
+
+  /* Inputs are generated once by the caller, only f is timed */
+  void run(const String & name,
+           const String & variant,
+           const UnsignedInteger dimension,
+           const UnsignedInteger size,
+           const std::function<BenchOutput()> & f)
+  {
+    const String label(name + "/" + variant);
+    if (!options_.filter_.empty() && (label.find(options_.filter_) == String::npos))
+      return;
+    BenchResult result;
+    result.name_ = name;
+    result.variant_ = variant;
+    result.dimension_ = dimension;
+    result.size_ = size;
+    for (UnsignedInteger k = 0; k < options_.repeat_; ++ k)
+    {
+      try
+      {
+        const auto t0 = std::chrono::steady_clock::now();
+        result.output_ = f();
+        const auto t1 = std::chrono::steady_clock::now();
+        result.timings_.add(std::chrono::duration<Scalar>(t1 - t0).count());
+      }
+      catch (const Exception & exc)
+      {
+        result.error_ = exc.what();
+        break;
+      }
+      catch (const std::exception & exc)
+      {
+        result.error_ = exc.what();
+        break;
+      }
+    }
+    std::cerr << label << " dimension=" << dimension << " size=" << size;
+    if (result.error_.empty())
+      std::cerr << " time=" << *std::min_element(result.timings_.begin(), result.timings_.end()) << "s";
+    else
+      std::cerr << " error=" << result.error_;
+    std::cerr << std::endl;
+    results_.push_back(result);
+  }
+
+  void writeJSON(std::ostream & os) const
+  {
+#ifdef OTMESHING_VERSION_STRING
+    const String version(OTMESHING_VERSION_STRING);
+#else
+    const String version("unknown");
+#endif
+#ifdef OPENTURNS_HAVE_QHULL
+    const String hullBackend("qhull");
+#else
+    const String hullBackend("cgal");
+#endif
+#ifdef OPENTURNS_HAVE_CDDLIB
+    const String cddlib("true");
+#else
+    const String cddlib("false");
+#endif
+    os << std::setprecision(9);
+    os << "{\n";
+    os << "  \"otmeshing_version\": \"" << EscapeJSON(version) << "\",\n";
+    os << "  \"openturns_version\": \"" << EscapeJSON(PlatformInfo::GetVersion()) << "\",\n";
+    os << "  \"hull_backend\": \"" << hullBackend << "\",\n";
+    os << "  \"cddlib\": " << cddlib << ",\n";
+    os << "  \"hardware_concurrency\": " << std::thread::hardware_concurrency() << ",\n";
+    os << "  \"seed\": " << options_.seed_ << ",\n";
+    os << "  \"repeat\": " << options_.repeat_ << ",\n";
+    os << "  \"quick\": " << (options_.quick_ ? "true" : "false") << ",\n";
+    os << "  \"results\": [";
+    for (UnsignedInteger i = 0; i < results_.size(); ++ i)
+    {
+      const BenchResult & result = results_[i];
+      os << (i ? ",\n" : "\n");
+      os << "    {\"name\": \"" << EscapeJSON(result.name_) << "\", \"variant\": \"" << EscapeJSON(result.variant_) << "\", "
+         << "\"dimension\": " << result.dimension_ << ", \"size\": " << result.size_ << ", ";
+      if (result.error_.empty())
+      {
+        Collection<Scalar> sorted(result.timings_);
+        std::sort(sorted.begin(), sorted.end());
+        Scalar total = 0.0;
+        for (const Scalar t : sorted)
+          total += t;
+        os << "\"min\": " << sorted[0] << ", \"median\": " << sorted[sorted.getSize() / 2]
+           << ", \"mean\": " << total / sorted.getSize() << ", \"max\": " << sorted[sorted.getSize() - 1] << ", "
+           << "\"output_vertices\": " << result.output_.vertices_ << ", \"output_simplices\": " << result.output_.simplices_
+           << ", \"output_parts\": " << result.output_.parts_ << "}";
+      }
+      else
+        os << "\"error\": \"" << EscapeJSON(result.error_) << "\"}";
+    }
+    os << "\n  ]\n}\n";
+  }
+
+private:
+  BenchOptions options_;
+  std::vector<BenchResult> results_;
+};
+
+/* Seeded synthetic generators */
+
+Sample UniformCloud(const UnsignedInteger size, const UnsignedInteger dimension, const UnsignedInteger seed)
+{
+  RandomGenerator::SetSeed(seed);
+  const Point values(RandomGenerator::Generate(size * dimension));
+  Sample cloud(size, dimension);
+  if (size * dimension)
+    std::copy(values.begin(), values.end(), &cloud(0, 0));
+  return cloud;
+}
+
+/* Points on the unit sphere, the worst case for hulls as all points are extreme */
+Sample SphereCloud(const UnsignedInteger size, const UnsignedInteger dimension, const UnsignedInteger seed)
+{
+  RandomGenerator::SetSeed(seed);
+  Sample cloud(Normal(dimension).getSample(size));
+  for (UnsignedInteger i = 0; i < size; ++ i)
+  {
+    const Scalar norm = Point(cloud[i]).norm();
+    for (UnsignedInteger j = 0; j < dimension; ++ j)
+      cloud(i, j) /= norm;
+  }
+  return cloud;
+}
+
+Mesh CubeMesh(const UnsignedInteger dimension, const UnsignedInteger cells, const Scalar lower, const Scalar upper)
+{
+  return IntervalMesher(Indices(dimension, cells)).build(Interval(Point(dimension, lower), Point(dimension, upper)));
+}
+
+/* Unit cube minus its upper corner [1/2,1]^3, a non-convex conforming volumetric mesh */
+Mesh NotchedCubeMesh(const UnsignedInteger cells)
+{
+  const Mesh cube(CubeMesh(3, 2 * cells, 0.0, 1.0));
+  const Sample vertices(cube.getVertices());
+  const IndicesCollection simplices(cube.getSimplices());
+  Indices oldToNew(vertices.getSize(), vertices.getSize());
+  Sample newVertices(0, 3);
+  Collection<Indices> newSimplices;
+  for (UnsignedInteger i = 0; i < simplices.getSize(); ++ i)
+  {
+    Point centroid(3);
+    for (UnsignedInteger j = 0; j < 4; ++ j)
+      for (UnsignedInteger k = 0; k < 3; ++ k)
+        centroid[k] += 0.25 * vertices(simplices(i, j), k);
+    if ((centroid[0] > 0.5) && (centroid[1] > 0.5) && (centroid[2] > 0.5))
+      continue;
+    Indices simplex(4);
+    for (UnsignedInteger j = 0; j < 4; ++ j)
+    {
+      const UnsignedInteger index = simplices(i, j);
+      if (oldToNew[index] == vertices.getSize())
+      {
+        oldToNew[index] = newVertices.getSize();
+        newVertices.add(vertices[index]);
+      }
+      simplex[j] = oldToNew[index];
+    }
+    newSimplices.add(simplex);
+  }
+  return Mesh(newVertices, IndicesCollection(newSimplices));
+}
+
+/* Each simplex gets its own copy of its vertices, the worst case for compression */
+Mesh ExplodedMesh(const Mesh & mesh)
+{
+  const Sample vertices(mesh.getVertices());
+  const IndicesCollection simplices(mesh.getSimplices());
+  const UnsignedInteger dimension = mesh.getDimension();
+  const UnsignedInteger simplexSize = simplices.getSize() ? simplices.cend_at(0) - simplices.cbegin_at(0) : 0;
+  Sample newVertices(simplices.getSize() * simplexSize, dimension);
+  IndicesCollection newSimplices(simplices.getSize(), simplexSize);
+  for (UnsignedInteger i = 0; i < simplices.getSize(); ++ i)
+    for (UnsignedInteger j = 0; j < simplexSize; ++ j)
+    {
+      for (UnsignedInteger k = 0; k < dimension; ++ k)
+        newVertices(i * simplexSize + j, k) = vertices(simplices(i, j), k);
+      newSimplices(i, j) = i * simplexSize + j;
+    }
+  return Mesh(newVertices, newSimplices);
+}
+
+Sample CirclePolygon(const UnsignedInteger size, const Scalar radius)
+{
+  Sample polygon(size, 2);
+  for (UnsignedInteger i = 0; i < size; ++ i)
+  {
+    const Scalar theta = 2.0 * M_PI * i / size;
+    polygon(i, 0) = radius * std::cos(theta);
+    polygon(i, 1) = radius * std::sin(theta);
+  }
+  return polygon;
+}
+
+/* Cases */
+
+void BenchCloudMesher(BenchRunner & runner, const UnsignedInteger seed)
+{
+  for (UnsignedInteger method = CloudMesher::BASIC; method <= CloudMesher::DELAUNAY; ++ method)
+  {
+    const String variant(method == CloudMesher::BASIC ? "BASIC" : "DELAUNAY");
+    const CloudMesher mesher(static_cast<CloudMesher::TriangulationMethod>(method));
+    for (UnsignedInteger dimension = 2; dimension <= 6; ++ dimension)
+    {
+      // the triangulation size grows like n^(d/2), reduce the sweep accordingly
+      Indices sizes;
+      if (dimension <= 3)
+        sizes = {100, 1000, 10000, 100000};
+      else if (dimension == 4)
+        sizes = {100, 1000, 10000};
+      else
+        sizes = {50, 200, 1000};
+      if (runner.quick())
+        sizes = Indices(1, sizes[0]);
+      for (const UnsignedInteger size : sizes)
+      {
+        const Sample cloud(UniformCloud(size, dimension, seed));
+        runner.run("CloudMesher", variant, dimension, size, [&]()
+        {
+          return MeshOutput(mesher.build(cloud));
+        });
+      }
+    }
+  }
+}
+
+void BenchConvexHullMesher(BenchRunner & runner, const UnsignedInteger seed)
+{
+  // the backend (CGAL or Qhull) is selected at build time and reported in the header
+  const ConvexHullMesher mesher;
+  for (UnsignedInteger dimension = 2; dimension <= 5; ++ dimension)
+  {
+    Indices sizes;
+    if (dimension <= 3)
+      sizes = {1000, 10000, 100000};
+    else
+      sizes = {100, 1000, 5000};
+    if (runner.quick())
+      sizes = Indices(1, sizes[0]);
+    for (const UnsignedInteger size : sizes)
+    {
+      const Sample uniform(UniformCloud(size, dimension, seed));
+      runner.run("ConvexHullMesher", "uniform", dimension, size, [&]()
+      {
+        return MeshOutput(mesher.build(uniform));
+      });
+      const Sample sphere(SphereCloud(size, dimension, seed));
+      runner.run("ConvexHullMesher", "sphere", dimension, size, [&]()
+      {
+        return MeshOutput(mesher.build(sphere));
+      });
+    }
+  }
+}
+
+void BenchIntersectionMesher(BenchRunner & runner, const UnsignedInteger seed)
+{
+  IntersectionMesher mesher;
+
+  // pairwise intersection of two overlapping cubes, ie the build2 kernel
+  for (UnsignedInteger dimension = 2; dimension <= 4; ++ dimension)
+  {
+    Indices cells;
+    if (dimension == 2)
+      cells = {4, 8, 16};
+    else if (dimension == 3)
+      cells = {2, 4, 6};
+    else
+      cells = {1, 2, 3};
+    if (runner.quick())
+      cells = Indices(1, cells[0]);
+    for (const UnsignedInteger n : cells)
+    {
+      const IntersectionMesher::MeshCollection coll = {CubeMesh(dimension, n, 0.0, 3.0), CubeMesh(dimension, n, 1.0, 4.0)};
+      for (const Bool recompress : {false, true})
+      {
+        mesher.setRecompress(recompress);
+        runner.run("IntersectionMesher", recompress ? "build2+recompress" : "build2", dimension, coll[0].getSimplicesNumber(), [&]()
+        {
+          return MeshOutput(mesher.build(coll));
+        });
+      }
+    }
+  }
+  mesher.setRecompress(true);
+
+  // intersection of random convex hulls
+  for (UnsignedInteger dimension = 2; dimension <= 4; ++ dimension)
+  {
+    Indices sizes = {20, 100, 500};
+    if (runner.quick())
+      sizes = Indices(1, sizes[0]);
+    for (const UnsignedInteger size : sizes)
+    {
+      IntersectionMesher::MeshCollection coll;
+      for (UnsignedInteger k = 0; k < 3; ++ k)
+      {
+        Sample cloud(UniformCloud(size, dimension, seed + k));
+        cloud += Point(dimension, 0.2 * k);
+        coll.add(ConvexHullMesher().build(cloud));
+      }
+      runner.run("IntersectionMesher", "buildConvex", dimension, size, [&]()
+      {
+        return MeshOutput(mesher.buildConvex(coll));
+      });
+    }
+  }
+
+  // two orthogonal 3-d cylinders
+  Indices discretizations = {2, 4, 8};
+  if (runner.quick())
+    discretizations = Indices(1, discretizations[0]);
+  for (const UnsignedInteger nTheta : {16, 64})
+  {
+    const Mesh disc(PolygonMesher().build(CirclePolygon(nTheta, 1.0)));
+    for (const UnsignedInteger m : discretizations)
+    {
+      const IntersectionMesher::CylinderCollection coll = {Cylinder(disc, Interval(-2.0, 2.0), Indices(1, 2), m),
+                                                           Cylinder(disc, Interval(-2.0, 2.0), Indices(1, 0), m)
+                                                          };
+      runner.run("IntersectionMesher", OSS() << "buildCylinder/nTheta=" << nTheta, 3, m, [&]()
+      {
+        return MeshOutput(mesher.buildCylinder(coll));
+      });
+    }
+    if (runner.quick())
+      break;
+  }
+}
+
+void BenchCompressMesh(BenchRunner & runner)
+{
+  for (UnsignedInteger dimension = 2; dimension <= 4; ++ dimension)
+  {
+    Indices cells;
+    if (dimension == 2)
+      cells = {16, 64, 256};
+    else if (dimension == 3)
+      cells = {4, 16, 32};
+    else
+      cells = {2, 4, 8};
+    if (runner.quick())
+      cells = Indices(1, cells[0]);
+    for (const UnsignedInteger n : cells)
+    {
+      const Mesh exploded(ExplodedMesh(CubeMesh(dimension, n, 0.0, 1.0)));
+      runner.run("UnionMesher", "CompressMesh", dimension, exploded.getVerticesNumber(), [&]()
+      {
+        return MeshOutput(UnionMesher::CompressMesh(exploded));
+      });
+    }
+  }
+}
+
+void BenchConvexDecompositionMesher(BenchRunner & runner)
+{
+  Indices cells = {1, 2, 4};
+  if (runner.quick())
+    cells = Indices(1, cells[0]);
+  for (UnsignedInteger method = ConvexDecompositionMesher::EXACT; method <= ConvexDecompositionMesher::APPROXIMATE; ++ method)
+  {
+    const String variant(method == ConvexDecompositionMesher::EXACT ? "EXACT" : "APPROXIMATE");
+    const ConvexDecompositionMesher mesher(static_cast<ConvexDecompositionMesher::DecompositionMethod>(method));
+    for (const UnsignedInteger n : cells)
+    {
+      const Mesh notched(NotchedCubeMesh(n));
+      runner.run("ConvexDecompositionMesher", variant, 3, notched.getSimplicesNumber(), [&]()
+      {
+        const Collection<Mesh> parts(mesher.build(notched));
+        BenchOutput output;
+        output.parts_ = parts.getSize();
+        for (UnsignedInteger i = 0; i < parts.getSize(); ++ i)
+        {
+          output.vertices_ += parts[i].getVerticesNumber();
+          output.simplices_ += parts[i].getSimplicesNumber();
+        }
+        return output;
+      });
+    }
+  }
+}
+
+void BenchMeshDomain2(BenchRunner & runner, const UnsignedInteger seed)
+{
+  Indices sizes = {1000, 10000, 100000};
+  if (runner.quick())
+    sizes = Indices(1, sizes[0]);
+  for (UnsignedInteger dimension = 2; dimension <= 3; ++ dimension)
+  {
+    const MeshDomain2 domain(dimension == 2 ? CubeMesh(2, 32, 0.0, 1.0) : NotchedCubeMesh(8));
+    for (const UnsignedInteger size : sizes)
+    {
+      // queries on [-1/2, 3/2]^d, so that about half of the points are outside
+      Sample queries(UniformCloud(size, dimension, seed));
+      queries *= Point(dimension, 2.0);
+      queries -= Point(dimension, 0.5);
+      runner.run("MeshDomain2", "computeDistance", dimension, size, [&]()
+      {
+        const Sample distances(domain.computeDistance(queries));
+        BenchOutput output;
+        output.vertices_ = distances.getSize();
+        return output;
+      });
+    }
+  }
+}
+
+}
+
+int main(int argc, char *argv[])
+{
+  BenchOptions options;
+  for (int i = 1; i < argc; ++ i)
+  {
+    const String arg(argv[i]);
+    const Bool hasValue = (i + 1 < argc);
+    if ((arg == "--output") && hasValue)
+      options.output_ = argv[++ i];
+    else if ((arg == "--filter") && hasValue)
+      options.filter_ = argv[++ i];
+    else if ((arg == "--repeat") && hasValue)
+      options.repeat_ = std::max(1L, std::atol(argv[++ i]));
+    else if ((arg == "--seed") && hasValue)
+      options.seed_ = std::atol(argv[++ i]);
+    else if (arg == "--quick")
+      options.quick_ = true;
+    else
+    {
+      std::cerr << "Usage: " << argv[0] << " [--output FILE] [--filter SUBSTRING] [--repeat N] [--seed N] [--quick]" << std::endl;
+      return 1;
+    }
+  }
+
+  BenchRunner runner(options);
+  BenchCloudMesher(runner, options.seed_);
+  BenchConvexHullMesher(runner, options.seed_);
+  BenchIntersectionMesher(runner, options.seed_);
+  BenchCompressMesh(runner);
+  BenchConvexDecompositionMesher(runner);
+  BenchMeshDomain2(runner, options.seed_);
+
+  if (options.output_.empty())
+    runner.writeJSON(std::cout);
+  else
+  {
+    std::ofstream ofs(options.output_.c_str());
+    if (!ofs)
+    {
+      std::cerr << "Cannot write " << options.output_ << std::endl;
+      return 1;
+    }
+    runner.writeJSON(ofs);
+  }
+  return 0;
+}
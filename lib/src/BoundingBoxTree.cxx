@@ -0,0 +1,323 @@
+//                                               -*- C++ -*-
+/**
+ *  @brief Bounding box index over mesh simplices
+ *
+ *  Copyright 2005-2026 Airbus-EDF-IMACS-ONERA-Phimeca
+ *
+ *  This library is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License
+ *  along with this library.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+#include "otmeshing/BoundingBoxTree.hxx"
+
+#include <openturns/PersistentObjectFactory.hxx>
+#include <openturns/SpecFunc.hxx>
+#include <openturns/TBBImplementation.hxx>
+
+#include <algorithm>
+#include <vector>
+
+using namespace OT;
+
+namespace OTMESHING
+{
+
+/* Squared distance from a point to the box of the given row */
+static inline Scalar BoxSquaredDistance(const Point & x,
+                                        const Sample & lowerBounds,
+                                        const Sample & upperBounds,
+                                        const UnsignedInteger row)
+{
+  Scalar distance2 = 0.0;
+  for (UnsignedInteger k = 0; k < x.getDimension(); ++ k)
+  {
+    const Scalar delta = std::max(std::max(lowerBounds(row, k) - x[k], x[k] - upperBounds(row, k)), 0.0);
+    distance2 += delta * delta;
+  }
+  return distance2;
+}
+
+/* Whether the box of the given row intersects the interval, up to a tolerance */
+static inline Bool BoxIntersects(const Point & lowerBound,
+                                 const Point & upperBound,
+                                 const Sample & lowerBounds,
+                                 const Sample & upperBounds,
+                                 const UnsignedInteger row,
+                                 const Scalar tolerance)
+{
+  for (UnsignedInteger k = 0; k < lowerBound.getDimension(); ++ k)
+    if ((lowerBounds(row, k) > upperBound[k] + tolerance) || (lowerBound[k] > upperBounds(row, k) + tolerance))
+      return false;
+  return true;
+}
+
+/* Query the boxes containing each point, one sequential traversal per point */
+struct BoundingBoxTreeQueryPolicy
+{
+  const BoundingBoxTree & tree_;
+  const Sample & sample_;
+  Collection<Indices> & output_;
+
+  BoundingBoxTreeQueryPolicy(const BoundingBoxTree & tree,
+                             const Sample & sample,
+                             Collection<Indices> & output)
+    : tree_(tree)
+    , sample_(sample)
+    , output_(output)
+  {}
+
+  inline void operator()(const TBBImplementation::BlockedRange<UnsignedInteger> & r) const
+  {
+    for (UnsignedInteger i = r.begin(); i != r.end(); ++ i)
+      output_[i] = tree_.queryContaining(sample_[i]);
+  }
+}; /* end struct BoundingBoxTreeQueryPolicy */
+
+CLASSNAMEINIT(BoundingBoxTree)
+
+static Factory<BoundingBoxTree> Factory_BoundingBoxTree;
+
+
+/* Default constructor */
+BoundingBoxTree::BoundingBoxTree()
+  : PersistentObject()
+{
+  // Nothing to do
+}
+
+/* Parameters constructor */
+BoundingBoxTree::BoundingBoxTree(const Mesh & mesh)
+  : PersistentObject()
+  , mesh_(mesh)
+{
+  initialize();
+}
+
+/* Virtual constructor method */
+BoundingBoxTree * BoundingBoxTree::clone() const
+{
+  return new BoundingBoxTree(*this);
+}
+
+/* Compute the boxes and build the hierarchy */
+void BoundingBoxTree::initialize()
+{
+  const UnsignedInteger dimension = mesh_.getDimension();
+  const UnsignedInteger simplicesNumber = mesh_.getSimplicesNumber();
+  if (!simplicesNumber)
+    throw InvalidArgumentException(HERE) << "BoundingBoxTree expected a mesh with simplices";
+  const Sample vertices(mesh_.getVertices());
+  const IndicesCollection simplices(mesh_.getSimplices());
+  lowerBounds_ = Sample(simplicesNumber, dimension);
+  upperBounds_ = Sample(simplicesNumber, dimension);
+  std::vector<Scalar> centres(simplicesNumber * dimension);
+  for (UnsignedInteger i = 0; i < simplicesNumber; ++ i)
+  {
+    for (UnsignedInteger k = 0; k < dimension; ++ k)
+    {
+      lowerBounds_(i, k) = SpecFunc::MaxScalar;
+      upperBounds_(i, k) = SpecFunc::LowestScalar;
+    }
+    for (IndicesCollection::const_iterator it = simplices.cbegin_at(i); it != simplices.cend_at(i); ++ it)
+      for (UnsignedInteger k = 0; k < dimension; ++ k)
+      {
+        lowerBounds_(i, k) = std::min(lowerBounds_(i, k), vertices(*it, k));
+        upperBounds_(i, k) = std::max(upperBounds_(i, k), vertices(*it, k));
+      }
+    for (UnsignedInteger k = 0; k < dimension; ++ k)
+      centres[i * dimension + k] = 0.5 * (lowerBounds_(i, k) + upperBounds_(i, k));
+  }
+
+  // top-down median split of the box centres along the widest axis,
+  // the nodes are numbered breadth first and the two children are contiguous
+  const UnsignedInteger leafSize = 8;
+  order_ = Indices(simplicesNumber);
+  order_.fill();
+  Indices ranges(2);
+  ranges[1] = simplicesNumber;
+  Indices children(1);
+  std::vector<Scalar> nodeLowerBounds;
+  std::vector<Scalar> nodeUpperBounds;
+  for (UnsignedInteger node = 0; node < children.getSize(); ++ node)
+  {
+    const UnsignedInteger begin = ranges[2 * node];
+    const UnsignedInteger end = ranges[2 * node + 1];
+    Point lowerBound(dimension, SpecFunc::MaxScalar);
+    Point upperBound(dimension, SpecFunc::LowestScalar);
+    Point centresLowerBound(dimension, SpecFunc::MaxScalar);
+    Point centresUpperBound(dimension, SpecFunc::LowestScalar);
+    for (UnsignedInteger j = begin; j < end; ++ j)
+      for (UnsignedInteger k = 0; k < dimension; ++ k)
+      {
+        lowerBound[k] = std::min(lowerBound[k], lowerBounds_(order_[j], k));
+        upperBound[k] = std::max(upperBound[k], upperBounds_(order_[j], k));
+        centresLowerBound[k] = std::min(centresLowerBound[k], centres[order_[j] * dimension + k]);
+        centresUpperBound[k] = std::max(centresUpperBound[k], centres[order_[j] * dimension + k]);
+      }
+    nodeLowerBounds.insert(nodeLowerBounds.end(), lowerBound.begin(), lowerBound.end());
+    nodeUpperBounds.insert(nodeUpperBounds.end(), upperBound.begin(), upperBound.end());
+    if (end - begin <= leafSize)
+      continue;
+    UnsignedInteger axis = 0;
+    for (UnsignedInteger k = 1; k < dimension; ++ k)
+      if (centresUpperBound[k] - centresLowerBound[k] > centresUpperBound[axis] - centresLowerBound[axis])
+        axis = k;
+    // all the centres coincide, the boxes cannot be separated
+    if (!(centresUpperBound[axis] > centresLowerBound[axis]))
+      continue;
+    const UnsignedInteger middle = begin + (end - begin) / 2;
+    std::nth_element(order_.begin() + begin, order_.begin() + middle, order_.begin() + end,
+                     [&centres, dimension, axis](const UnsignedInteger a, const UnsignedInteger b)
+    {
+      return centres[a * dimension + axis] < centres[b * dimension + axis];
+    });
+    children[node] = children.getSize();
+    ranges.add(begin);
+    ranges.add(middle);
+    ranges.add(middle);
+    ranges.add(end);
+    children.add(0);
+    children.add(0);
+  }
+  const UnsignedInteger nodesNumber = children.getSize();
+  nodeLowerBounds_ = Sample(nodesNumber, dimension);
+  nodeUpperBounds_ = Sample(nodesNumber, dimension);
+  std::copy(nodeLowerBounds.begin(), nodeLowerBounds.end(), nodeLowerBounds_.getImplementation()->data());
+  std::copy(nodeUpperBounds.begin(), nodeUpperBounds.end(), nodeUpperBounds_.getImplementation()->data());
+  nodeRanges_ = ranges;
+  nodeChildren_ = children;
+
+  // containment tolerance relative to the size of the mesh
+  Scalar diagonal2 = 0.0;
+  for (UnsignedInteger k = 0; k < dimension; ++ k)
+    diagonal2 += (nodeUpperBounds_(0, k) - nodeLowerBounds_(0, k)) * (nodeUpperBounds_(0, k) - nodeLowerBounds_(0, k));
+  tolerance_ = SpecFunc::Precision * std::sqrt(diagonal2);
+}
+
+/* Indexed mesh accessor */
+Mesh BoundingBoxTree::getMesh() const
+{
+  return mesh_;
+}
+
+/* Indices of the simplices whose bounding box contains the point */
+Indices BoundingBoxTree::queryContaining(const Point & x) const
+{
+  return queryWithinDistance(x, 0.0);
+}
+
+/* Indices of the simplices whose bounding box is within a distance of the point */
+Indices BoundingBoxTree::queryWithinDistance(const Point & x, const Scalar radius) const
+{
+  const UnsignedInteger dimension = mesh_.getDimension();
+  if (x.getDimension() != dimension)
+    throw InvalidArgumentException(HERE) << "Expected a point of dimension " << dimension << " got " << x.getDimension();
+  if (!(radius >= 0.0))
+    throw InvalidArgumentException(HERE) << "Expected a non-negative radius, here radius=" << radius;
+  Indices result;
+  if (!nodeChildren_.getSize())
+    return result;
+  const Scalar tolerance2 = (radius + tolerance_) * (radius + tolerance_);
+  std::vector<UnsignedInteger> stack(1, 0);
+  while (!stack.empty())
+  {
+    const UnsignedInteger node = stack.back();
+    stack.pop_back();
+    if (BoxSquaredDistance(x, nodeLowerBounds_, nodeUpperBounds_, node) > tolerance2)
+      continue;
+    if (nodeChildren_[node])
+    {
+      stack.push_back(nodeChildren_[node]);
+      stack.push_back(nodeChildren_[node] + 1);
+      continue;
+    }
+    for (UnsignedInteger j = nodeRanges_[2 * node]; j < nodeRanges_[2 * node + 1]; ++ j)
+      if (BoxSquaredDistance(x, lowerBounds_, upperBounds_, order_[j]) <= tolerance2)
+        result.add(order_[j]);
+  }
+  std::sort(result.begin(), result.end());
+  return result;
+}
+
+/* Indices of the simplices whose bounding box intersects the interval */
+Indices BoundingBoxTree::queryIntersecting(const Interval & box) const
+{
+  const UnsignedInteger dimension = mesh_.getDimension();
+  if (box.getDimension() != dimension)
+    throw InvalidArgumentException(HERE) << "Expected an interval of dimension " << dimension << " got " << box.getDimension();
+  Indices result;
+  if (!nodeChildren_.getSize())
+    return result;
+  const Point lowerBound(box.getLowerBound());
+  const Point upperBound(box.getUpperBound());
+  std::vector<UnsignedInteger> stack(1, 0);
+  while (!stack.empty())
+  {
+    const UnsignedInteger node = stack.back();
+    stack.pop_back();
+    if (!BoxIntersects(lowerBound, upperBound, nodeLowerBounds_, nodeUpperBounds_, node, tolerance_))
+      continue;
+    if (nodeChildren_[node])
+    {
+      stack.push_back(nodeChildren_[node]);
+      stack.push_back(nodeChildren_[node] + 1);
+      continue;
+    }
+    for (UnsignedInteger j = nodeRanges_[2 * node]; j < nodeRanges_[2 * node + 1]; ++ j)
+      if (BoxIntersects(lowerBound, upperBound, lowerBounds_, upperBounds_, order_[j], tolerance_))
+        result.add(order_[j]);
+  }
+  std::sort(result.begin(), result.end());
+  return result;
+}
+
+IndicesCollection BoundingBoxTree::queryContaining(const Sample & sample) const
+{
+  const UnsignedInteger dimension = mesh_.getDimension();
+  if (sample.getDimension() != dimension)
+    throw InvalidArgumentException(HERE) << "Expected a sample of dimension " << dimension << " got " << sample.getDimension();
+  const UnsignedInteger size = sample.getSize();
+  Collection<Indices> result(size);
+  const BoundingBoxTreeQueryPolicy policy(*this, sample, result);
+  TBBImplementation::ParallelFor(0, size, policy);
+  return IndicesCollection(result);
+}
+
+/* String converter */
+String BoundingBoxTree::__repr__() const
+{
+  OSS oss(true);
+  oss << "class=" << BoundingBoxTree::GetClassName()
+      << " simplices=" << mesh_.getSimplicesNumber()
+      << " nodes=" << nodeChildren_.getSize();
+  return oss;
+}
+
+/* Method save() stores the object through the StorageManager */
+void BoundingBoxTree::save(Advocate & adv) const
+{
+  PersistentObject::save(adv);
+  adv.saveAttribute("mesh_", mesh_);
+}
+
+/* Method load() reloads the object from the StorageManager */
+void BoundingBoxTree::load(Advocate & adv)
+{
+  PersistentObject::load(adv);
+  adv.loadAttribute("mesh_", mesh_);
+  // the boxes and the tree are rebuilt
+  if (mesh_.getSimplicesNumber())
+    initialize();
+}
+
+} /* namespace OTMESHING */
@@ -0,0 +1,100 @@
+//                                               -*- C++ -*-
+/**
+ *  @brief Cooperative cancellation of the builds
+ *
+ *  Copyright 2005-2026 Airbus-EDF-IMACS-ONERA-Phimeca
+ *
+ *  This library is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License
+ *  along with this library.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+#include "otmeshing/CancellationToken.hxx"
+
+#include <openturns/PersistentObjectFactory.hxx>
+
+using namespace OT;
+
+namespace OTMESHING
+{
+
+InterruptionException::InterruptionException(const PointInSourceFile & point)
+  : Exception(point, "InterruptionException")
+{
+  // Nothing to do
+}
+
+InterruptionException::~InterruptionException() throw()
+{
+  // Nothing to do
+}
+
+
+CLASSNAMEINIT(CancellationToken)
+
+static Factory<CancellationToken> Factory_CancellationToken;
+
+
+/* Default constructor */
+CancellationToken::CancellationToken()
+  : PersistentObject()
+  , cancelled_(new std::atomic<bool>(false))
+{
+  // Nothing to do
+}
+
+/* Virtual constructor method */
+CancellationToken * CancellationToken::clone() const
+{
+  return new CancellationToken(*this);
+}
+
+/* Request the cancellation */
+void CancellationToken::cancel()
+{
+  cancelled_->store(true);
+}
+
+void CancellationToken::reset()
+{
+  cancelled_->store(false);
+}
+
+/* Cancellation request accessor */
+Bool CancellationToken::isCancelled() const
+{
+  return cancelled_->load();
+}
+
+/* Interruption messages */
+String CancellationToken::GetInterruptionPrefix()
+{
+  return "Build interrupted: ";
+}
+
+Bool CancellationToken::IsInterruption(const String & message)
+{
+  // the message starts with the name of the exception, the prefix alone may be quoted by another exception
+  const String name("InterruptionException");
+  return message.compare(0, name.size(), name) == 0;
+}
+
+/* String converter */
+String CancellationToken::__repr__() const
+{
+  OSS oss;
+  oss << "class=" << CancellationToken::GetClassName()
+      << " cancelled=" << isCancelled();
+  return oss;
+}
+
+} /* namespace OTMESHING */
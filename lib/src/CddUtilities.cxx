@@ -0,0 +1,192 @@
+//                                               -*- C++ -*-
+/**
+ *  @brief cddlib helpers
+ *
+ *  Copyright 2005-2026 Airbus-EDF-IMACS-ONERA-Phimeca
+ *
+ *  This library is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License
+ *  along with this library.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+#include "CddUtilities.hxx"
+
+#ifdef OPENTURNS_HAVE_CDDLIB
+
+#include <openturns/Exception.hxx>
+
+#include <mutex>
+
+using namespace OT;
+
+namespace OTMESHING
+{
+
+static std::mutex CddGlobalConstantsMutex;
+static UnsignedInteger CddGlobalConstantsUsers = 0;
+
+CddGlobalConstants::CddGlobalConstants()
+{
+  std::lock_guard<std::mutex> lock(CddGlobalConstantsMutex);
+  if (!CddGlobalConstantsUsers)
+    dd_set_global_constants();
+  ++ CddGlobalConstantsUsers;
+}
+
+CddGlobalConstants::~CddGlobalConstants()
+{
+  std::lock_guard<std::mutex> lock(CddGlobalConstantsMutex);
+  -- CddGlobalConstantsUsers;
+  if (!CddGlobalConstantsUsers)
+    dd_free_global_constants();
+}
+
+static std::mutex CddConversionMutex;
+
+CddLock::CddLock()
+{
+  CddConversionMutex.lock();
+}
+
+CddLock::~CddLock()
+{
+  CddConversionMutex.unlock();
+}
+
+String cdd_error_to_string(const dd_ErrorType err)
+{
+  switch (err)
+  {
+    case dd_DimensionTooLarge:
+      return "Dimension too large";
+    case dd_ImproperInputFormat:
+      return "Improper input format";
+    case dd_NegativeMatrixSize:
+      return "Negative matrix size";
+    case dd_EmptyVrepresentation:
+      return "Empty V-representation";
+    case dd_EmptyHrepresentation:
+      return "Empty H-representation";
+    case dd_EmptyRepresentation:
+      return "Empty representation";
+    case dd_IFileNotFound:
+      return "Input file not found";
+    case dd_OFileNotOpen:
+      return "Output file not open";
+    case dd_NoLPObjective:
+      return "No LP objective specified";
+    case dd_NoRealNumberSupport:
+      return "No real number support (library built without GMP?)";
+    case dd_NotAvailForH:
+      return "Operation not available for H-representation";
+    case dd_NotAvailForV:
+      return "Operation not available for V-representation";
+    case dd_CannotHandleLinearity:
+      return "Cannot handle linearity in this context";
+    case dd_RowIndexOutOfRange:
+      return "Row index out of range";
+    case dd_ColIndexOutOfRange:
+      return "Column index out of range";
+    case dd_LPCycling:
+      return "LP cycling detected";
+    case dd_NumericallyInconsistent:
+      return "Numerical inconsistency detected";
+    case dd_NoError:
+      return "No error";
+    default:
+        return "Unknown cddlib error";
+  }
+}
+
+/* H-representation of the convex hull of a set of points */
+Sample computeInequalities(const Sample & points)
+{
+  const UnsignedInteger size = points.getSize();
+  const UnsignedInteger dimension = points.getDimension();
+  dd_ErrorType err = dd_NoError;
+  CddMatrix m(dd_CreateMatrix(size, dimension + 1));
+  dd_SetMatrixRepresentationType(m.get(), dd_Generator);
+  for (UnsignedInteger i = 0; i < size; ++ i)
+  {
+    // homogeneous coordinate
+    dd_set_d(m->matrix[i][0], 1.0);
+    for (UnsignedInteger k = 0; k < dimension; ++ k)
+      dd_set_d(m->matrix[i][k + 1], points(i, k));
+  }
+  CddMatrix h;
+  {
+    const CddLock cddLock;
+    const CddPolyhedra p(dd_DDMatrix2Poly(m.get(), &err));
+    if (err != dd_NoError)
+      throw InternalException(HERE) << "dd_DDMatrix2Poly failed for hull: " << cdd_error_to_string(err);
+    h.reset(dd_CopyInequalities(p.get()));
+  }
+  m.reset();
+  const UnsignedInteger rowSize = h->rowsize;
+  Sample inequalities(0, dimension + 1);
+  Point row(dimension + 1);
+  for (UnsignedInteger i = 0; i < rowSize; ++ i)
+  {
+    for (UnsignedInteger k = 0; k <= dimension; ++ k)
+      row[k] = dd_get_d(h->matrix[i][k]);
+    inequalities.add(row);
+    // equalities are stored as a pair of opposite inequalities
+    if (set_member(i + 1, h->linset))
+      inequalities.add(row * (-1.0));
+  }
+  return inequalities;
+}
+
+/* Vertices of a bounded polyhedron given by its H-representation */
+Sample computeVertices(const Sample & inequalities)
+{
+  const UnsignedInteger size = inequalities.getSize();
+  const UnsignedInteger dimension = inequalities.getDimension() - 1;
+  dd_ErrorType err = dd_NoError;
+  CddMatrix h(dd_CreateMatrix(size, dimension + 1));
+  dd_SetMatrixRepresentationType(h.get(), dd_Inequality);
+  for (UnsignedInteger i = 0; i < size; ++ i)
+    for (UnsignedInteger k = 0; k <= dimension; ++ k)
+      dd_set_d(h->matrix[i][k], inequalities(i, k));
+  CddMatrix gen;
+  {
+    const CddLock cddLock;
+    const CddPolyhedra p(dd_DDMatrix2Poly(h.get(), &err));
+    if (err != dd_NoError)
+      throw InternalException(HERE) << "dd_DDMatrix2Poly failed for H-representation: " << cdd_error_to_string(err);
+    gen.reset(dd_CopyGenerators(p.get()));
+  }
+  h.reset();
+  Sample vertices(0, dimension);
+  Point vertex(dimension);
+  for (UnsignedInteger i = 0; i < static_cast<UnsignedInteger>(gen->rowsize); ++ i)
+  {
+    // First entry = 1 -> point, 0 -> ray
+    if (dd_get_d(gen->matrix[i][0]) != 1.0)
+      continue;
+    for (UnsignedInteger k = 0; k < dimension; ++ k)
+      vertex[k] = dd_get_d(gen->matrix[i][k + 1]);
+    vertices.add(vertex);
+  }
+  return vertices;
+}
+
+/* Extreme points of the convex hull of a set of points */
+Sample computeExtremePoints(const Sample & points)
+{
+  // the generators computed back from the H-representation are the extreme points only
+  return computeVertices(computeInequalities(points));
+}
+
+}
+
+#endif /* OPENTURNS_HAVE_CDDLIB */
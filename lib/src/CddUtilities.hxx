@@ -0,0 +1,107 @@
+//                                               -*- C++ -*-
+/**
+ *  @brief cddlib helpers
+ *
+ *  Copyright 2005-2026 Airbus-EDF-IMACS-ONERA-Phimeca
+ *
+ *  This library is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License
+ *  along with this library.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+#ifndef OTMESHING_CDDUTILITIES_HXX
+#define OTMESHING_CDDUTILITIES_HXX
+
+#ifdef OPENTURNS_HAVE_CDDLIB
+
+#include <openturns/Sample.hxx>
+
+#include <memory>
+#include <type_traits>
+
+#include <setoper.h>
+#include <cdd.h>
+
+namespace OTMESHING
+{
+
+/**
+ * Scoped initialization of the cddlib global constants.
+ * The constants are shared by all the threads: they are set by the first
+ * guard and freed by the last one, so that concurrent builds do not free
+ * them while another conversion is running.
+ */
+class CddGlobalConstants
+{
+public:
+  CddGlobalConstants();
+  ~CddGlobalConstants();
+
+private:
+  CddGlobalConstants(const CddGlobalConstants &) = delete;
+  CddGlobalConstants & operator=(const CddGlobalConstants &) = delete;
+};
+
+/**
+ * Scoped serialization of the cddlib conversions.
+ * cddlib is not reentrant: the conversions update global state such as its
+ * statistics counters and default solver choices, so concurrent builds run
+ * them one at a time. The matrices are filled and read outside of the lock.
+ */
+class CddLock
+{
+public:
+  CddLock();
+  ~CddLock();
+
+private:
+  CddLock(const CddLock &) = delete;
+  CddLock & operator=(const CddLock &) = delete;
+};
+
+/** Deleters of the cddlib objects, so that they are released when an exception is thrown */
+struct CddMatrixDeleter
+{
+  void operator()(dd_MatrixPtr matrix) const
+  {
+    dd_FreeMatrix(matrix);
+  }
+};
+
+struct CddPolyhedraDeleter
+{
+  void operator()(dd_PolyhedraPtr polyhedra) const
+  {
+    dd_FreePolyhedra(polyhedra);
+  }
+};
+
+typedef std::unique_ptr<std::remove_pointer<dd_MatrixPtr>::type, CddMatrixDeleter> CddMatrix;
+typedef std::unique_ptr<std::remove_pointer<dd_PolyhedraPtr>::type, CddPolyhedraDeleter> CddPolyhedra;
+
+/** Error message of a cddlib error code */
+OT::String cdd_error_to_string(const dd_ErrorType err);
+
+/** Extreme points of the convex hull of a set of points (V -> H -> V round trip) */
+OT::Sample computeExtremePoints(const OT::Sample & points);
+
+/** H-representation of the convex hull of a set of points, one row [b, -A] per inequality b - A x >= 0 */
+OT::Sample computeInequalities(const OT::Sample & points);
+
+/** Vertices of a bounded polyhedron given by its H-representation */
+OT::Sample computeVertices(const OT::Sample & inequalities);
+
+}
+
+#endif /* OPENTURNS_HAVE_CDDLIB */
+
+#endif /* OTMESHING_CDDUTILITIES_HXX */
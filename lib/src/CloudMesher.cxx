@@ -21,9 +21,15 @@
 #include "otmeshing/CloudMesher.hxx"
 #include <openturns/PersistentObjectFactory.hxx>
 
+#include <limits>
+
+#include "MeshingMonitor.hxx"
+#include "MeshingStatistics.hxx"
+
 #include <CGAL/Epick_d.h>
 #include <CGAL/Triangulation.h>
 #include <CGAL/Delaunay_triangulation.h>
+#include <CGAL/spatial_sort.h>
 
 #if 0
 #include "libqhull_r/qhull_ra.h"
@@ -57,65 +63,269 @@ CloudMesher * CloudMesher::clone() const
 }
 
 
-template <class TriangulationType>
-Mesh buildTriangulation(const Sample & points)
+/* Simplices written in place during the extraction, then wrapped into the output mesh */
+template <class MeshType>
+struct SimplexStorage;
+
+template <>
+struct SimplexStorage<Mesh>
 {
-  const UnsignedInteger dimension = points.getDimension();
-  const UnsignedInteger size = points.getSize();
+  SimplexStorage(const UnsignedInteger simplicesNumber, const UnsignedInteger simplexSize)
+    : simplices_(simplicesNumber, simplexSize)
+  {}
+
+  UnsignedInteger * data()
+  {
+    return simplices_.getSize() ? &simplices_(0, 0) : nullptr;
+  }
+
+  Mesh getMesh(const Sample & vertices)
+  {
+    return Mesh(vertices, simplices_);
+  }
+
+  IndicesCollection simplices_;
+};
+
+template <>
+struct SimplexStorage<CompactMesh>
+{
+  SimplexStorage(const UnsignedInteger simplicesNumber, const UnsignedInteger simplexSize)
+    : simplices_(simplicesNumber * simplexSize)
+  {}
+
+  std::uint32_t * data()
+  {
+    return simplices_.data();
+  }
+
+  CompactMesh getMesh(const Sample & vertices)
+  {
+    return CompactMesh(vertices, std::move(simplices_));
+  }
+
+  CompactMesh::IndexStorage simplices_;
+};
+
+/* Number of points inserted or cells extracted between two checks of the monitor */
+static const UnsignedInteger CloudMesherCheckPeriod = 4096;
+
+template <class TriangulationType, class MeshType>
+MeshType buildTriangulation(const Scalar * data, const UnsignedInteger size, const UnsignedInteger dimension, MeshingStatistics & statistics, MeshingMonitor & monitor)
+{
+  MeshingTimer insertionTimer(statistics, "insertionTime");
+  monitor.setPhase("insertion", 0.0, 0.7);
   TriangulationType triangulation(dimension);
   std::vector<typename TriangulationType::Point> pts(size);
+  for (UnsignedInteger i = 0; i < size; ++ i)
+    pts[i] = typename TriangulationType::Point{dimension, data + i * dimension, data + (i + 1) * dimension};
+  // same as the batch insertion: spatially sorted points inserted from the cell of the previous one,
+  // which leaves room to check the monitor between the batches
+  CGAL::spatial_sort(pts.begin(), pts.end(), triangulation.geom_traits());
+  typename TriangulationType::Full_cell_handle hint;
   for (UnsignedInteger i = 0; i < size; ++ i)
   {
-    const Point point(points[i]);
-    pts[i] = typename TriangulationType::Point{dimension, point.begin(), point.end()};
+    if (i % CloudMesherCheckPeriod == 0)
+    {
+      monitor.check();
+      monitor.progress(1.0 * i / size);
+    }
+    hint = triangulation.insert(pts[i], hint)->full_cell();
   }
-  // it is much faster to insert vertices by batch
-  triangulation.insert(pts.begin(), pts.end());
+  insertionTimer.stop();
 
+  monitor.check();
+  monitor.setPhase("extraction", 0.7, 1.0);
+  MeshingTimer extractionTimer(statistics, "extractionTime");
   // the vertices are reordered by the triangulation
   std::unordered_map<typename TriangulationType::Vertex_iterator, UnsignedInteger> vertexToIndexMap;
   UnsignedInteger vertexIndex = 0;
-  Sample vertices(0, dimension);
+  Sample vertices(triangulation.number_of_vertices(), dimension);
 
   // the infinite first vertex can be skipped
   for (typename TriangulationType::Vertex_iterator vi = ++ triangulation.vertices_begin(); vi != triangulation.vertices_end(); ++ vi)
   {
-    vertices.add(Point(vi->point().cartesian_begin(), vi->point().cartesian_end()));
+    std::copy(vi->point().cartesian_begin(), vi->point().cartesian_end(), &vertices(vertexIndex, 0));
     vertexToIndexMap[vi] = vertexIndex;
     ++ vertexIndex;
   }
 
-  IndicesCollection simplices(triangulation.number_of_finite_full_cells(), dimension + 1);
+  const UnsignedInteger simplicesNumber = triangulation.number_of_finite_full_cells();
+  SimplexStorage<MeshType> simplices(simplicesNumber, dimension + 1);
+  auto simplexData = simplices.data();
   UnsignedInteger simplexIndex = 0;
   for (typename TriangulationType::Finite_full_cell_const_iterator cit = triangulation.finite_full_cells_begin(); cit != triangulation.finite_full_cells_end(); ++ cit)
   {
+    if (simplexIndex % CloudMesherCheckPeriod == 0)
+    {
+      monitor.check();
+      monitor.progress(1.0 * simplexIndex / simplicesNumber);
+    }
+    ++ simplexIndex;
     for (UnsignedInteger j = 0; j < dimension + 1; ++ j)
     {
       const typename TriangulationType::Vertex_handle vh = cit->vertex(j);
-      simplices(simplexIndex, j) = vertexToIndexMap[vh];
+      *simplexData = vertexToIndexMap[vh];
+      ++ simplexData;
     }
-    ++ simplexIndex;
   }
-  return Mesh(vertices, simplices);
+  statistics.add("simplicesProduced", simplicesNumber);
+  monitor.setPhase("done", 1.0, 1.0);
+  return simplices.getMesh(vertices);
+}
+
+template <class MeshType>
+MeshType triangulate(const UnsignedInteger method, const Scalar * data, const UnsignedInteger size, const UnsignedInteger dimension, MeshingStatistics & statistics, MeshingMonitor & monitor)
+{
+  switch (method)
+  {
+    case CloudMesher::BASIC:
+      return buildTriangulation<DefaultTriangulation, MeshType>(data, size, dimension, statistics, monitor);
+    case CloudMesher::DELAUNAY:
+      return buildTriangulation<DelaunayTriangulation, MeshType>(data, size, dimension, statistics, monitor);
+    default:
+      throw InvalidArgumentException(HERE) << "Unknown triangulation method: " << method;
+  }
+}
+
+/* Sub-triangulations used by the estimation stop growing at these sizes */
+static const UnsignedInteger CloudMesherEstimationMaximumSize = 4096;
+static const UnsignedInteger CloudMesherEstimationMaximumSimplices = 200000;
+
+/* Approximate memory of a build: input copy, CGAL vertices and full cells, vertex map and output mesh */
+static Scalar EstimateMemory(const UnsignedInteger size, const UnsignedInteger dimension, const Scalar simplicesNumber, const UnsignedInteger indexSize)
+{
+  // with a dynamic dimension each point and each cell array is a heap block behind a vector header
+  const Scalar block = 3.0 * sizeof(void *) + 16.0;
+  const Scalar vertexMemory = 3.0 * dimension * sizeof(Scalar) + 2.0 * block + 8.0 * sizeof(void *);
+  const Scalar cellMemory = 2.0 * (dimension + 1) * sizeof(void *) + 2.0 * block + 2.0 * sizeof(void *) + (dimension + 1.0) * indexSize;
+  return size * vertexMemory + simplicesNumber * cellMemory;
+}
+
+/* Number of simplices of the triangulation of an evenly strided sub-sample */
+template <class TriangulationType>
+Scalar countSimplices(const Scalar * data, const UnsignedInteger size, const UnsignedInteger subSize, const UnsignedInteger dimension)
+{
+  TriangulationType triangulation(dimension);
+  std::vector<typename TriangulationType::Point> pts(subSize);
+  for (UnsignedInteger i = 0; i < subSize; ++ i)
+  {
+    const Scalar * point = data + (i * size / subSize) * dimension;
+    pts[i] = typename TriangulationType::Point{dimension, point, point + dimension};
+  }
+  triangulation.insert(pts.begin(), pts.end());
+  return triangulation.number_of_finite_full_cells();
+}
+
+/* The number of simplices grows linearly with the size for a given distribution of the points, but the hull
+   cells are over-represented in small sub-samples: the growth is taken between the two largest sub-samples */
+template <class TriangulationType>
+Scalar estimateSimplicesNumber(const Scalar * data, const UnsignedInteger size, const UnsignedInteger dimension)
+{
+  UnsignedInteger subSize = std::min(size, std::max<UnsignedInteger>(64, 4 * (dimension + 1)));
+  Scalar previousSize = 0.0;
+  Scalar previousCount = 0.0;
+  while (true)
+  {
+    const Scalar count = countSimplices<TriangulationType>(data, size, subSize, dimension);
+    if (subSize == size)
+      return count;
+    const UnsignedInteger nextSize = std::min(size, 2 * subSize);
+    if ((nextSize > CloudMesherEstimationMaximumSize) || (count * nextSize / subSize > CloudMesherEstimationMaximumSimplices))
+    {
+      const Scalar ratio = count / subSize;
+      const Scalar slope = (previousSize > 0.0) ? (count - previousCount) / (subSize - previousSize) : ratio;
+      return count + std::max(slope, ratio) * (size - subSize);
+    }
+    previousSize = subSize;
+    previousCount = count;
+    subSize = nextSize;
+  }
+}
+
+/* Predicted number of simplices and memory of a build */
+static Point estimateBuild(const UnsignedInteger method, const Scalar * data, const UnsignedInteger size, const UnsignedInteger dimension, const UnsignedInteger indexSize)
+{
+  Scalar simplicesNumber = 1.0;
+  if (dimension > 1)
+  {
+    switch (method)
+    {
+      case CloudMesher::BASIC:
+        simplicesNumber = estimateSimplicesNumber<DefaultTriangulation>(data, size, dimension);
+        break;
+      case CloudMesher::DELAUNAY:
+        simplicesNumber = estimateSimplicesNumber<DelaunayTriangulation>(data, size, dimension);
+        break;
+      default:
+        throw InvalidArgumentException(HERE) << "Unknown triangulation method: " << method;
+    }
+  }
+  Point estimation(2);
+  estimation[0] = simplicesNumber;
+  estimation[1] = EstimateMemory(size, dimension, simplicesNumber, indexSize);
+  return estimation;
+}
+
+/* Triangulation method fitting in the memory budget, the build fails before allocating anything otherwise */
+static UnsignedInteger selectMethod(const UnsignedInteger method,
+                                    const UnsignedInteger maximumMemory,
+                                    const Bool memoryFallback,
+                                    const Scalar * data, const UnsignedInteger size, const UnsignedInteger dimension,
+                                    const UnsignedInteger indexSize,
+                                    MeshingStatistics & statistics)
+{
+  if (!maximumMemory)
+    return method;
+  MeshingTimer estimationTimer(statistics, "estimationTime");
+  Point estimation(estimateBuild(method, data, size, dimension, indexSize));
+  statistics.add("estimatedSimplices", estimation[0]);
+  statistics.add("estimatedMemory", estimation[1]);
+  if (estimation[1] <= maximumMemory)
+    return method;
+
+  // the basic triangulation only splits the cell containing an interior point, it has far fewer simplices
+  if (memoryFallback && (method == CloudMesher::DELAUNAY))
+  {
+    const Point fallback(estimateBuild(CloudMesher::BASIC, data, size, dimension, indexSize));
+    if (fallback[1] <= maximumMemory)
+    {
+      LOGWARN(OSS() << "CloudMesher Delaunay triangulation estimated to " << estimation[0] << " simplices and "
+              << estimation[1] << " bytes above the maximum memory of " << maximumMemory << " bytes, falling back to the basic triangulation");
+      statistics.add("memoryFallbacks", 1.0);
+      return CloudMesher::BASIC;
+    }
+    estimation = fallback;
+  }
+  throw InternalException(HERE) << "CloudMesher triangulation of " << size << " points in dimension " << dimension << " estimated to "
+                                << estimation[0] << " simplices and " << estimation[1] << " bytes, above the maximum memory of "
+                                << maximumMemory << " bytes";
 }
 
 
 Mesh CloudMesher::build(const Sample & points) const
 {
-  const UnsignedInteger dimension = points.getDimension();
-  const UnsignedInteger size = points.getSize();
+  return build(points.getImplementation()->data(), points.getSize(), points.getDimension());
+}
+
+/* The points are read in place, row after row, without being copied into a Sample */
+Mesh CloudMesher::build(const Scalar * data, const UnsignedInteger size, const UnsignedInteger dimension) const
+{
   if (!dimension)
     throw InvalidArgumentException(HERE) << "CloudMesher expected a non-null dimension";
   if (size < dimension + 1)
     throw InvalidArgumentException(HERE) << "CloudMesher expected a size of at least " << dimension + 1 << " got " << size;
-  Sample vertices(0, points.getDimension());
+  Sample vertices(0, dimension);
+  MeshingStatistics statistics;
   if (dimension == 1)
   {
     // special case for dim=1 to avoid special handling in the generic part
-    vertices.add(points.getMin());
-    vertices.add(points.getMax());
+    const std::pair<const Scalar *, const Scalar *> bounds(std::minmax_element(data, data + size));
+    vertices.add(Point(1, *bounds.first));
+    vertices.add(Point(1, *bounds.second));
     IndicesCollection simplices(1, dimension + 1);
     simplices(0, 1) = 1;
+    statistics.publish(statistics_);
     return Mesh(vertices, simplices);
   }
 
@@ -130,7 +340,7 @@ Mesh CloudMesher::build(const Sample & points) const
   // Run Qhull
   const String qhull_cmd("qhull d Qt Qx Qz"); // options: delaunay + triangulated output + deterministic output + infinity point
   int rc = qh_new_qhull(qh, dimension, size,
-                        const_cast<Scalar*>(points.getImplementation()->data()),
+                        const_cast<Scalar*>(data),
                         False, /* ismalloc */
                         const_cast<char*>(qhull_cmd.c_str()),
                         NULL, NULL);
@@ -197,18 +407,111 @@ Mesh CloudMesher::build(const Sample & points) const
 
   return Mesh(vertices, IndicesCollection(simplexColl));
 #else
-  switch (triangulationMethod_)
-  {
-    case BASIC:
-      return buildTriangulation<DefaultTriangulation>(points);
-    case DELAUNAY:
-      return buildTriangulation<DelaunayTriangulation>(points);
-    default:
-      throw InvalidArgumentException(HERE) << "Unknown triangulation method: " << triangulationMethod_;
-  }
+  const UnsignedInteger method = selectMethod(triangulationMethod_, maximumMemory_, memoryFallback_, data, size, dimension, sizeof(UnsignedInteger), statistics);
+  MeshingMonitor monitor("CloudMesher", cancellationToken_, maximumTimeDuration_, progressCallback_.first, progressCallback_.second);
+  const Mesh result(triangulate<Mesh>(method, data, size, dimension, statistics, monitor));
+  statistics.add("peakMemory", MeshingStatistics::PeakMemory());
+  statistics.publish(statistics_);
+  return result;
 #endif
 }
 
+/* The simplices are extracted directly with 32-bit indices */
+CompactMesh CloudMesher::buildCompact(const Sample & points) const
+{
+  const UnsignedInteger dimension = points.getDimension();
+  if ((dimension == 1) || (points.getSize() < dimension + 1))
+    return CompactMesh(build(points));
+  if (points.getSize() > std::numeric_limits<std::uint32_t>::max())
+    throw InvalidArgumentException(HERE) << "CloudMesher cannot index " << points.getSize() << " points on 32 bits";
+  MeshingStatistics statistics;
+  const Scalar * data = points.getImplementation()->data();
+  const UnsignedInteger method = selectMethod(triangulationMethod_, maximumMemory_, memoryFallback_, data, points.getSize(), dimension, sizeof(std::uint32_t), statistics);
+  MeshingMonitor monitor("CloudMesher", cancellationToken_, maximumTimeDuration_, progressCallback_.first, progressCallback_.second);
+  const CompactMesh result(triangulate<CompactMesh>(method, data, points.getSize(), dimension, statistics, monitor));
+  statistics.add("peakMemory", MeshingStatistics::PeakMemory());
+  statistics.publish(statistics_);
+  return result;
+}
+
+/* Build estimation */
+PointWithDescription CloudMesher::estimate(const Sample & points) const
+{
+  const UnsignedInteger dimension = points.getDimension();
+  if (!dimension)
+    throw InvalidArgumentException(HERE) << "CloudMesher expected a non-null dimension";
+  if (points.getSize() < dimension + 1)
+    throw InvalidArgumentException(HERE) << "CloudMesher expected a size of at least " << dimension + 1 << " got " << points.getSize();
+  PointWithDescription result(estimateBuild(triangulationMethod_, points.getImplementation()->data(), points.getSize(), dimension, sizeof(UnsignedInteger)));
+  Description description(2);
+  description[0] = "simplicesNumber";
+  description[1] = "memory";
+  result.setDescription(description);
+  return result;
+}
+
+/* Memory budget accessor */
+void CloudMesher::setMaximumMemory(const UnsignedInteger maximumMemory)
+{
+  maximumMemory_ = maximumMemory;
+}
+
+UnsignedInteger CloudMesher::getMaximumMemory() const
+{
+  return maximumMemory_;
+}
+
+/* Memory fallback flag accessor */
+void CloudMesher::setMemoryFallback(const Bool memoryFallback)
+{
+  memoryFallback_ = memoryFallback;
+}
+
+Bool CloudMesher::getMemoryFallback() const
+{
+  return memoryFallback_;
+}
+
+/* Cancellation token accessor */
+void CloudMesher::setCancellationToken(const CancellationToken & cancellationToken)
+{
+  cancellationToken_ = cancellationToken;
+}
+
+CancellationToken CloudMesher::getCancellationToken() const
+{
+  return cancellationToken_;
+}
+
+/* Time budget accessor */
+void CloudMesher::setMaximumTimeDuration(const Scalar maximumTimeDuration)
+{
+  maximumTimeDuration_ = maximumTimeDuration;
+}
+
+Scalar CloudMesher::getMaximumTimeDuration() const
+{
+  return maximumTimeDuration_;
+}
+
+/* Progress callback accessor */
+void CloudMesher::setProgressCallback(ProgressCallback callBack, void * state)
+{
+  // the state is not released by the mesher
+  setProgressCallback(callBack, ProgressCallbackState(state, [](void *) {}));
+}
+
+void CloudMesher::setProgressCallback(ProgressCallback callBack, const ProgressCallbackState & state)
+{
+  progressCallback_ = std::pair<ProgressCallback, ProgressCallbackState>(callBack, state);
+}
+
+/* Statistics accessor */
+PointWithDescription CloudMesher::getStatistics() const
+{
+  return MeshingStatistics::Read(statistics_);
+}
+
 /* String converter */
 String CloudMesher::__repr__() const
 {
@@ -222,6 +525,8 @@ void CloudMesher::save(Advocate & adv) const
 {
   PersistentObject::save(adv);
   adv.saveAttribute("triangulationMethod_", triangulationMethod_);
+  adv.saveAttribute("maximumMemory_", maximumMemory_);
+  adv.saveAttribute("memoryFallback_", memoryFallback_);
 }
 
 /* Method load() reloads the object from the StorageManager */
@@ -229,6 +534,8 @@ void CloudMesher::load(Advocate & adv)
 {
   PersistentObject::load(adv);
   adv.loadAttribute("triangulationMethod_", triangulationMethod_);
+  adv.loadAttribute("maximumMemory_", maximumMemory_);
+  adv.loadAttribute("memoryFallback_", memoryFallback_);
 }
 
 
@@ -0,0 +1,179 @@
+//                                               -*- C++ -*-
+/**
+ *  @brief Mesh with 32-bit simplex indices
+ *
+ *  Copyright 2005-2026 Airbus-EDF-IMACS-ONERA-Phimeca
+ *
+ *  This library is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License
+ *  along with this library.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+#include "otmeshing/CompactMesh.hxx"
+
+#include <openturns/PersistentObjectFactory.hxx>
+
+#include <limits>
+
+using namespace OT;
+
+namespace OTMESHING
+{
+
+CLASSNAMEINIT(CompactMesh)
+
+static Factory<CompactMesh> Factory_CompactMesh;
+
+
+/* Default constructor */
+CompactMesh::CompactMesh()
+  : PersistentObject()
+  , simplices_(new IndexStorage)
+{
+  // Nothing to do
+}
+
+/* Conversion from a mesh, the vertices are shared */
+CompactMesh::CompactMesh(const Mesh & mesh)
+  : CompactMesh(mesh.getVertices(), mesh.getSimplices())
+{
+  // Nothing to do
+}
+
+/* Parameters constructors */
+CompactMesh::CompactMesh(const Sample & vertices,
+                         const IndicesCollection & simplices)
+  : PersistentObject()
+  , vertices_(vertices)
+  , simplices_(new IndexStorage)
+{
+  const UnsignedInteger simplexSize = vertices.getDimension() + 1;
+  const UnsignedInteger simplicesNumber = simplices.getSize();
+  if (simplicesNumber && (simplices.cend_at(simplicesNumber - 1) - simplices.cbegin_at(0) != static_cast<SignedInteger>(simplicesNumber * simplexSize)))
+    throw InvalidArgumentException(HERE) << "CompactMesh expected simplices of size " << simplexSize;
+  if (vertices.getSize() > std::numeric_limits<std::uint32_t>::max())
+    throw InvalidArgumentException(HERE) << "CompactMesh cannot index " << vertices.getSize() << " vertices on 32 bits";
+  simplices_->resize(simplicesNumber * simplexSize);
+  if (simplicesNumber)
+    std::transform(simplices.cbegin_at(0), simplices.cend_at(simplicesNumber - 1), simplices_->begin(),
+                   [](const UnsignedInteger index) {return static_cast<std::uint32_t>(index);});
+  checkIndices();
+}
+
+CompactMesh::CompactMesh(const Sample & vertices,
+                         IndexStorage && simplices)
+  : PersistentObject()
+  , vertices_(vertices)
+  , simplices_(new IndexStorage(std::move(simplices)))
+{
+  if (vertices.getSize() > std::numeric_limits<std::uint32_t>::max())
+    throw InvalidArgumentException(HERE) << "CompactMesh cannot index " << vertices.getSize() << " vertices on 32 bits";
+  if (simplices_->size() % (vertices.getDimension() + 1))
+    throw InvalidArgumentException(HERE) << "CompactMesh expected simplices of size " << vertices.getDimension() + 1;
+  checkIndices();
+}
+
+/* Virtual constructor method */
+CompactMesh * CompactMesh::clone() const
+{
+  return new CompactMesh(*this);
+}
+
+void CompactMesh::checkIndices() const
+{
+  const UnsignedInteger verticesNumber = vertices_.getSize();
+  for (const std::uint32_t index : *simplices_)
+    if (index >= verticesNumber)
+      throw InvalidArgumentException(HERE) << "CompactMesh vertex index " << index << " must be less than " << verticesNumber;
+}
+
+/* Dimension accessor */
+UnsignedInteger CompactMesh::getDimension() const
+{
+  return vertices_.getDimension();
+}
+
+/* Vertices accessors */
+UnsignedInteger CompactMesh::getVerticesNumber() const
+{
+  return vertices_.getSize();
+}
+
+Sample CompactMesh::getVertices() const
+{
+  return vertices_;
+}
+
+/* Simplices accessors */
+UnsignedInteger CompactMesh::getSimplicesNumber() const
+{
+  return simplices_->size() / (getDimension() + 1);
+}
+
+IndicesCollection CompactMesh::getSimplices() const
+{
+  const UnsignedInteger simplicesNumber = getSimplicesNumber();
+  IndicesCollection simplices(simplicesNumber, getDimension() + 1);
+  if (simplicesNumber)
+    std::copy(simplices_->begin(), simplices_->end(), &simplices(0, 0));
+  return simplices;
+}
+
+Indices CompactMesh::getSimplex(const UnsignedInteger index) const
+{
+  if (index >= getSimplicesNumber())
+    throw OutOfBoundException(HERE) << "Simplex index " << index << " must be less than " << getSimplicesNumber();
+  const UnsignedInteger simplexSize = getDimension() + 1;
+  return Indices(simplices_->begin() + index * simplexSize, simplices_->begin() + (index + 1) * simplexSize);
+}
+
+const std::uint32_t * CompactMesh::getSimplicesData() const
+{
+  return simplices_->data();
+}
+
+/* Conversion to a mesh */
+Mesh CompactMesh::getMesh() const
+{
+  return Mesh(vertices_, getSimplices());
+}
+
+/* String converter */
+String CompactMesh::__repr__() const
+{
+  OSS oss(true);
+  oss << "class=" << CompactMesh::GetClassName()
+      << " dimension=" << getDimension()
+      << " vertices=" << getVerticesNumber()
+      << " simplices=" << getSimplicesNumber();
+  return oss;
+}
+
+/* Method save() stores the object through the StorageManager */
+void CompactMesh::save(Advocate & adv) const
+{
+  PersistentObject::save(adv);
+  adv.saveAttribute("vertices_", vertices_);
+  adv.saveAttribute("simplices_", Indices(simplices_->begin(), simplices_->end()));
+}
+
+/* Method load() reloads the object from the StorageManager */
+void CompactMesh::load(Advocate & adv)
+{
+  PersistentObject::load(adv);
+  adv.loadAttribute("vertices_", vertices_);
+  Indices simplices;
+  adv.loadAttribute("simplices_", simplices);
+  simplices_ = new IndexStorage(simplices.begin(), simplices.end());
+}
+
+} /* namespace OTMESHING */
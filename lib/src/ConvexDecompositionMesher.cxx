@@ -24,20 +24,34 @@
 
 #include <openturns/PersistentObjectFactory.hxx>
 #include <openturns/SpecFunc.hxx>
+#include <openturns/SquareMatrix.hxx>
+#include <openturns/TBBImplementation.hxx>
 
 #include <CGAL/Exact_predicates_exact_constructions_kernel.h>
 #include <CGAL/Polyhedron_3.h>
+#include <CGAL/Polyhedron_items_with_id_3.h>
 #include <CGAL/Surface_mesh.h>
 #include <CGAL/Nef_polyhedron_3.h>
 #include <CGAL/boost/graph/convert_nef_polyhedron_to_polygon_mesh.h>
 #include <CGAL/convex_decomposition_3.h>
 #include <CGAL/Polyhedron_incremental_builder_3.h>
-#include <CGAL/Polygon_mesh_processing/triangulate_faces.h>
+#include <CGAL/Polygon_mesh_processing/self_intersections.h>
+
+#include <algorithm>
+#include <deque>
+#include <iterator>
+#include <unordered_map>
+#include <map>
+#include <set>
+
+#include "MeshingMonitor.hxx"
+#include "MeshingStatistics.hxx"
 
 using namespace OT;
 
 using KernelExact = CGAL::Exact_predicates_exact_constructions_kernel;
 using Polyhedron = CGAL::Polyhedron_3<KernelExact>;
+using PolyhedronWithId = CGAL::Polyhedron_3<KernelExact, CGAL::Polyhedron_items_with_id_3>;
 using HDS = Polyhedron::HalfedgeDS;
 using Surface_mesh = CGAL::Surface_mesh<KernelExact::Point_3>;
 using Nef_polyhedron = CGAL::Nef_polyhedron_3<KernelExact>;
@@ -46,14 +60,428 @@ using Point_3 = KernelExact::Point_3;
 namespace OTMESHING
 {
 
+/* Oriented boundary triangles of a set of tetrahedra, the shared faces cancel out */
+static IndicesCollection extractBoundary(const Sample & vertices, const Collection<Indices> & tetrahedra)
+{
+  // outward faces of a positively oriented tetrahedron
+  const UnsignedInteger faceVertex[4][3] = {{1, 2, 3}, {0, 3, 2}, {0, 1, 3}, {0, 2, 1}};
+  std::map<Indices, UnsignedInteger> faceCount;
+  Collection<Indices> faces;
+  for (UnsignedInteger i = 0; i < tetrahedra.getSize(); ++ i)
+  {
+    Indices tetrahedron(tetrahedra[i]);
+    Point u(3), v(3), w(3);
+    for (UnsignedInteger k = 0; k < 3; ++ k)
+    {
+      u[k] = vertices(tetrahedron[1], k) - vertices(tetrahedron[0], k);
+      v[k] = vertices(tetrahedron[2], k) - vertices(tetrahedron[0], k);
+      w[k] = vertices(tetrahedron[3], k) - vertices(tetrahedron[0], k);
+    }
+    const Scalar det = u[0] * (v[1] * w[2] - v[2] * w[1]) - u[1] * (v[0] * w[2] - v[2] * w[0]) + u[2] * (v[0] * w[1] - v[1] * w[0]);
+    if (det < 0.0)
+      std::swap(tetrahedron[2], tetrahedron[3]);
+    for (UnsignedInteger j = 0; j < 4; ++ j)
+    {
+      Indices face(3);
+      for (UnsignedInteger k = 0; k < 3; ++ k)
+        face[k] = tetrahedron[faceVertex[j][k]];
+      Indices key(face);
+      std::sort(key.begin(), key.end());
+      ++ faceCount[key];
+      faces.add(face);
+    }
+  }
+  Collection<Indices> boundary;
+  for (UnsignedInteger i = 0; i < faces.getSize(); ++ i)
+  {
+    Indices key(faces[i]);
+    std::sort(key.begin(), key.end());
+    if (faceCount[key] == 1)
+      boundary.add(faces[i]);
+  }
+  return IndicesCollection(boundary);
+}
+
+/* Nef polyhedron bounded by a closed oriented triangle surface */
+static Nef_polyhedron buildNefFromSurface(const Sample & vertices, const IndicesCollection & triangles, const Bool checkSelfIntersection = false)
+{
+  Polyhedron poly;
+  CGAL::Polyhedron_incremental_builder_3<HDS> builder(poly.hds(), true);
+  builder.begin_surface(vertices.getSize(), triangles.getSize());
+  for (UnsignedInteger i = 0; i < vertices.getSize(); ++ i)
+  {
+    const Point_3 p{vertices(i, 0), vertices(i, 1), vertices(i, 2)};
+    builder.add_vertex(p);
+  }
+  for (UnsignedInteger i = 0; i < triangles.getSize(); ++ i)
+  {
+    builder.begin_facet();
+    for (UnsignedInteger j = 0; j < 3; ++ j)
+      builder.add_vertex_to_facet(triangles(i, j));
+    builder.end_facet();
+  }
+  builder.end_surface();
+  if (builder.error())
+    throw InvalidArgumentException(HERE) << "Polyhedron surface is not a manifold";
+
+  // we have to check unconnected vertices otherwise older CGAL crashes when converting to Nef_polyhedron
+  if (builder.check_unconnected_vertices())
+  {
+    LOGDEBUG("ConvexDecompositionMesher detected unconnected vertices, removing");
+    if (!builder.remove_unconnected_vertices())
+      throw InvalidArgumentException(HERE) << "Polyhedron could not remove all unconnected vertices";
+  }
+
+  if (!poly.is_valid(Log::HasDebug()))
+    throw InvalidArgumentException(HERE) << "Polyhedron must be valid";
+
+  if (!poly.is_closed())
+    throw InvalidArgumentException(HERE) << "Polyhedron must be closed";
+
+  if (checkSelfIntersection && CGAL::Polygon_mesh_processing::does_self_intersect(poly))
+    throw InvalidArgumentException(HERE) << "Polyhedron must not self-intersect";
+
+  const Nef_polyhedron nef(poly);
+
+  if (!nef.is_simple())
+    throw InvalidArgumentException(HERE) <<  "Nef polyhedron is not simple";
+  return nef;
+}
+
+/* Union of tetrahedra as a balanced tree of pairwise unions */
+static Nef_polyhedron buildNefFromTetrahedra(const Sample & vertices, const Collection<Indices> & tetrahedra, MeshingMonitor & monitor)
+{
+  std::vector<Nef_polyhedron> level;
+  level.reserve(tetrahedra.getSize());
+  for (UnsignedInteger i = 0; i < tetrahedra.getSize(); ++ i)
+  {
+    Point_3 v[4];
+    for (UnsignedInteger j = 0; j < 4; ++ j)
+    {
+      const UnsignedInteger index = tetrahedra[i][j];
+      v[j] = Point_3(vertices(index, 0), vertices(index, 1), vertices(index, 2));
+    }
+    Polyhedron poly;
+    poly.make_tetrahedron(v[0], v[1], v[2], v[3]);
+    level.push_back(Nef_polyhedron(poly));
+  }
+  if (level.empty())
+    return Nef_polyhedron();
+
+  // each union costs the size of its operands, which stay balanced
+  const UnsignedInteger size = level.size();
+  UnsignedInteger unionsNumber = 0;
+  while (level.size() > 1)
+  {
+    std::vector<Nef_polyhedron> next;
+    next.reserve((level.size() + 1) / 2);
+    for (UnsignedInteger i = 0; i + 1 < level.size(); i += 2)
+    {
+      // a tree of n leaves has n - 1 unions, the last ones being the most expensive
+      monitor.check();
+      monitor.progress(1.0 * unionsNumber / (size - 1));
+      next.push_back(level[i] + level[i + 1]);
+      ++ unionsNumber;
+    }
+    if (level.size() % 2)
+      next.push_back(level.back());
+    level.swap(next);
+  }
+  return level[0];
+}
+
+/* Unit normal and offset of an ordered facet, oriented by the generalized cross product of its edges */
+static void computeOrientedFacetPlane(const Sample & vertices,
+                                      const Indices & facet,
+                                      Point & normal,
+                                      Scalar & offset)
+{
+  const UnsignedInteger dimension = vertices.getDimension();
+  normal = Point(dimension, 1.0);
+  if (dimension > 1)
+  {
+    Matrix edges(dimension - 1, dimension);
+    for (UnsignedInteger i = 1; i < dimension; ++ i)
+      for (UnsignedInteger k = 0; k < dimension; ++ k)
+        edges(i - 1, k) = vertices(facet[i], k) - vertices(facet[0], k);
+    for (UnsignedInteger k = 0; k < dimension; ++ k)
+    {
+      SquareMatrix minor(dimension - 1);
+      for (UnsignedInteger i = 0; i < dimension - 1; ++ i)
+        for (UnsignedInteger l = 0; l < dimension - 1; ++ l)
+          minor(i, l) = edges(i, l < k ? l : l + 1);
+      normal[k] = ((k % 2) ? -1.0 : 1.0) * minor.computeDeterminant();
+    }
+  }
+  const Scalar norm = normal.norm();
+  if (norm > 0.0)
+    normal /= norm;
+  offset = normal.dot(vertices[facet[0]]);
+}
+
+/* Outward unit normal and offset of the facet of a simplex opposite to one of its vertices */
+static void computeFacetPlane(const Sample & vertices,
+                              const Indices & facet,
+                              const UnsignedInteger opposite,
+                              Point & normal,
+                              Scalar & offset)
+{
+  computeOrientedFacetPlane(vertices, facet, normal, offset);
+  if (normal.dot(vertices[opposite]) > offset)
+  {
+    normal *= -1.0;
+    offset = -offset;
+  }
+}
+
+/* Hash of a sorted facet or ridge */
+struct IndicesHash
+{
+  std::size_t operator()(const Indices & indices) const
+  {
+    std::size_t seed = indices.getSize();
+    for (UnsignedInteger i = 0; i < indices.getSize(); ++ i)
+      seed ^= std::hash<UnsignedInteger>()(indices[i]) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+    return seed;
+  }
+};
+
+/* Greedy merge of adjacent simplices into convex cells */
+static Collection<Mesh> mergeConvexCells(const Sample & vertices,
+                                         const IndicesCollection & simplices,
+                                         const Indices & kept,
+                                         MeshingMonitor & monitor)
+{
+  const UnsignedInteger dimension = vertices.getDimension();
+  const UnsignedInteger simplicesNumber = simplices.getSize();
+  const UnsignedInteger facetsNumber = dimension + 1;
+  const Scalar tolerance = std::sqrt(SpecFunc::Precision) * vertices.computeRange().norm();
+
+  // facet planes and simplex adjacency through the shared facets
+  Collection<Indices> facetKeys(simplicesNumber * facetsNumber);
+  Collection<Point> normals(simplicesNumber * facetsNumber);
+  Point offsets(simplicesNumber * facetsNumber);
+  std::map<Indices, Indices> facetToSimplices;
+  for (UnsignedInteger i = 0; i < kept.getSize(); ++ i)
+  {
+    const UnsignedInteger simplexIndex = kept[i];
+    for (UnsignedInteger j = 0; j < facetsNumber; ++ j)
+    {
+      Indices facet;
+      for (UnsignedInteger l = 0; l < facetsNumber; ++ l)
+        if (l != j)
+          facet.add(simplices(simplexIndex, l));
+      Point normal;
+      Scalar offset = 0.0;
+      computeFacetPlane(vertices, facet, simplices(simplexIndex, j), normal, offset);
+      const UnsignedInteger facetIndex = simplexIndex * facetsNumber + j;
+      normals[facetIndex] = normal;
+      offsets[facetIndex] = offset;
+      std::sort(facet.begin(), facet.end());
+      facetKeys[facetIndex] = facet;
+      facetToSimplices[facet].add(simplexIndex);
+    }
+  }
+  const auto signedDistance = [&](const UnsignedInteger facetIndex, const UnsignedInteger vertexIndex)
+  {
+    Scalar value = -offsets[facetIndex];
+    for (UnsignedInteger k = 0; k < dimension; ++ k)
+      value += normals[facetIndex][k] * vertices(vertexIndex, k);
+    return value;
+  };
+
+  Collection<Mesh> cells;
+  Indices assigned(simplicesNumber, 0);
+  for (UnsignedInteger i = 0; i < kept.getSize(); ++ i)
+  {
+    const UnsignedInteger seed = kept[i];
+    if (assigned[seed])
+      continue;
+    monitor.check();
+    monitor.progress(1.0 * i / kept.getSize());
+
+    // the cell is described by its boundary facets, indexed by their ridges, and its vertices
+    std::map<Indices, UnsignedInteger> boundary;
+    std::unordered_map<Indices, std::set<UnsignedInteger>, IndicesHash> ridgeFacets;
+    std::set<UnsignedInteger> cellVertices(simplices.cbegin_at(seed), simplices.cend_at(seed));
+    Indices cellSimplices(1, seed);
+    assigned[seed] = 1;
+    std::deque<UnsignedInteger> front;
+    // the ridge of a facet opposite to its vertex at position r
+    const auto ridgeKey = [&](const UnsignedInteger facetIndex, const UnsignedInteger r)
+    {
+      Indices ridge(facetKeys[facetIndex]);
+      ridge.erase(ridge.begin() + r);
+      return ridge;
+    };
+    const auto addFacet = [&](const UnsignedInteger facetIndex)
+    {
+      boundary[facetKeys[facetIndex]] = facetIndex;
+      for (UnsignedInteger r = 0; r < facetKeys[facetIndex].getSize(); ++ r)
+        ridgeFacets[ridgeKey(facetIndex, r)].insert(facetIndex);
+      const Indices & neighbours = facetToSimplices[facetKeys[facetIndex]];
+      front.insert(front.end(), neighbours.begin(), neighbours.end());
+    };
+    const auto removeFacet = [&](const UnsignedInteger facetIndex)
+    {
+      const UnsignedInteger boundaryIndex = boundary[facetKeys[facetIndex]];
+      boundary.erase(facetKeys[facetIndex]);
+      for (UnsignedInteger r = 0; r < facetKeys[boundaryIndex].getSize(); ++ r)
+        ridgeFacets[ridgeKey(boundaryIndex, r)].erase(boundaryIndex);
+    };
+    for (UnsignedInteger j = 0; j < facetsNumber; ++ j)
+      addFacet(seed * facetsNumber + j);
+
+    // a candidate is only tried again when the facets around its shared facet change
+    while (!front.empty())
+    {
+      const UnsignedInteger candidate = front.front();
+      front.pop_front();
+      if (assigned[candidate])
+        continue;
+
+      Indices newVertices;
+      for (IndicesCollection::const_iterator it = simplices.cbegin_at(candidate); it != simplices.cend_at(candidate); ++ it)
+        if (!cellVertices.count(*it))
+          newVertices.add(*it);
+      Indices sharedFacets;
+      Indices newFacets;
+      for (UnsignedInteger j = 0; j < facetsNumber; ++ j)
+      {
+        const UnsignedInteger facetIndex = candidate * facetsNumber + j;
+        if (boundary.count(facetKeys[facetIndex]))
+          sharedFacets.add(facetIndex);
+        else
+          newFacets.add(facetIndex);
+      }
+      if (!sharedFacets.getSize())
+        continue;
+
+      // the cell is connected through facets, so it stays convex iff it stays locally convex,
+      // ie along the ridges between the new facets and the remaining boundary facets
+      Bool convex = true;
+      Indices ridgeNeighbours;
+      for (UnsignedInteger j = 0; (j < newFacets.getSize()) && convex; ++ j)
+      {
+        const UnsignedInteger facetIndex = newFacets[j];
+        for (UnsignedInteger r = 0; (r < facetKeys[facetIndex].getSize()) && convex; ++ r)
+        {
+          const Indices ridge(ridgeKey(facetIndex, r));
+          const auto it = ridgeFacets.find(ridge);
+          if (it == ridgeFacets.end())
+            continue;
+          for (std::set<UnsignedInteger>::const_iterator jt = it->second.begin(); (jt != it->second.end()) && convex; ++ jt)
+          {
+            const UnsignedInteger neighbourIndex = *jt;
+            if (std::find_if(sharedFacets.begin(), sharedFacets.end(), [&](const UnsignedInteger f) {return facetKeys[f] == facetKeys[neighbourIndex];}) != sharedFacets.end())
+              continue;
+            const Indices & neighbourKey = facetKeys[neighbourIndex];
+            const UnsignedInteger neighbourOpposite = *std::find_if(neighbourKey.begin(), neighbourKey.end(), [&](const UnsignedInteger v) {return !std::binary_search(ridge.begin(), ridge.end(), v);});
+            convex = (signedDistance(neighbourIndex, facetKeys[facetIndex][r]) <= tolerance) && (signedDistance(facetIndex, neighbourOpposite) <= tolerance);
+            ridgeNeighbours.add(neighbourIndex);
+          }
+        }
+      }
+      if (!convex)
+        continue;
+
+      // grow the cell
+      assigned[candidate] = 1;
+      cellSimplices.add(candidate);
+      cellVertices.insert(newVertices.begin(), newVertices.end());
+      for (UnsignedInteger j = 0; j < sharedFacets.getSize(); ++ j)
+        removeFacet(sharedFacets[j]);
+      for (UnsignedInteger j = 0; j < newFacets.getSize(); ++ j)
+        addFacet(newFacets[j]);
+      // the boundary facets next to the new ones got new ridge neighbours
+      for (UnsignedInteger j = 0; j < ridgeNeighbours.getSize(); ++ j)
+      {
+        const Indices & neighbours = facetToSimplices[facetKeys[ridgeNeighbours[j]]];
+        front.insert(front.end(), neighbours.begin(), neighbours.end());
+      }
+    }
+
+    // each cell gets its own compact vertices, they are used as its V-representation
+    const Indices used(cellVertices.begin(), cellVertices.end());
+    std::map<UnsignedInteger, UnsignedInteger> localIndex;
+    for (UnsignedInteger l = 0; l < used.getSize(); ++ l)
+      localIndex[used[l]] = l;
+    IndicesCollection cellSimplicesLocal(cellSimplices.getSize(), facetsNumber);
+    for (UnsignedInteger l = 0; l < cellSimplices.getSize(); ++ l)
+      for (UnsignedInteger j = 0; j < facetsNumber; ++ j)
+        cellSimplicesLocal(l, j) = localIndex[simplices(cellSimplices[l], j)];
+    cells.add(Mesh(vertices.select(used), cellSimplicesLocal));
+  }
+  LOGDEBUG(OSS() << "ConvexDecompositionMesher merged simplices=" << kept.getSize() << " into cells=" << cells.getSize());
+  return cells;
+}
+
+/* Tetrahedra of convex parts, fanned from their first vertex over their convex facets */
+struct FanConvexPartPolicy
+{
+  const Collection<Sample> & vertices_;
+  const Collection<IndicesCollection> & facets_;
+  Collection<Mesh> & output_;
+
+  FanConvexPartPolicy(const Collection<Sample> & vertices,
+                      const Collection<IndicesCollection> & facets,
+                      Collection<Mesh> & output)
+    : vertices_(vertices)
+    , facets_(facets)
+    , output_(output)
+  {}
+
+  inline void operator()(const TBBImplementation::BlockedRange<UnsignedInteger> & r) const
+  {
+    // arbitrarily select the apex as the first vertex
+    const UnsignedInteger apexIndex = 0;
+    for (UnsignedInteger i = r.begin(); i != r.end(); ++ i)
+    {
+      const Sample & vertices = vertices_[i];
+      const IndicesCollection & facets = facets_[i];
+      Collection<Indices> simplices;
+      Indices simplex(4);
+      simplex[0] = apexIndex;
+      for (UnsignedInteger f = 0; f < facets.getSize(); ++ f)
+      {
+        // filter out the facets incident to the apex vertex
+        if (std::find(facets.cbegin_at(f), facets.cend_at(f), apexIndex) != facets.cend_at(f))
+          continue;
+        // the facets of a convex part are convex polygons, possibly with collinear vertices
+        const IndicesCollection::const_iterator first = facets.cbegin_at(f);
+        const UnsignedInteger facetSize = facets.cend_at(f) - first;
+        const Point origin(vertices[first[0]]);
+        for (UnsignedInteger j = 1; j + 1 < facetSize; ++ j)
+        {
+          // skip the flat triangles, which would give zero-volume tetrahedra
+          const Point u(Point(vertices[first[j]]) - origin);
+          const Point v(Point(vertices[first[j + 1]]) - origin);
+          Point cross(3);
+          cross[0] = u[1] * v[2] - u[2] * v[1];
+          cross[1] = u[2] * v[0] - u[0] * v[2];
+          cross[2] = u[0] * v[1] - u[1] * v[0];
+          if (cross.norm() <= std::sqrt(SpecFunc::Precision) * u.norm() * v.norm())
+            continue;
+          simplex[1] = first[0];
+          simplex[2] = first[j];
+          simplex[3] = first[j + 1];
+          simplices.add(simplex);
+        }
+      }
+      output_[i] = Mesh(vertices, IndicesCollection(simplices));
+    }
+  }
+}; /* end struct FanConvexPartPolicy */
+
 CLASSNAMEINIT(ConvexDecompositionMesher)
 
 static Factory<ConvexDecompositionMesher> Factory_ConvexDecompositionMesher;
 
 
 /* Default constructor */
-ConvexDecompositionMesher::ConvexDecompositionMesher()
+ConvexDecompositionMesher::ConvexDecompositionMesher(const DecompositionMethod method)
   : PersistentObject()
+  , decompositionMethod_(method)
 {
   // Nothing to do
 }
@@ -65,14 +493,197 @@ ConvexDecompositionMesher * ConvexDecompositionMesher::clone() const
 }
 
 
+/* Part of the approximate decomposition */
+struct ApproximatePart
+{
+  Indices simplices_;
+  // sorted vertices on the boundary of the part, a superset of the extreme points of its hull
+  Indices candidates_;
+  Scalar volume_ = 0.0;
+  Mesh hull_;
+  Scalar concavity_ = 0.0;
+};
+
+/* Sorted vertices of a set of simplices */
+static Indices computePartVertices(const IndicesCollection & simplices, const Indices & part)
+{
+  std::vector<UnsignedInteger> used;
+  for (UnsignedInteger i = 0; i < part.getSize(); ++ i)
+    used.insert(used.end(), simplices.cbegin_at(part[i]), simplices.cend_at(part[i]));
+  std::sort(used.begin(), used.end());
+  used.erase(std::unique(used.begin(), used.end()), used.end());
+  return Indices(used.begin(), used.end());
+}
+
+/* Convex hull of a set of simplices, from the candidate extreme points only, and its relative volume excess */
+static ApproximatePart computeApproximatePart(const Sample & vertices,
+                                              const IndicesCollection & simplices,
+                                              const Point & simplicesVolume,
+                                              const Indices & part,
+                                              const Indices & candidates)
+{
+  const UnsignedInteger dimension = vertices.getDimension();
+  ApproximatePart result;
+  result.simplices_ = part;
+  result.candidates_ = candidates;
+  for (UnsignedInteger i = 0; i < part.getSize(); ++ i)
+    result.volume_ += simplicesVolume[part[i]];
+  if (part.getSize() == 1)
+  {
+    // a simplex is its own hull
+    const Indices used(computePartVertices(simplices, part));
+    Indices simplex(dimension + 1);
+    for (UnsignedInteger j = 0; j <= dimension; ++ j)
+      simplex[j] = std::find(used.begin(), used.end(), simplices(part[0], j)) - used.begin();
+    result.hull_ = Mesh(vertices.select(used), IndicesCollection(Collection<Indices>(1, simplex)));
+    return result;
+  }
+  result.hull_ = CloudMesher().build(vertices.select(candidates));
+  const Scalar hullVolume = result.hull_.getVolume();
+  result.concavity_ = (hullVolume > 0.0) ? std::max(0.0, (hullVolume - result.volume_) / hullVolume) : 0.0;
+  return result;
+}
+
+/* Approximate decomposition by hierarchical bisection of the simplices */
+Collection<Mesh> ConvexDecompositionMesher::buildApproximate(const Mesh & mesh, MeshingMonitor & monitor) const
+{
+  const UnsignedInteger dimension = mesh.getDimension();
+  if (mesh.getIntrinsicDimension() != dimension)
+    throw InvalidArgumentException(HERE) << "ConvexDecompositionMesher approximate method expected a volumetric mesh, here got dimension=" << dimension << " and intrinsicDimension=" << mesh.getIntrinsicDimension();
+  const Sample vertices(mesh.getVertices());
+  const IndicesCollection simplices(mesh.getSimplices());
+  const Point simplicesVolume(mesh.computeSimplicesVolume());
+  const Scalar smallVolume = simplicesVolume.norm1() * SpecFunc::Precision;
+  MeshingStatistics statistics;
+  MeshingTimer bisectionTimer(statistics, "bisectionTime");
+
+  Indices all;
+  for (UnsignedInteger i = 0; i < simplices.getSize(); ++ i)
+    if (simplicesVolume[i] > smallVolume)
+      all.add(i);
+  Collection<ApproximatePart> parts;
+  if (!all.getSize())
+  {
+    MeshingStatistics().publish(statistics_);
+    return Collection<Mesh>();
+  }
+  // only the vertices of the boundary facets can be extreme
+  std::map<Indices, UnsignedInteger> facetCount;
+  for (UnsignedInteger i = 0; i < all.getSize(); ++ i)
+    for (UnsignedInteger j = 0; j <= dimension; ++ j)
+    {
+      Indices facet;
+      for (UnsignedInteger l = 0; l <= dimension; ++ l)
+        if (l != j)
+          facet.add(simplices(all[i], l));
+      std::sort(facet.begin(), facet.end());
+      ++ facetCount[facet];
+    }
+  std::vector<UnsignedInteger> boundaryVertices;
+  for (std::map<Indices, UnsignedInteger>::const_iterator it = facetCount.begin(); it != facetCount.end(); ++ it)
+    if (it->second == 1)
+      boundaryVertices.insert(boundaryVertices.end(), it->first.begin(), it->first.end());
+  std::sort(boundaryVertices.begin(), boundaryVertices.end());
+  boundaryVertices.erase(std::unique(boundaryVertices.begin(), boundaryVertices.end()), boundaryVertices.end());
+  parts.add(computeApproximatePart(vertices, simplices, simplicesVolume, all, Indices(boundaryVertices.begin(), boundaryVertices.end())));
+
+  // split the most concave part until all parts are within tolerance or the budget is exhausted
+  Indices splittable(1, 1);
+  monitor.setPhase("bisection", 0.0, 1.0);
+  while ((maximumPartNumber_ == 0) || (parts.getSize() < maximumPartNumber_))
+  {
+    monitor.check();
+    if (maximumPartNumber_ > 0)
+      monitor.progress(1.0 * parts.getSize() / maximumPartNumber_);
+    UnsignedInteger worst = parts.getSize();
+    for (UnsignedInteger i = 0; i < parts.getSize(); ++ i)
+      if (splittable[i] && (parts[i].concavity_ > concavityTolerance_) && ((worst == parts.getSize()) || (parts[i].concavity_ > parts[worst].concavity_)))
+        worst = i;
+    if (worst == parts.getSize())
+      break;
+
+    // bisect the simplex centroids along their largest extent
+    const Indices part(parts[worst].simplices_);
+    const UnsignedInteger size = part.getSize();
+    Sample centroids(size, dimension);
+    for (UnsignedInteger i = 0; i < size; ++ i)
+    {
+      for (IndicesCollection::const_iterator it = simplices.cbegin_at(part[i]); it != simplices.cend_at(part[i]); ++ it)
+        for (UnsignedInteger k = 0; k < dimension; ++ k)
+          centroids(i, k) += vertices(*it, k);
+      for (UnsignedInteger k = 0; k < dimension; ++ k)
+        centroids(i, k) /= (dimension + 1);
+    }
+    const Point range(centroids.computeRange());
+    const UnsignedInteger axis = std::max_element(range.begin(), range.end()) - range.begin();
+    if (!(range[axis] > 0.0))
+    {
+      splittable[worst] = 0;
+      continue;
+    }
+    Indices order(size);
+    order.fill();
+    const UnsignedInteger middle = size / 2;
+    std::nth_element(order.begin(), order.begin() + middle, order.end(),
+                     [&centroids, axis](const UnsignedInteger i, const UnsignedInteger j) {return centroids(i, axis) < centroids(j, axis);});
+    Indices left;
+    Indices right;
+    for (UnsignedInteger i = 0; i < size; ++ i)
+      (i < middle ? left : right).add(part[order[i]]);
+    // the boundary of a half is the part of the parent boundary it keeps and the cut,
+    // so the parent candidates are reused instead of all the vertices of the half
+    const Indices leftVertices(computePartVertices(simplices, left));
+    const Indices rightVertices(computePartVertices(simplices, right));
+    std::vector<UnsignedInteger> cut;
+    std::set_intersection(leftVertices.begin(), leftVertices.end(), rightVertices.begin(), rightVertices.end(), std::back_inserter(cut));
+    const Indices & parentCandidates = parts[worst].candidates_;
+    const auto halfCandidates = [&](const Indices & halfVertices)
+    {
+      std::vector<UnsignedInteger> kept;
+      std::set_intersection(parentCandidates.begin(), parentCandidates.end(), halfVertices.begin(), halfVertices.end(), std::back_inserter(kept));
+      std::vector<UnsignedInteger> candidates;
+      std::set_union(kept.begin(), kept.end(), cut.begin(), cut.end(), std::back_inserter(candidates));
+      return Indices(candidates.begin(), candidates.end());
+    };
+    const Indices leftCandidates(halfCandidates(leftVertices));
+    const Indices rightCandidates(halfCandidates(rightVertices));
+    parts[worst] = computeApproximatePart(vertices, simplices, simplicesVolume, left, leftCandidates);
+    parts.add(computeApproximatePart(vertices, simplices, simplicesVolume, right, rightCandidates));
+    splittable.add(1);
+    statistics.add("bisections", 1.0);
+  }
+  bisectionTimer.stop();
+  statistics.add("piecesProduced", parts.getSize());
+
+  Collection<Mesh> result(parts.getSize());
+  Scalar volumeError = 0.0;
+  for (UnsignedInteger i = 0; i < parts.getSize(); ++ i)
+  {
+    result[i] = parts[i].hull_;
+    volumeError += parts[i].hull_.getVolume() - parts[i].volume_;
+  }
+  statistics.add("volumeError", volumeError);
+  statistics.publish(statistics_);
+  monitor.setPhase("done", 1.0, 1.0);
+  LOGINFO(OSS() << "ConvexDecompositionMesher approximate parts=" << parts.getSize() << " volume error=" << volumeError);
+  return result;
+}
+
 Collection<Mesh> ConvexDecompositionMesher::build(const Mesh & mesh) const
 {
+  MeshingMonitor monitor("ConvexDecompositionMesher", cancellationToken_, maximumTimeDuration_, progressCallback_.first, progressCallback_.second);
+  if (decompositionMethod_ == APPROXIMATE)
+    return buildApproximate(mesh, monitor);
+  else if (decompositionMethod_ != EXACT)
+    throw InvalidArgumentException(HERE) << "Unknown decomposition method: " << decompositionMethod_;
+
   const UnsignedInteger dimension = mesh.getDimension();
   const UnsignedInteger intrinsicDimension = mesh.getIntrinsicDimension();
   const Sample vertices(mesh.getVertices());
   const IndicesCollection simplices(mesh.getSimplices());
   Collection<Mesh> result;
   const Point simplicesVolume(mesh.computeSimplicesVolume());
+  MeshingStatistics statistics;
 
   // LevelSetMesher can yield almost empty cells
   // possible workaround with key LevelSetMesher-SolveEquation=False
@@ -80,191 +691,365 @@ Collection<Mesh> ConvexDecompositionMesher::build(const Mesh & mesh) const
 
   if (dimension == 3)
   {
+    MeshingTimer nefTimer(statistics, "nefBuildTime");
+    monitor.setPhase("nef", 0.0, 0.4);
     Nef_polyhedron nef;
     if (intrinsicDimension == 2)
     {
       // build from the surface mesh
-      Polyhedron poly;
-      CGAL::Polyhedron_incremental_builder_3<HDS> builder(poly.hds(), true);
-      builder.begin_surface(vertices.getSize(), simplices.getSize());
-      for (UnsignedInteger i = 0; i < vertices.getSize(); ++ i)
-      {
-        const Point_3 p{vertices(i, 0), vertices(i, 1), vertices(i, 2)};
-        builder.add_vertex(p);
-      }
-      for (UnsignedInteger i = 0; i < simplices.getSize(); ++ i)
-      {
-        builder.begin_facet();
-        for (UnsignedInteger j = 0; j < dimension; ++ j)
-          builder.add_vertex_to_facet(simplices(i, j));
-        builder.end_facet();
-      }
-      builder.end_surface();
-
-      // we have to check unconnected vertices otherwise older CGAL crashes when converting to Nef_polyhedron
-      if (builder.check_unconnected_vertices())
-      {
-        LOGINFO("ConvexDecompositionMesher detected unconnected vertices, removing");
-        if (!builder.remove_unconnected_vertices())
-          throw InvalidArgumentException(HERE) << "Polyhedron could not remove all unconnected vertices";
-      }
-
-      if (!poly.is_valid(Log::HasDebug()))
-        throw InvalidArgumentException(HERE) << "Polyhedron must be valid";
-
-      if (!poly.is_closed())
-        throw InvalidArgumentException(HERE) << "Polyhedron must be closed";
-
-      nef = Nef_polyhedron(poly);
-
-      if (!nef.is_simple())
-        throw InvalidArgumentException(HERE) <<  "Nef polyhedron is not simple";
+      nef = buildNefFromSurface(vertices, simplices);
     }
     else if (intrinsicDimension == 3)
     {
-      // build from the volumetric mesh
+      // build from the volumetric mesh: for a conforming mesh only the boundary matters,
+      // overlapping tetrahedra give a self-intersecting boundary
+      Collection<Indices> tetrahedra;
       for (UnsignedInteger i = 0; i < simplices.getSize(); ++ i)
+        if (simplicesVolume[i] > smallVolume)
+          tetrahedra.add(Indices(simplices.cbegin_at(i), simplices.cend_at(i)));
+      const IndicesCollection boundary(extractBoundary(vertices, tetrahedra));
+      try
       {
-        if (!(simplicesVolume[i] > smallVolume))
-          continue;
-
-        const UnsignedInteger i1 = simplices(i, 0);
-        const UnsignedInteger i2 = simplices(i, 1);
-        const UnsignedInteger i3 = simplices(i, 2);
-        const UnsignedInteger i4 = simplices(i, 3);
-
-        const Point_3 v1{vertices(i1, 0), vertices(i1, 1), vertices(i1, 2)};
-        const Point_3 v2{vertices(i2, 0), vertices(i2, 1), vertices(i2, 2)};
-        const Point_3 v3{vertices(i3, 0), vertices(i3, 1), vertices(i3, 2)};
-        const Point_3 v4{vertices(i4, 0), vertices(i4, 1), vertices(i4, 2)};
-
-        Polyhedron poly;
-        poly.make_tetrahedron(v1, v2, v3, v4);
-
-        const Nef_polyhedron tetra(poly);
-        nef += tetra;
+        nef = buildNefFromSurface(vertices, boundary, true);
+      }
+      catch (const InvalidArgumentException & exc)
+      {
+        // non-manifold or self-intersecting boundaries cannot be converted directly
+        LOGINFO(OSS() << "ConvexDecompositionMesher could not use the boundary surface (" << exc.what() << "), using a tree reduction");
+        statistics.add("treeReductions", 1.0);
+        nef = buildNefFromTetrahedra(vertices, tetrahedra, monitor);
       }
     }
     else
       throw InvalidArgumentException(HERE) << "ConvexDecompositionMesher expected intrinsic dimension=2|3 got " << intrinsicDimension;
 
-    // Extract convex components
+    nefTimer.stop();
+
+    // Extract convex components, the decomposition itself cannot be interrupted
+    monitor.check();
+    monitor.setPhase("decomposition", 0.4, 0.7);
+    MeshingTimer decompositionTimer(statistics, "decompositionTime");
     CGAL::convex_decomposition_3(nef);
+    decompositionTimer.stop();
 
     // the first volume is the outer volume, which is ignored in the decomposition
+    // the exact shells are converted sequentially, the lazy exact kernel is not thread-safe
+    MeshingTimer conversionTimer(statistics, "conversionTime");
+    monitor.check();
+    monitor.setPhase("conversion", 0.7, 0.9);
+    const UnsignedInteger volumesNumber = nef.number_of_volumes();
+    UnsignedInteger volumeIndex = 0;
+    Collection<Sample> partVertices;
+    Collection<IndicesCollection> partFacets;
     for (auto ci = ++nef.volumes_begin(); ci != nef.volumes_end(); ++ci)
     {
+      monitor.check();
+      monitor.progress(1.0 * (++ volumeIndex) / volumesNumber);
       if (ci->mark())
       {
-        Polyhedron part;
+        PolyhedronWithId part;
         nef.convert_inner_shell_to_polyhedron(ci->shells_begin(), part);
 
         if (part.empty())
           continue;
 
-        CGAL::Polygon_mesh_processing::triangulate_faces(part);
-        
-        Sample verticesI(part.size_of_vertices(), dimension); 
-        std::unordered_map<typename Polyhedron::Vertex_const_handle, UnsignedInteger> vertexToIndexMap;
+        // vertices carry their index
+        Sample verticesI(part.size_of_vertices(), dimension);
         UnsignedInteger vertexIndex = 0;
         for (auto vi = part.vertices_begin(); vi != part.vertices_end(); ++ vi)
         {
-          // typename Polyhedron::Vertex_const_handle vch = vi;
           const Point_3 & p = vi->point();
           for (UnsignedInteger j = 0; j < dimension; ++ j)
             verticesI(vertexIndex, j) = CGAL::to_double(p[j]);
-          vertexToIndexMap[vi] = vertexIndex;
+          vi->id() = vertexIndex;
           ++ vertexIndex;
         }
 
-        // arbitrarily select the apex as the first vertex
-        const UnsignedInteger apexIndex = vertexToIndexMap[part.vertices_begin()];
-
-        // build simplices
-        Collection<Indices> simplexColl;
+        // polygonal facets, as ragged rows of vertex indices
+        Collection<Indices> facetsI;
         for (auto f = part.facets_begin(); f != part.facets_end(); ++f)
         {
+          Indices facet;
           auto h = f->facet_begin();
-          
-          // filter out the facets incident to the apex vertex
-          Bool ok = true;
-          for (UnsignedInteger j = 0; j < dimension + 1; ++ j)
-          {
-            if (vertexToIndexMap[h->vertex()] == apexIndex)
-            {
-              ok = false;
-              break;
-            }
-            ++ h;
-          }
-
-          if (ok)
+          do
           {
-            h = f->facet_begin();
-            Indices simplex(dimension + 1);
-            simplex[0] = apexIndex;
-            for (UnsignedInteger j = 0; j < dimension; ++ j)
-            {
-              simplex[j + 1] = vertexToIndexMap[h->vertex()];
-              ++ h;
-            }
-#if 0
-            // filter out small simplex
-            const Mesh simplexMesh(verticesI, IndicesCollection(Collection<Indices>(1, simplex)));
-            if (!(simplexMesh.getVolume() > SpecFunc::Precision))
-              continue;
-#endif
-            simplexColl.add(simplex);
+            facet.add(h->vertex()->id());
           }
+          while (++ h != f->facet_begin());
+          facetsI.add(facet);
         }
-        result.add(Mesh(verticesI, IndicesCollection(simplexColl)));
+        partVertices.add(verticesI);
+        partFacets.add(IndicesCollection(facetsI));
       }
     } // for nef.volumes
+    conversionTimer.stop();
+
+    // the parts are fanned independently
+    monitor.check();
+    monitor.setPhase("fan", 0.9, 1.0);
+    MeshingTimer fanTimer(statistics, "fanTime");
+    result = Collection<Mesh>(partVertices.getSize());
+    const FanConvexPartPolicy policy(partVertices, partFacets, result);
+    TBBImplementation::ParallelFor(0, partVertices.getSize(), policy);
   } // 3d
   else if (dimension == intrinsicDimension)
   {
-    Indices simplex(dimension + 1);
-    Indices standardSimplex(dimension + 1);
-    standardSimplex.fill();
-    const IndicesCollection uniqueSimplex(1, dimension + 1, standardSimplex);
-    Sample simplexVertices(dimension + 1, dimension);
+    // Skip small simplices
+    Indices kept;
     for (UnsignedInteger simplexIndex = 0; simplexIndex < simplices.getSize(); ++ simplexIndex)
-    {
-      // Skip small simplices
-      if (!(simplicesVolume[simplexIndex] > smallVolume))
-        continue;
-      std::copy(simplices.cbegin_at(simplexIndex), simplices.cend_at(simplexIndex), simplex.begin());
-
-      // Here we should keep the vertices untouched in order to avoid partial copies
-      // but unused vertices throw an exception in the validity check
-      for (UnsignedInteger j = 0; j <= dimension; ++j)
-      {
-        const UnsignedInteger localJ = simplex[j];
-        for (UnsignedInteger k = 0; k < dimension; ++k)
-          simplexVertices(j, k) = vertices(localJ, k);
-      }
-      result.add(Mesh(simplexVertices, uniqueSimplex));
-    }
+      if (simplicesVolume[simplexIndex] > smallVolume)
+        kept.add(simplexIndex);
+    monitor.setPhase("merge", 0.0, 1.0);
+    MeshingTimer mergeTimer(statistics, "mergeTime");
+    result = mergeConvexCells(vertices, simplices, kept, monitor);
   }
   else
     throw InvalidArgumentException(HERE) << "ConvexDecompositionMesher expected dimension=3 and intrinsicDimension = 2|3, or dimension=intrinsicDimension, here got dimension=" << dimension << " and intrinsicDimension=" << intrinsicDimension;
+  statistics.add("piecesProduced", result.getSize());
+  statistics.publish(statistics_);
+  monitor.setPhase("done", 1.0, 1.0);
   return result;
 }
 
+/* Statistics accessor */
+PointWithDescription ConvexDecompositionMesher::getStatistics() const
+{
+  return MeshingStatistics::Read(statistics_);
+}
+
 /* Check if mesh is convex */
 Bool ConvexDecompositionMesher::IsConvex(const Mesh & mesh)
 {
-  CloudMesher mesher;
-  const Scalar vm = mesh.getVolume();
-  const Scalar vc = mesher.build(mesh.getVertices()).getVolume();
-  return (vc > 0.0) && (std::abs((vm - vc) / vc) < std::sqrt(SpecFunc::Precision));
+  const UnsignedInteger dimension = mesh.getDimension();
+  const UnsignedInteger intrinsicDimension = mesh.getIntrinsicDimension();
+  const UnsignedInteger simplicesNumber = mesh.getSimplicesNumber();
+  if (!simplicesNumber || (dimension < 2) || (intrinsicDimension + 1 < dimension))
+    return false;
+  const Sample vertices(mesh.getVertices());
+  const IndicesCollection simplices(mesh.getSimplices());
+  const Bool volumetric = (intrinsicDimension == dimension);
+
+  // boundary facets: the facets of a single simplex for a volume, the simplices themselves for a surface,
+  // the facets of a volume are stored with the opposite vertex, which lies on their inner side
+  std::vector<Indices> boundary;
+  Indices opposite;
+  if (volumetric)
+  {
+    std::unordered_map<Indices, std::pair<UnsignedInteger, UnsignedInteger>, IndicesHash> facetCount;
+    for (UnsignedInteger i = 0; i < simplicesNumber; ++ i)
+      for (UnsignedInteger j = 0; j <= dimension; ++ j)
+      {
+        Indices facet;
+        for (UnsignedInteger l = 0; l <= dimension; ++ l)
+          if (l != j)
+            facet.add(simplices(i, l));
+        std::sort(facet.begin(), facet.end());
+        std::pair<UnsignedInteger, UnsignedInteger> & entry = facetCount[facet];
+        ++ entry.first;
+        entry.second = simplices(i, j);
+      }
+    for (auto it = facetCount.begin(); it != facetCount.end(); ++ it)
+      if (it->second.first == 1)
+      {
+        boundary.push_back(it->first);
+        opposite.add(it->second.second);
+      }
+  }
+  else
+    for (UnsignedInteger i = 0; i < simplicesNumber; ++ i)
+    {
+      // repeated indices mark the lower intrinsic dimension
+      Indices facet(simplices.cbegin_at(i), simplices.cend_at(i));
+      std::sort(facet.begin(), facet.end());
+      facet.erase(std::unique(facet.begin(), facet.end()), facet.end());
+      if (facet.getSize() != dimension)
+        return false;
+      boundary.push_back(facet);
+    }
+  const UnsignedInteger facetsNumber = boundary.size();
+  if (!facetsNumber)
+    return false;
+
+  // the boundary must be closed: each ridge joins exactly two facets,
+  // stored with the position of the vertex removed from each facet
+  std::unordered_map<Indices, Indices, IndicesHash> ridgeToFacets;
+  for (UnsignedInteger f = 0; f < facetsNumber; ++ f)
+    for (UnsignedInteger j = 0; j < dimension; ++ j)
+    {
+      Indices ridge(boundary[f]);
+      ridge.erase(ridge.begin() + j);
+      Indices & entry = ridgeToFacets[ridge];
+      entry.add(f);
+      entry.add(j);
+    }
+  for (auto it = ridgeToFacets.begin(); it != ridgeToFacets.end(); ++ it)
+    if (it->second.getSize() != 4)
+      return false;
+
+  // the boundary must be connected through its ridges; the surface facets are
+  // oriented consistently along the way, the induced orientations of a shared ridge being opposite
+  std::vector<std::vector<std::pair<UnsignedInteger, SignedInteger> > > neighbours(facetsNumber);
+  for (auto it = ridgeToFacets.begin(); it != ridgeToFacets.end(); ++ it)
+  {
+    const UnsignedInteger f = it->second[0];
+    const UnsignedInteger g = it->second[2];
+    const SignedInteger relative = ((it->second[1] + it->second[3]) % 2) ? 1 : -1;
+    neighbours[f].push_back(std::make_pair(g, relative));
+    neighbours[g].push_back(std::make_pair(f, relative));
+  }
+  std::vector<SignedInteger> orientation(facetsNumber, 0);
+  orientation[0] = 1;
+  std::vector<UnsignedInteger> stack(1, 0);
+  UnsignedInteger visitedNumber = 1;
+  while (!stack.empty())
+  {
+    const UnsignedInteger f = stack.back();
+    stack.pop_back();
+    for (UnsignedInteger n = 0; n < neighbours[f].size(); ++ n)
+    {
+      const UnsignedInteger g = neighbours[f][n].first;
+      const SignedInteger expected = orientation[f] * neighbours[f][n].second;
+      if (!orientation[g])
+      {
+        orientation[g] = expected;
+        stack.push_back(g);
+        ++ visitedNumber;
+      }
+      else if (!volumetric && (orientation[g] != expected))
+        // non-orientable surface
+        return false;
+    }
+  }
+  if (visitedNumber != facetsNumber)
+    return false;
+
+  // outward planes of the facets
+  std::vector<Point> normals(facetsNumber);
+  Point offsets(facetsNumber);
+  for (UnsignedInteger f = 0; f < facetsNumber; ++ f)
+  {
+    if (volumetric)
+      computeFacetPlane(vertices, boundary[f], opposite[f], normals[f], offsets[f]);
+    else
+    {
+      computeOrientedFacetPlane(vertices, boundary[f], normals[f], offsets[f]);
+      if (orientation[f] < 0)
+      {
+        normals[f] *= -1.0;
+        offsets[f] = -offsets[f];
+      }
+    }
+  }
+
+  // the boundary vertices must all lie on one side of the first facet, which
+  // rejects the flat meshes and gives the outward orientation of a surface
+  const Scalar tolerance = std::sqrt(SpecFunc::Precision) * vertices.computeRange().norm();
+  Bool below = false;
+  Bool above = false;
+  for (UnsignedInteger f = 0; f < facetsNumber; ++ f)
+    for (UnsignedInteger j = 0; j < dimension; ++ j)
+    {
+      const Scalar distance = normals[0].dot(vertices[boundary[f][j]]) - offsets[0];
+      below = below || (distance < -tolerance);
+      above = above || (distance > tolerance);
+    }
+  if (below == above)
+    return false;
+  if (above)
+  {
+    if (volumetric)
+      return false;
+    for (UnsignedInteger f = 0; f < facetsNumber; ++ f)
+    {
+      normals[f] *= -1.0;
+      offsets[f] = -offsets[f];
+    }
+  }
+
+  // local convexity: across each ridge, the vertex of one facet off the ridge
+  // lies on the inner side of the other facet
+  Scalar turning = 0.0;
+  for (auto it = ridgeToFacets.begin(); it != ridgeToFacets.end(); ++ it)
+  {
+    const UnsignedInteger f = it->second[0];
+    const UnsignedInteger g = it->second[2];
+    const UnsignedInteger apexF = boundary[f][it->second[1]];
+    const UnsignedInteger apexG = boundary[g][it->second[3]];
+    if ((normals[f].dot(vertices[apexG]) - offsets[f] > tolerance) || (normals[g].dot(vertices[apexF]) - offsets[g] > tolerance))
+      return false;
+    if (dimension == 2)
+      turning += std::acos(std::max(-1.0, std::min(1.0, normals[f].dot(normals[g]))));
+  }
+  // a locally convex closed polygon is convex only if it winds once
+  return (dimension != 2) || (turning < 3.0 * M_PI);
+}
+
+/* Cancellation token accessor */
+void ConvexDecompositionMesher::setCancellationToken(const CancellationToken & cancellationToken)
+{
+  cancellationToken_ = cancellationToken;
+}
+
+CancellationToken ConvexDecompositionMesher::getCancellationToken() const
+{
+  return cancellationToken_;
+}
+
+/* Time budget accessor */
+void ConvexDecompositionMesher::setMaximumTimeDuration(const Scalar maximumTimeDuration)
+{
+  maximumTimeDuration_ = maximumTimeDuration;
+}
+
+Scalar ConvexDecompositionMesher::getMaximumTimeDuration() const
+{
+  return maximumTimeDuration_;
+}
+
+/* Progress callback accessor */
+void ConvexDecompositionMesher::setProgressCallback(ProgressCallback callBack, void * state)
+{
+  // the state is not released by the mesher
+  setProgressCallback(callBack, ProgressCallbackState(state, [](void *) {}));
+}
+
+void ConvexDecompositionMesher::setProgressCallback(ProgressCallback callBack, const ProgressCallbackState & state)
+{
+  progressCallback_ = std::pair<ProgressCallback, ProgressCallbackState>(callBack, state);
+}
+
+/* Concavity tolerance accessor */
+void ConvexDecompositionMesher::setConcavityTolerance(const Scalar concavityTolerance)
+{
+  if (!(concavityTolerance >= 0.0))
+    throw InvalidArgumentException(HERE) << "Concavity tolerance must be positive, here concavityTolerance=" << concavityTolerance;
+  concavityTolerance_ = concavityTolerance;
+}
+
+Scalar ConvexDecompositionMesher::getConcavityTolerance() const
+{
+  return concavityTolerance_;
+}
+
+/* Maximum number of parts accessor */
+void ConvexDecompositionMesher::setMaximumPartNumber(const UnsignedInteger maximumPartNumber)
+{
+  maximumPartNumber_ = maximumPartNumber;
+}
+
+UnsignedInteger ConvexDecompositionMesher::getMaximumPartNumber() const
+{
+  return maximumPartNumber_;
 }
 
 /* String converter */
 String ConvexDecompositionMesher::__repr__() const
 {
   OSS oss;
-  oss << "class=" << ConvexDecompositionMesher::GetClassName();
+  oss << "class=" << ConvexDecompositionMesher::GetClassName()
+      << " decompositionMethod=" << decompositionMethod_
+      << " concavityTolerance=" << concavityTolerance_
+      << " maximumPartNumber=" << maximumPartNumber_;
   return oss;
 }
 
@@ -272,12 +1057,18 @@ String ConvexDecompositionMesher::__repr__() const
 void ConvexDecompositionMesher::save(Advocate & adv) const
 {
   PersistentObject::save(adv);
+  adv.saveAttribute("decompositionMethod_", decompositionMethod_);
+  adv.saveAttribute("concavityTolerance_", concavityTolerance_);
+  adv.saveAttribute("maximumPartNumber_", maximumPartNumber_);
 }
 
 /* Method load() reloads the object from the StorageManager */
 void ConvexDecompositionMesher::load(Advocate & adv)
 {
   PersistentObject::load(adv);
+  adv.loadAttribute("decompositionMethod_", decompositionMethod_);
+  adv.loadAttribute("concavityTolerance_", concavityTolerance_);
+  adv.loadAttribute("maximumPartNumber_", maximumPartNumber_);
 }
 
 
@@ -21,6 +21,8 @@
 #include "otmeshing/ConvexHullMesher.hxx"
 #include <openturns/PersistentObjectFactory.hxx>
 
+#include "MeshingStatistics.hxx"
+
 #include <CGAL/Epick_d.h>
 #include <CGAL/Triangulation.h>
 
@@ -55,20 +57,18 @@ ConvexHullMesher * ConvexHullMesher::clone() const
 
 
 template <class TriangulationType>
-Mesh buildConvexHull(const Sample & points)
+Mesh buildConvexHull(const Scalar * data, const UnsignedInteger size, const UnsignedInteger dimension, MeshingStatistics & statistics)
 {
-  const UnsignedInteger dimension = points.getDimension();
-  const UnsignedInteger size = points.getSize();
+  MeshingTimer hullTimer(statistics, "hullTime");
   TriangulationType triangulation(dimension);
   std::vector<typename TriangulationType::Point> pts(size);
   for (UnsignedInteger i = 0; i < size; ++ i)
-  {
-    const Point point(points[i]);
-    pts[i] = typename TriangulationType::Point{dimension, point.begin(), point.end()};
-  }
+    pts[i] = typename TriangulationType::Point{dimension, data + i * dimension, data + (i + 1) * dimension};
   // it is much faster to insert vertices by batch
   triangulation.insert(pts.begin(), pts.end());
+  hullTimer.stop();
 
+  MeshingTimer extractionTimer(statistics, "extractionTime");
   // the vertices are reordered by the triangulation
   std::unordered_map<typename TriangulationType::Vertex_iterator, UnsignedInteger> vertexToIndexMap;
 
@@ -122,25 +122,32 @@ Mesh buildConvexHull(const Sample & points)
       ++ facetIndex;
     }
   }
-
+  statistics.add("facetsProduced", facetNumber);
   return Mesh(vertices, simplices);
 }
 
 
 Mesh ConvexHullMesher::build(const Sample & points) const
 {
-  const UnsignedInteger dimension = points.getDimension();
-  const UnsignedInteger size = points.getSize();
+  return build(points.getImplementation()->data(), points.getSize(), points.getDimension());
+}
+
+/* The points are read in place, row after row, without being copied into a Sample */
+Mesh ConvexHullMesher::build(const Scalar * data, const UnsignedInteger size, const UnsignedInteger dimension) const
+{
   if (!dimension)
     throw InvalidArgumentException(HERE) << "ConvexHullMesher expected a non-null dimension";
   if (size < dimension + 1)
     throw InvalidArgumentException(HERE) << "ConvexHullMesher expected a size of at least " << dimension + 1 << " got " << size;
   Sample vertices(0, dimension);
+  MeshingStatistics statistics;
+  statistics.publish(statistics_);
   if (dimension == 1)
   {
     // special case for dim=1 to avoid special handling in the generic part
-    vertices.add(points.getMin());
-    vertices.add(points.getMax());
+    const std::pair<const Scalar *, const Scalar *> bounds(std::minmax_element(data, data + size));
+    vertices.add(Point(1, *bounds.first));
+    vertices.add(Point(1, *bounds.second));
     IndicesCollection simplices(1, dimension + 1);
     simplices(0, 1) = 1;
     return Mesh(vertices, simplices);
@@ -154,9 +161,10 @@ Mesh ConvexHullMesher::build(const Sample & points) const
   qh_zero(qh, stderr);
 
   // Run Qhull
+  MeshingTimer hullTimer(statistics, "hullTime");
   const String qhull_cmd("qhull Qt Qx"); // options: triangulated output + deterministic output
   int rc = qh_new_qhull(qh, dimension, size,
-                        const_cast<Scalar*>(points.getImplementation()->data()),
+                        const_cast<Scalar*>(data),
                         False, /* ismalloc */
                         const_cast<char*>(qhull_cmd.c_str()),
                         NULL, NULL);
@@ -166,8 +174,10 @@ Mesh ConvexHullMesher::build(const Sample & points) const
     qh_freeqhull(qh, !qh_ALL);
     throw InternalException(HERE) << "qh_new_qhull exit code: " << rc;
   }
+  hullTimer.stop();
 
   // build the vertices
+  MeshingTimer extractionTimer(statistics, "extractionTime");
   Indices inputIndexToHullIndex(size, size);
   vertexT *vertex = NULL, **vertexp = NULL;
   UnsignedInteger i = 0;
@@ -217,12 +227,23 @@ Mesh ConvexHullMesher::build(const Sample & points) const
   if (curlong || totlong)
     throw InternalException(HERE) << "qh_memfreeshort: did not free " << totlong <<" bytes (" << curlong << " blocks)";
 
+  statistics.add("facetsProduced", simplexColl.getSize());
+  extractionTimer.stop();
+  statistics.publish(statistics_);
   return Mesh(vertices, IndicesCollection(simplexColl));
 #else
-  return buildConvexHull<DefaultTriangulation>(points);
+  const Mesh result(buildConvexHull<DefaultTriangulation>(data, size, dimension, statistics));
+  statistics.publish(statistics_);
+  return result;
 #endif
 }
 
+/* Statistics accessor */
+PointWithDescription ConvexHullMesher::getStatistics() const
+{
+  return MeshingStatistics::Read(statistics_);
+}
+
 /* String converter */
 String ConvexHullMesher::__repr__() const
 {
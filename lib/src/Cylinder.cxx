@@ -19,7 +19,10 @@
  *
  */
 #include <openturns/PersistentObjectFactory.hxx>
-#include <openturns/IntervalMesher.hxx>
+#include <openturns/TBBImplementation.hxx>
+#include <openturns/SpecFunc.hxx>
+
+#include <mutex>
 
 #include "otmeshing/Cylinder.hxx"
 
@@ -28,13 +31,145 @@ using namespace OT;
 namespace OTMESHING
 {
 
+/* Distance queries on the base, the trees are built by the first query of any copy */
+class CylinderBaseDomain
+{
+public:
+  MeshDomain2 get(const Mesh & base)
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!built_)
+    {
+      domain_ = MeshDomain2(base);
+      built_ = true;
+    }
+    return domain_;
+  }
+
+private:
+  std::mutex mutex_;
+  Bool built_ = false;
+  MeshDomain2 domain_;
+};
+
+/* Product vertices, the extension grid index runs fastest */
+struct CylinderVerticesPolicy
+{
+  const Sample & baseVertices_;
+  const Point & lowerBound_;
+  const Point & upperBound_;
+  const Indices & injection_;
+  const Indices & complement_;
+  const UnsignedInteger discretization_;
+  const UnsignedInteger gridSize_;
+  Scalar * verticesOut_;
+
+  CylinderVerticesPolicy(const Sample & baseVertices,
+                         const Point & lowerBound,
+                         const Point & upperBound,
+                         const Indices & injection,
+                         const Indices & complement,
+                         const UnsignedInteger discretization,
+                         const UnsignedInteger gridSize,
+                         Scalar * verticesOut)
+    : baseVertices_(baseVertices)
+    , lowerBound_(lowerBound)
+    , upperBound_(upperBound)
+    , injection_(injection)
+    , complement_(complement)
+    , discretization_(discretization)
+    , gridSize_(gridSize)
+    , verticesOut_(verticesOut)
+  {}
+
+  inline void operator()(const TBBImplementation::BlockedRange<UnsignedInteger> & r) const
+  {
+    const UnsignedInteger baseDimension = complement_.getSize();
+    const UnsignedInteger extensionDimension = injection_.getSize();
+    const UnsignedInteger dimension = baseDimension + extensionDimension;
+    for (UnsignedInteger i = r.begin(); i != r.end(); ++ i)
+      for (UnsignedInteger g = 0; g < gridSize_; ++ g)
+      {
+        Scalar * vertex = verticesOut_ + (i * gridSize_ + g) * dimension;
+        for (UnsignedInteger j = 0; j < baseDimension; ++ j)
+          vertex[complement_[j]] = baseVertices_(i, j);
+        UnsignedInteger code = g;
+        for (UnsignedInteger j = 0; j < extensionDimension; ++ j)
+        {
+          const UnsignedInteger step = code % (discretization_ + 1);
+          code /= (discretization_ + 1);
+          vertex[injection_[j]] = lowerBound_[j] + (upperBound_[j] - lowerBound_[j]) * step / discretization_;
+        }
+      }
+  }
+}; /* end struct CylinderVerticesPolicy */
+
+/* Product simplices of the base simplices and the Kuhn simplices of the grid cells */
+struct CylinderSimplicesPolicy
+{
+  const IndicesCollection & baseSimplices_;
+  const Collection<Indices> & cellSimplices_;
+  const Collection<Indices> & paths_;
+  const UnsignedInteger gridSize_;
+  const UnsignedInteger simplexSize_;
+  UnsignedInteger * simplicesOut_;
+
+  CylinderSimplicesPolicy(const IndicesCollection & baseSimplices,
+                          const Collection<Indices> & cellSimplices,
+                          const Collection<Indices> & paths,
+                          const UnsignedInteger gridSize,
+                          const UnsignedInteger simplexSize,
+                          UnsignedInteger * simplicesOut)
+    : baseSimplices_(baseSimplices)
+    , cellSimplices_(cellSimplices)
+    , paths_(paths)
+    , gridSize_(gridSize)
+    , simplexSize_(simplexSize)
+    , simplicesOut_(simplicesOut)
+  {}
+
+  inline void operator()(const TBBImplementation::BlockedRange<UnsignedInteger> & r) const
+  {
+    const UnsignedInteger productNumber = cellSimplices_.getSize() * paths_.getSize();
+    for (UnsignedInteger i = r.begin(); i != r.end(); ++ i)
+    {
+      // a global vertex order on both factors makes the staircase triangulation conforming
+      Indices base(baseSimplices_.cbegin_at(i), baseSimplices_.cend_at(i));
+      std::sort(base.begin(), base.end());
+      UnsignedInteger * out = simplicesOut_ + i * productNumber * simplexSize_;
+      for (UnsignedInteger c = 0; c < cellSimplices_.getSize(); ++ c)
+      {
+        const Indices & cellSimplex = cellSimplices_[c];
+        for (UnsignedInteger p = 0; p < paths_.getSize(); ++ p)
+        {
+          // the path alternates steps in the base simplex (even codes) and in the cell simplex (odd codes)
+          const Indices & path = paths_[p];
+          UnsignedInteger ib = 0;
+          UnsignedInteger ic = 0;
+          out[0] = base[0] * gridSize_ + cellSimplex[0];
+          for (UnsignedInteger k = 0; k < path.getSize(); ++ k)
+          {
+            if (path[k])
+              ++ ic;
+            else
+              ++ ib;
+            out[k + 1] = base[ib] * gridSize_ + cellSimplex[ic];
+          }
+          out += simplexSize_;
+        }
+      }
+    }
+  }
+}; /* end struct CylinderSimplicesPolicy */
+
 CLASSNAMEINIT(Cylinder)
 static const Factory<Cylinder> Factory_Cylinder;
 
 
 /* Default constructor */
 Cylinder::Cylinder()
-  : PersistentObject()
+  : DomainImplementation()
+  , baseDomain_(new CylinderBaseDomain)
 {
   // Nothing to do
 }
@@ -44,7 +179,7 @@ Cylinder::Cylinder(const Mesh & base,
            const Interval & extension,
            const Indices & injection,
            const UnsignedInteger discretization)
-: PersistentObject()
+: DomainImplementation(base.getDimension() + extension.getDimension())
 , base_(base)
 , extension_(extension)
 , injection_(injection)
@@ -57,10 +192,16 @@ void Cylinder::initialize()
 {
   baseDimension_ = base_.getDimension();
   extensionDimension_ = extension_.getDimension();
-  dimension_ = baseDimension_ + extensionDimension_;
   complement_ = injection_.complement(dimension_);
   if (injection_.getSize() != extension_.getDimension())
     throw InvalidArgumentException(HERE) << "The injection indices size must be equal to the extension dimension.";
+  baseDomain_ = new CylinderBaseDomain;
+}
+
+/* Distance queries on the base, built on the first query */
+MeshDomain2 Cylinder::getBaseDomain() const
+{
+  return baseDomain_->get(base_);
 }
 
 /* Virtual constructor */
@@ -96,18 +237,104 @@ Point Cylinder::combine(const Point & pBase, const Point & pExtension) const
 /* Vertices accessor */
 Sample Cylinder::getVertices() const
 {
-  const Indices discretization(extension_.getDimension(), discretization_);
+  if (!discretization_)
+    throw InvalidArgumentException(HERE) << "Cylinder expected a positive discretization";
   const Sample baseVertices(base_.getVertices());
-  const Sample extensionVertices(IntervalMesher(discretization).build(extension_).getVertices());
-  Sample vertices(baseVertices.getSize() * extensionVertices.getSize(), dimension_);
-  UnsignedInteger index = 0;
-  for (UnsignedInteger i1 = 0; i1 < baseVertices.getSize(); ++ i1)
-    for (UnsignedInteger i2 = 0; i2 < extensionVertices.getSize(); ++ i2)
+  UnsignedInteger gridSize = 1;
+  for (UnsignedInteger j = 0; j < extensionDimension_; ++ j)
+    gridSize *= discretization_ + 1;
+  Sample vertices(baseVertices.getSize() * gridSize, dimension_);
+  if (vertices.getSize())
+  {
+    const Point lowerBound(extension_.getLowerBound());
+    const Point upperBound(extension_.getUpperBound());
+    const CylinderVerticesPolicy policy(baseVertices, lowerBound, upperBound, injection_, complement_, discretization_, gridSize, &vertices(0, 0));
+    TBBImplementation::ParallelFor(0, baseVertices.getSize(), policy);
+  }
+  return vertices;
+}
+
+/* Product mesh accessor */
+Mesh Cylinder::getMesh() const
+{
+  const Sample vertices(getVertices());
+  const UnsignedInteger baseDimension = base_.getIntrinsicDimension();
+  UnsignedInteger gridSize = 1;
+  UnsignedInteger cellsNumber = 1;
+  Indices stride(extensionDimension_);
+  for (UnsignedInteger j = 0; j < extensionDimension_; ++ j)
+  {
+    stride[j] = gridSize;
+    gridSize *= discretization_ + 1;
+    cellsNumber *= discretization_;
+  }
+
+  // Kuhn triangulation of the grid cells, one simplex per permutation of the axes
+  Collection<Indices> cellSimplices;
+  for (UnsignedInteger c = 0; c < cellsNumber; ++ c)
+  {
+    UnsignedInteger corner = 0;
+    UnsignedInteger code = c;
+    for (UnsignedInteger j = 0; j < extensionDimension_; ++ j)
     {
-      vertices[index] = combine(baseVertices[i1], extensionVertices[i2]);
-      ++ index;
+      corner += (code % discretization_) * stride[j];
+      code /= discretization_;
     }
-  return vertices;
+    Indices permutation(extensionDimension_);
+    permutation.fill();
+    do
+    {
+      Indices cellSimplex(1, corner);
+      for (UnsignedInteger j = 0; j < extensionDimension_; ++ j)
+        cellSimplex.add(cellSimplex[j] + stride[permutation[j]]);
+      cellSimplices.add(cellSimplex);
+    }
+    while (std::next_permutation(permutation.begin(), permutation.end()));
+  }
+
+  // monotone lattice paths of the staircase triangulation of simplex x simplex
+  Collection<Indices> paths;
+  const UnsignedInteger stepsNumber = baseDimension + extensionDimension_;
+  for (UnsignedInteger mask = 0; mask < (static_cast<UnsignedInteger>(1) << stepsNumber); ++ mask)
+  {
+    Indices path(stepsNumber);
+    UnsignedInteger extensionSteps = 0;
+    for (UnsignedInteger k = 0; k < stepsNumber; ++ k)
+    {
+      path[k] = (mask >> k) & 1;
+      extensionSteps += path[k];
+    }
+    if (extensionSteps == extensionDimension_)
+      paths.add(path);
+  }
+
+  // the base simplices are restricted to their distinct vertices
+  const IndicesCollection baseSimplicesFull(base_.getSimplices());
+  const UnsignedInteger baseSimplicesNumber = baseSimplicesFull.getSize();
+  IndicesCollection baseSimplices(baseSimplicesNumber, baseDimension + 1);
+  for (UnsignedInteger i = 0; i < baseSimplicesNumber; ++ i)
+    std::copy(baseSimplicesFull.cbegin_at(i), baseSimplicesFull.cbegin_at(i) + baseDimension + 1, baseSimplices.begin_at(i));
+
+  const UnsignedInteger simplexSize = dimension_ + 1;
+  const UnsignedInteger productNumber = cellSimplices.getSize() * paths.getSize();
+  IndicesCollection simplices(baseSimplicesNumber * productNumber, simplexSize);
+  if (simplices.getSize())
+  {
+    // a lower intrinsic dimension of the base is marked by repeating the last index
+    const UnsignedInteger productSize = stepsNumber + 1;
+    IndicesCollection product(baseSimplicesNumber * productNumber, productSize);
+    const CylinderSimplicesPolicy policy(baseSimplices, cellSimplices, paths, gridSize, productSize, &product(0, 0));
+    TBBImplementation::ParallelFor(0, baseSimplicesNumber, policy);
+    if (productSize == simplexSize)
+      simplices = product;
+    else
+      for (UnsignedInteger i = 0; i < simplices.getSize(); ++ i)
+      {
+        std::copy(product.cbegin_at(i), product.cend_at(i), simplices.begin_at(i));
+        std::fill(simplices.begin_at(i) + productSize, simplices.end_at(i), product(i, productSize - 1));
+      }
+  }
+  return Mesh(vertices, simplices);
 }
 
 /* BBox accessor */
@@ -123,10 +350,76 @@ Scalar Cylinder::getVolume() const
   return base_.getVolume() * extension_.getVolume();
 }
 
+/* Check if the given points are inside of the domain */
+Bool Cylinder::contains(const Point & point) const
+{
+  return contains(Sample(1, point))[0];
+}
+
+Cylinder::BoolCollection Cylinder::contains(const Sample & sample) const
+{
+  if (sample.getDimension() != dimension_)
+    throw InvalidArgumentException(HERE) << "Expected a sample of dimension " << dimension_ << " got " << sample.getDimension();
+  const UnsignedInteger size = sample.getSize();
+  const BoolCollection insideBase(getBaseDomain().contains(sample.getMarginal(complement_)));
+  const Point lowerBound(extension_.getLowerBound());
+  const Point upperBound(extension_.getUpperBound());
+  BoolCollection inside(size);
+  for (UnsignedInteger i = 0; i < size; ++ i)
+  {
+    Bool insideI = insideBase[i];
+    for (UnsignedInteger j = 0; (j < extensionDimension_) && insideI; ++ j)
+      insideI = (sample(i, injection_[j]) >= lowerBound[j]) && (sample(i, injection_[j]) <= upperBound[j]);
+    inside[i] = insideI;
+  }
+  return inside;
+}
+
+/* Compute the signed Euclidean distance from given points to the domain */
+Scalar Cylinder::computeDistance(const Point & point) const
+{
+  return computeDistance(Sample(1, point))(0, 0);
+}
+
+Sample Cylinder::computeDistance(const Sample & sample) const
+{
+  if (sample.getDimension() != dimension_)
+    throw InvalidArgumentException(HERE) << "Expected a sample of dimension " << dimension_ << " got " << sample.getDimension();
+  const UnsignedInteger size = sample.getSize();
+  const Sample baseDistance(getBaseDomain().computeDistance(sample.getMarginal(complement_)));
+  const Point lowerBound(extension_.getLowerBound());
+  const Point upperBound(extension_.getUpperBound());
+  Sample distance(size, 1);
+  for (UnsignedInteger i = 0; i < size; ++ i)
+  {
+    // signed distance to the box of the extension
+    Scalar outside2 = 0.0;
+    Scalar inside = -SpecFunc::MaxScalar;
+    for (UnsignedInteger j = 0; j < extensionDimension_; ++ j)
+    {
+      const Scalar x = sample(i, injection_[j]);
+      const Scalar q = std::max(lowerBound[j] - x, x - upperBound[j]);
+      if (q > 0.0)
+        outside2 += q * q;
+      inside = std::max(inside, q);
+    }
+    const Scalar extensionDistance = (outside2 > 0.0) ? std::sqrt(outside2) : inside;
+
+    // the signed distance to a product combines the signed distances to the factors
+    const Scalar dB = baseDistance(i, 0);
+    const Scalar dE = extensionDistance;
+    if ((dB > 0.0) && (dE > 0.0))
+      distance(i, 0) = std::sqrt(dB * dB + dE * dE);
+    else
+      distance(i, 0) = std::max(dB, dE);
+  }
+  return distance;
+}
+
 /* Method save() stores the object through the StorageManager */
 void Cylinder::save(Advocate & adv) const
 {
-  PersistentObject::save(adv);
+  DomainImplementation::save(adv);
   adv.saveAttribute("base_", base_);
   adv.saveAttribute("extension_", extension_);
   adv.saveAttribute("injection_", injection_);
@@ -136,7 +429,7 @@ void Cylinder::save(Advocate & adv) const
 /* Method load() reloads the object from the StorageManager */
 void Cylinder::load(Advocate & adv)
 {
-  PersistentObject::load(adv);
+  DomainImplementation::load(adv);
   adv.loadAttribute("base_", base_);
   adv.loadAttribute("extension_", extension_);
   adv.loadAttribute("injection_", injection_);
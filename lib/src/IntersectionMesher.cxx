@@ -21,15 +21,18 @@
 #include <openturns/PersistentObjectFactory.hxx>
 #include <openturns/SpecFunc.hxx>
 
+#include <deque>
+#include <map>
+
 #include "otmeshing/IntersectionMesher.hxx"
 #include "otmeshing/CloudMesher.hxx"
 #include "otmeshing/ConvexDecompositionMesher.hxx"
 #include "otmeshing/UnionMesher.hxx"
 
-#ifdef OPENTURNS_HAVE_CDDLIB
-#include <setoper.h>
-#include <cdd.h>
-#endif
+#include "CddUtilities.hxx"
+#include "MeshingMonitor.hxx"
+#include "MeshingStatistics.hxx"
+#include "VertexGrid.hxx"
 
 using namespace OT;
 
@@ -69,11 +72,14 @@ String IntersectionMesher::__str__(const String & ) const
 
 Mesh IntersectionMesher::build(const Collection<Mesh> & coll) const
 {
+  // the pairwise intersections accumulate onto this record
+  MeshingStatistics statistics;
   const UnsignedInteger size = coll.getSize();
-  if (size == 0)
-    return Mesh(Sample(0, 0));
-  else if (size == 1)
-    return coll[0];
+  if (size < 2)
+  {
+    statistics.publish(statistics_);
+    return size ? coll[0] : Mesh(Sample(0, 0));
+  }
 
   const UnsignedInteger dimension = coll[0].getDimension();
   if ((coll.getSize() == 2) && (dimension == 3000000)) // TODO: enable this
@@ -88,7 +94,7 @@ Mesh IntersectionMesher::build(const Collection<Mesh> & coll) const
       for (UnsignedInteger i2 = 0; i2 < decomposition2.getSize(); ++ i2)
       {
         // TODO: parallelize ?
-        const Mesh intersection12(buildConvex(Collection<Mesh>({decomposition1[i1], decomposition2[i2]})));
+        const Mesh intersection12(buildConvex(Collection<Mesh>({decomposition1[i1], decomposition2[i2]}), statistics));
         if (intersection12.getSimplicesNumber() == 0)
           continue;
 
@@ -104,16 +110,32 @@ Mesh IntersectionMesher::build(const Collection<Mesh> & coll) const
     Mesh result(vertices, IndicesCollection(simplexColl));
     if (recompress_)
       result = UnionMesher::CompressMesh(result);
+    statistics.publish(statistics_);
     return result;
   } // dim=3
 
+  MeshingMonitor monitor("IntersectionMesher", cancellationToken_, maximumTimeDuration_, progressCallback_.first, progressCallback_.second);
+  // each reduction level gets the same share of the progress
+  UnsignedInteger totalLevelsNumber = 0;
+  for (UnsignedInteger n = size; n > 1; n = (n + 1) / 2)
+    ++ totalLevelsNumber;
+
   Collection<Mesh> todo(coll);
+  UnsignedInteger levelsNumber = 0;
   while (todo.getSize() > 1)
   {
+    ++ levelsNumber;
     Collection<Mesh> done(todo.getSize() / 2);
+    const UnsignedInteger pairsNumber = todo.getSize() / 2;
     // TODO: parallelize ?
-    for (UnsignedInteger i = 0; i < todo.getSize() / 2; ++ i)
-      done[i] = build2(todo[2 * i], todo[2 * i + 1]);
+    for (UnsignedInteger i = 0; i < pairsNumber; ++ i)
+    {
+      monitor.check();
+      const Scalar start = (levelsNumber - 1.0 + 1.0 * i / pairsNumber) / totalLevelsNumber;
+      const Scalar end = (levelsNumber - 1.0 + (i + 1.0) / pairsNumber) / totalLevelsNumber;
+      monitor.setPhase("intersection", start, end);
+      done[i] = build2(todo[2 * i], todo[2 * i + 1], monitor, statistics);
+    }
 
     // report odd element
     if (todo.getSize() % 2)
@@ -121,57 +143,167 @@ Mesh IntersectionMesher::build(const Collection<Mesh> & coll) const
 
     todo = done;
   }
+  statistics.add("reductionLevels", levelsNumber);
+  statistics.publish(statistics_);
+  monitor.setPhase("done", 1.0, 1.0);
   return todo[0];
 }
 
 #ifdef OPENTURNS_HAVE_CDDLIB
-String cdd_error_to_string(const dd_ErrorType err)
+/* Merge adjacent convex pieces whenever their union is convex and needs no more simplices */
+Collection<Mesh> compactPieces(const Collection<Mesh> & pieces, const UnsignedInteger dimension)
 {
-  switch (err)
+  const UnsignedInteger size = pieces.getSize();
+  if (size < 2)
+    return pieces;
+
+  // all the vertices in one block, the coinciding vertices of the pieces share a class
+  Indices offset(size + 1);
+  for (UnsignedInteger i = 0; i < size; ++ i)
+    offset[i + 1] = offset[i] + pieces[i].getVerticesNumber();
+  const UnsignedInteger verticesNumber = offset[size];
+  Sample allVertices(0, dimension);
+  for (UnsignedInteger i = 0; i < size; ++ i)
+    allVertices.add(pieces[i].getVertices());
+  const Scalar tolerance = std::sqrt(SpecFunc::Precision) * allVertices.computeRange().norm();
+  const Scalar * data = allVertices.getImplementation()->data();
+  const VertexGrid grid(data, verticesNumber, dimension, tolerance);
+  // the class of a point is the first vertex within tolerance along each component, verticesNumber if none
+  const auto classOf = [&](const Scalar * x)
   {
-    case dd_DimensionTooLarge:
-      return "Dimension too large";
-    case dd_ImproperInputFormat:
-      return "Improper input format";
-    case dd_NegativeMatrixSize:
-      return "Negative matrix size";
-    case dd_EmptyVrepresentation:
-      return "Empty V-representation";
-    case dd_EmptyHrepresentation:
-      return "Empty H-representation";
-    case dd_EmptyRepresentation:
-      return "Empty representation";
-    case dd_IFileNotFound:
-      return "Input file not found";
-    case dd_OFileNotOpen:
-      return "Output file not open";
-    case dd_NoLPObjective:
-      return "No LP objective specified";
-    case dd_NoRealNumberSupport:
-      return "No real number support (library built without GMP?)";
-    case dd_NotAvailForH:
-      return "Operation not available for H-representation";
-    case dd_NotAvailForV:
-      return "Operation not available for V-representation";
-    case dd_CannotHandleLinearity:
-      return "Cannot handle linearity in this context";
-    case dd_RowIndexOutOfRange:
-      return "Row index out of range";
-    case dd_ColIndexOutOfRange:
-      return "Column index out of range";
-    case dd_LPCycling:
-      return "LP cycling detected";
-    case dd_NumericallyInconsistent:
-      return "Numerical inconsistency detected";
-    case dd_NoError:
-      return "No error";
-    default:
-        return "Unknown cddlib error";
+    UnsignedInteger best = verticesNumber;
+    grid.visit(x, [&](const UnsignedInteger j)
+    {
+      if (j >= best)
+        return false;
+      for (UnsignedInteger k = 0; k < dimension; ++ k)
+        if (std::abs(data[j * dimension + k] - x[k]) > tolerance)
+          return false;
+      best = j;
+      return false;
+    });
+    return best;
+  };
+
+  Collection<Mesh> merged(pieces);
+  Collection<Sample> vertices(size);
+  Collection<Indices> vertexClasses(size);
+  Collection<Indices> classes(size);
+  std::vector<std::vector<UnsignedInteger> > classPieces(verticesNumber);
+  Point volume(size);
+  Indices alive(size, 1);
+  Indices version(size);
+  const auto setClasses = [&](const UnsignedInteger i)
+  {
+    const UnsignedInteger verticesNumberI = vertices[i].getSize();
+    vertexClasses[i] = Indices(verticesNumberI);
+    classes[i] = Indices();
+    for (UnsignedInteger j = 0; j < verticesNumberI; ++ j)
+    {
+      vertexClasses[i][j] = classOf(vertices[i].getImplementation()->data() + j * dimension);
+      if (vertexClasses[i][j] < verticesNumber)
+        classes[i].add(vertexClasses[i][j]);
+    }
+    std::sort(classes[i].begin(), classes[i].end());
+    classes[i].erase(std::unique(classes[i].begin(), classes[i].end()), classes[i].end());
+    for (const UnsignedInteger c : classes[i])
+      classPieces[c].push_back(i);
+  };
+  const auto unsetClasses = [&](const UnsignedInteger i)
+  {
+    for (const UnsignedInteger c : classes[i])
+      classPieces[c].erase(std::remove(classPieces[c].begin(), classPieces[c].end(), i), classPieces[c].end());
+  };
+  for (UnsignedInteger i = 0; i < size; ++ i)
+  {
+    vertices[i] = pieces[i].getVertices();
+    volume[i] = pieces[i].getVolume();
+    setClasses(i);
+  }
+
+  // a piece is dirty until all its neighbours were tested since its last change,
+  // a rejected pair is only tested again when one of its pieces changed
+  CloudMesher cloudMesher(CloudMesher::BASIC);
+  std::map<std::pair<UnsignedInteger, UnsignedInteger>, std::pair<UnsignedInteger, UnsignedInteger> > rejected;
+  std::deque<UnsignedInteger> dirty;
+  for (UnsignedInteger i = 0; i < size; ++ i)
+    dirty.push_back(i);
+  while (!dirty.empty())
+  {
+    const UnsignedInteger a = dirty.front();
+    dirty.pop_front();
+    if (!alive[a])
+      continue;
+
+    // adjacent pieces share at least a facet, ie dimension vertices, the other ones need no hull
+    std::map<UnsignedInteger, UnsignedInteger> sharedNumber;
+    for (const UnsignedInteger c : classes[a])
+      for (const UnsignedInteger p : classPieces[c])
+        if (p != a)
+          ++ sharedNumber[p];
+    for (const std::pair<const UnsignedInteger, UnsignedInteger> & neighbour : sharedNumber)
+    {
+      const UnsignedInteger b = neighbour.first;
+      if (neighbour.second < dimension)
+        continue;
+      const std::pair<UnsignedInteger, UnsignedInteger> pair(std::min(a, b), std::max(a, b));
+      const std::pair<UnsignedInteger, UnsignedInteger> versions(version[pair.first], version[pair.second]);
+      const auto it = rejected.find(pair);
+      if ((it != rejected.end()) && (it->second == versions))
+        continue;
+
+      // the union is convex iff its hull has the same volume as the pieces
+      Sample unionVertices(vertices[a]);
+      for (UnsignedInteger jb = 0; jb < vertices[b].getSize(); ++ jb)
+        if ((vertexClasses[b][jb] == verticesNumber) || !std::binary_search(classes[a].begin(), classes[a].end(), vertexClasses[b][jb]))
+          unionVertices.add(vertices[b][jb]);
+      const Sample extremePoints(computeExtremePoints(unionVertices));
+      Bool accepted = extremePoints.getSize() >= dimension + 1;
+      Mesh hull;
+      if (accepted)
+      {
+        if (extremePoints.getSize() == dimension + 1)
+        {
+          Indices simplex(dimension + 1);
+          simplex.fill(); // orientation may be incorrect
+          hull = Mesh(extremePoints, IndicesCollection(Collection<Indices>(1, simplex)));
+        }
+        else
+          hull = cloudMesher.build(extremePoints);
+        const Scalar unionVolume = volume[a] + volume[b];
+        // merging never increases the number of simplices
+        accepted = (std::abs(hull.getVolume() - unionVolume) <= std::sqrt(SpecFunc::Precision) * unionVolume)
+                   && (hull.getSimplicesNumber() <= merged[a].getSimplicesNumber() + merged[b].getSimplicesNumber());
+      }
+      if (!accepted)
+      {
+        rejected[pair] = versions;
+        continue;
+      }
+
+      // merge b into a, then search the neighbours of the new a
+      unsetClasses(a);
+      unsetClasses(b);
+      merged[a] = hull;
+      vertices[a] = extremePoints;
+      volume[a] = hull.getVolume();
+      setClasses(a);
+      alive[b] = 0;
+      ++ version[a];
+      dirty.push_back(a);
+      break;
+    }
   }
+
+  Collection<Mesh> result;
+  for (UnsignedInteger i = 0; i < size; ++ i)
+    if (alive[i])
+      result.add(merged[i]);
+  return result;
 }
 #endif
 
-Mesh IntersectionMesher::build2(const Mesh & mesh1, const Mesh & mesh2) const
+Mesh IntersectionMesher::build2(const Mesh & mesh1, const Mesh & mesh2, MeshingMonitor & monitor, MeshingStatistics & statistics) const
 {
   const UnsignedInteger dimension = mesh1.getDimension();
   if (mesh2.getDimension() != dimension)
@@ -187,16 +319,19 @@ Mesh IntersectionMesher::build2(const Mesh & mesh1, const Mesh & mesh2) const
 
   CloudMesher cloudMesher;
   Collection<Mesh> intersectionColl;
+  UnsignedInteger testedNumber = 0;
+  UnsignedInteger prunedNumber = 0;
+  UnsignedInteger cddCallsNumber = 0;
 
   // initialize cddlib
   dd_ErrorType err = dd_NoError;
-  dd_set_global_constants();
+  const CddGlobalConstants cddConstants;
 
-  // allocate V-representation
-  dd_MatrixPtr m1 = dd_CreateMatrix(dimension + 1, dimension + 1);
-  dd_SetMatrixRepresentationType(m1, dd_Generator);
-  dd_MatrixPtr m2 = dd_CreateMatrix(dimension + 1, dimension + 1);
-  dd_SetMatrixRepresentationType(m2, dd_Generator);
+  // allocate V-representation, the guards release the cddlib objects on every exit
+  const CddMatrix m1(dd_CreateMatrix(dimension + 1, dimension + 1));
+  dd_SetMatrixRepresentationType(m1.get(), dd_Generator);
+  const CddMatrix m2(dd_CreateMatrix(dimension + 1, dimension + 1));
+  dd_SetMatrixRepresentationType(m2.get(), dd_Generator);
   for (UnsignedInteger j = 0; j <= dimension; ++ j)
   {
     // homogeneous coordinate
@@ -207,6 +342,9 @@ Mesh IntersectionMesher::build2(const Mesh & mesh1, const Mesh & mesh2) const
   // mesh1 simplices loop
   for (UnsignedInteger i1 = 0; i1 < ns1; ++ i1)
   {
+    monitor.check();
+    monitor.progress(0.8 * i1 / ns1);
+
     Point lower1(dimension, SpecFunc::Infinity);
     Point upper1(dimension, -SpecFunc::Infinity);
     // build V-representation of simplex
@@ -220,12 +358,19 @@ Mesh IntersectionMesher::build2(const Mesh & mesh1, const Mesh & mesh2) const
         upper1[k] = std::max(upper1[k], vertices1(vi1j, k));
       }
     }
-    dd_PolyhedraPtr p1 = dd_DDMatrix2Poly(m1, &err);
-    if (err != dd_NoError)
-      throw InternalException(HERE) << "dd_DDMatrix2Poly failed i1=" << i1 << ": " << cdd_error_to_string(err);
+    MeshingTimer cddTimer1(statistics, "cddTime");
+    CddMatrix h1;
+    {
+      const CddLock cddLock;
+      const CddPolyhedra p1(dd_DDMatrix2Poly(m1.get(), &err));
+      ++ cddCallsNumber;
+      if (err != dd_NoError)
+        throw InternalException(HERE) << "dd_DDMatrix2Poly failed i1=" << i1 << ": " << cdd_error_to_string(err);
 
-    // Convert V-representation to H-representation (inequalities)
-    dd_MatrixPtr h1 = dd_CopyInequalities(p1);
+      // Convert V-representation to H-representation (inequalities)
+      h1.reset(dd_CopyInequalities(p1.get()));
+    }
+    cddTimer1.stop();
 
     // mesh2 simplices loop
     for (UnsignedInteger i2 = 0; i2 < ns2; ++ i2)
@@ -243,6 +388,7 @@ Mesh IntersectionMesher::build2(const Mesh & mesh1, const Mesh & mesh2) const
           upper2[k] = std::max(upper2[k], vertices2(vi2j, k));
         }
       }
+      ++ testedNumber;
       Bool toSkip = false;
       for (UnsignedInteger k = 0; k < dimension; ++ k)
       {
@@ -251,29 +397,43 @@ Mesh IntersectionMesher::build2(const Mesh & mesh1, const Mesh & mesh2) const
           break;
       }
       if (toSkip)
+      {
+        ++ prunedNumber;
         continue;
+      }
 
-      dd_PolyhedraPtr p2 = dd_DDMatrix2Poly(m2, &err);
-      if (err != dd_NoError)
-        throw InternalException(HERE) << "dd_DDMatrix2Poly failed i2=" << i2 << ": " << cdd_error_to_string(err);
+      MeshingTimer cddTimer2(statistics, "cddTime");
+      CddMatrix h2;
+      {
+        const CddLock cddLock;
+        const CddPolyhedra p2(dd_DDMatrix2Poly(m2.get(), &err));
+        if (err != dd_NoError)
+          throw InternalException(HERE) << "dd_DDMatrix2Poly failed i2=" << i2 << ": " << cdd_error_to_string(err);
 
-      // Convert V-representation to H-representation (inequalities)
-      dd_MatrixPtr h2 = dd_CopyInequalities(p2);
-      dd_FreePolyhedra(p2);
+        // Convert V-representation to H-representation (inequalities)
+        h2.reset(dd_CopyInequalities(p2.get()));
+      }
 
-      // Combine inequalities to compute intersection
-      dd_MatrixAppendTo(&h2, h1);
-      dd_SetMatrixRepresentationType(h2, dd_Inequality);
+      // Combine inequalities to compute intersection, the matrix is reallocated
+      dd_MatrixPtr appended = h2.release();
+      dd_MatrixAppendTo(&appended, h1.get());
+      h2.reset(appended);
+      dd_SetMatrixRepresentationType(h2.get(), dd_Inequality);
 
       // Convert intersection back to V-representation
-      dd_PolyhedraPtr intersectionV = dd_DDMatrix2Poly(h2, &err);
-      if (err != dd_NoError)
-        throw InternalException(HERE) << "dd_DDMatrix2Poly failed for intersection: "  << cdd_error_to_string(err);
-      dd_FreeMatrix(h2);
+      CddMatrix gen;
+      {
+        const CddLock cddLock;
+        const CddPolyhedra intersectionV(dd_DDMatrix2Poly(h2.get(), &err));
+        cddCallsNumber += 2;
+        if (err != dd_NoError)
+          throw InternalException(HERE) << "dd_DDMatrix2Poly failed for intersection: "  << cdd_error_to_string(err);
+        h2.reset();
 
-      // retrieve vertices
-      dd_MatrixPtr gen = dd_CopyGenerators(intersectionV);
-      dd_FreePolyhedra(intersectionV);
+        // retrieve vertices
+        gen.reset(dd_CopyGenerators(intersectionV.get()));
+      }
+      cddTimer2.stop();
       const UnsignedInteger intersectionVerticesNumber = gen->rowsize; // empty intersection if zero
       if (intersectionVerticesNumber >= (dimension + 1))
       {
@@ -303,24 +463,56 @@ Mesh IntersectionMesher::build2(const Mesh & mesh1, const Mesh & mesh2) const
         else
         {
           // V>d+1, decompose into several simplices
+          MeshingTimer triangulationTimer(statistics, "triangulationTime");
           const Mesh intersectionMesh(cloudMesher.build(intersectionVertices));
           intersectionColl.add(intersectionMesh);
         }
       } // if (intersectionVerticesNumber >= (dimension + 1))
     } // mesh2 simplices loop
-    dd_FreeMatrix(h1);
-    dd_FreePolyhedra(p1);
-
   } // mesh1 simplices loop
+  statistics.add("pairsTested", testedNumber);
+  statistics.add("pairsPruned", prunedNumber);
+  statistics.add("cddCalls", cddCallsNumber);
+  statistics.add("piecesProduced", intersectionColl.getSize());
+
+  // merge pieces before the next reduction level
+  monitor.check();
+  monitor.progress(0.8);
+  if (compact_)
+  {
+    if (statistics.isEnabled())
+    {
+      UnsignedInteger simplicesNumber = 0;
+      for (UnsignedInteger i = 0; i < intersectionColl.getSize(); ++ i)
+        simplicesNumber += intersectionColl[i].getSimplicesNumber();
+      statistics.add("simplicesBeforeCompaction", simplicesNumber);
+    }
+    MeshingTimer compactionTimer(statistics, "compactionTime");
+    intersectionColl = compactPieces(intersectionColl, dimension);
+    compactionTimer.stop();
+    if (statistics.isEnabled())
+    {
+      UnsignedInteger simplicesNumber = 0;
+      for (UnsignedInteger i = 0; i < intersectionColl.getSize(); ++ i)
+        simplicesNumber += intersectionColl[i].getSimplicesNumber();
+      statistics.add("simplicesAfterCompaction", simplicesNumber);
+      statistics.add("piecesAfterCompaction", intersectionColl.getSize());
+    }
+  }
 
-  // free cddlib objects
-  dd_FreeMatrix(m1);
-  dd_FreeMatrix(m2);
-  dd_free_global_constants();
-
+  monitor.check();
+  monitor.progress(0.9);
+  MeshingTimer unionTimer(statistics, "unionTime");
   Mesh result(UnionMesher().build(intersectionColl));
+  unionTimer.stop();
   if (recompress_)
+  {
+    monitor.check();
+    MeshingTimer compressTimer(statistics, "compressTime");
+    const UnsignedInteger verticesNumber = result.getVerticesNumber();
     result = UnionMesher::CompressMesh(result);
+    statistics.add("verticesDeduplicated", verticesNumber - result.getVerticesNumber());
+  }
   return result;
 #else
   throw NotYetImplementedException(HERE) << "No cddlib support";
@@ -329,6 +521,14 @@ Mesh IntersectionMesher::build2(const Mesh & mesh1, const Mesh & mesh2) const
 
 
 Mesh IntersectionMesher::buildConvex(const Collection<Mesh> & coll) const
+{
+  MeshingStatistics statistics;
+  const Mesh result(buildConvex(coll, statistics));
+  statistics.publish(statistics_);
+  return result;
+}
+
+Mesh IntersectionMesher::buildConvex(const Collection<Mesh> & coll, MeshingStatistics & statistics) const
 {
   const UnsignedInteger size = coll.getSize();
   if (size == 0)
@@ -350,11 +550,11 @@ Mesh IntersectionMesher::buildConvex(const Collection<Mesh> & coll) const
 
   // initialize cddlib
   dd_ErrorType err = dd_NoError;
-  dd_set_global_constants();
+  const CddGlobalConstants cddConstants;
 
   // allocate H-representation of intersection
-  dd_MatrixPtr intersectionH = dd_CreateMatrix(0, dimension + 1);
-  dd_SetMatrixRepresentationType(intersectionH, dd_Inequality);
+  CddMatrix intersectionH(dd_CreateMatrix(0, dimension + 1));
+  dd_SetMatrixRepresentationType(intersectionH.get(), dd_Inequality);
 
   // for each convex
   for (UnsignedInteger i = 0; i < size; ++ i)
@@ -372,6 +572,7 @@ Mesh IntersectionMesher::buildConvex(const Collection<Mesh> & coll) const
       if (toSkip)
         break;
     }
+    statistics.add("pairsTested", 1.0);
     if (toSkip)
     {
       ++ prunedNumber;
@@ -384,8 +585,8 @@ Mesh IntersectionMesher::buildConvex(const Collection<Mesh> & coll) const
     }
 
     // allocate V-representation
-    dd_MatrixPtr m1 = dd_CreateMatrix(nv1, dimension + 1);
-    dd_SetMatrixRepresentationType(m1, dd_Generator);
+    const CddMatrix m1(dd_CreateMatrix(nv1, dimension + 1));
+    dd_SetMatrixRepresentationType(m1.get(), dd_Generator);
     for (UnsignedInteger i1 = 0; i1 < nv1; ++ i1)
     {
       // homogeneous coordinate
@@ -396,36 +597,45 @@ Mesh IntersectionMesher::buildConvex(const Collection<Mesh> & coll) const
       }
     }
 
-    dd_PolyhedraPtr p1 = dd_DDMatrix2Poly(m1, &err);
-    if (err != dd_NoError)
-      throw InternalException(HERE) << "dd_DDMatrix2Poly failed for mesh 1: " << cdd_error_to_string(err);
-
-    // Convert V-representation to H-representation (inequalities)
-    dd_MatrixPtr h1 = dd_CopyInequalities(p1);
-
-    // Combine inequalities
-    dd_MatrixAppendTo(&intersectionH, h1);
+    MeshingTimer cddTimer(statistics, "cddTime");
+    CddMatrix h1;
+    {
+      const CddLock cddLock;
+      const CddPolyhedra p1(dd_DDMatrix2Poly(m1.get(), &err));
+      statistics.add("cddCalls", 1.0);
+      if (err != dd_NoError)
+        throw InternalException(HERE) << "dd_DDMatrix2Poly failed for mesh 1: " << cdd_error_to_string(err);
 
-    // free memory
-    dd_FreeMatrix(m1);
-    dd_FreePolyhedra(p1);
-    dd_FreeMatrix(h1);
+      // Convert V-representation to H-representation (inequalities)
+      h1.reset(dd_CopyInequalities(p1.get()));
+    }
 
+    // Combine inequalities, the matrix is reallocated
+    dd_MatrixPtr appended = intersectionH.release();
+    dd_MatrixAppendTo(&appended, h1.get());
+    intersectionH.reset(appended);
   } // i loop
+  statistics.add("pairsPruned", prunedNumber);
 
   // empty intersection
   if (size - prunedNumber == 1)
     return Mesh(Sample(0, dimension));
 
   // Convert intersection back to V-representation
-  dd_PolyhedraPtr intersectionV = dd_DDMatrix2Poly(intersectionH, &err);
-  if (err != dd_NoError)
-    throw InternalException(HERE) << "dd_DDMatrix2Poly failed for intersection: " << cdd_error_to_string(err);
-  dd_FreeMatrix(intersectionH);
-
-  // retrieve vertices
-  dd_MatrixPtr gen = dd_CopyGenerators(intersectionV);
-  dd_FreePolyhedra(intersectionV);
+  MeshingTimer cddTimer(statistics, "cddTime");
+  CddMatrix gen;
+  {
+    const CddLock cddLock;
+    const CddPolyhedra intersectionV(dd_DDMatrix2Poly(intersectionH.get(), &err));
+    statistics.add("cddCalls", 1.0);
+    if (err != dd_NoError)
+      throw InternalException(HERE) << "dd_DDMatrix2Poly failed for intersection: " << cdd_error_to_string(err);
+    intersectionH.reset();
+
+    // retrieve vertices
+    gen.reset(dd_CopyGenerators(intersectionV.get()));
+  }
+  cddTimer.stop();
   const UnsignedInteger intersectionVerticesNumber = gen->rowsize; // empty intersection if zero
   if (intersectionVerticesNumber >= (dimension + 1))
   {
@@ -455,16 +665,15 @@ Mesh IntersectionMesher::buildConvex(const Collection<Mesh> & coll) const
     else
     {
       // V>d+1, decompose into several simplices
+      MeshingTimer triangulationTimer(statistics, "triangulationTime");
       const Mesh intersectionMesh(cloudMesher.build(intersectionVertices));
       intersectionColl.add(intersectionMesh);
     }
   } // if (intersectionVerticesNumber >= (dimension + 1))
+  gen.reset();
+  statistics.add("piecesProduced", intersectionColl.getSize());
 
-  dd_FreeMatrix(gen);
-  dd_free_global_constants();
-
-  const Mesh result(UnionMesher().build(intersectionColl));
-  return result;
+  return UnionMesher().build(intersectionColl);
 #else
   throw NotYetImplementedException(HERE) << "No cddlib support";
 #endif
@@ -472,12 +681,63 @@ Mesh IntersectionMesher::buildConvex(const Collection<Mesh> & coll) const
 
 Mesh IntersectionMesher::buildCylinder(const Collection<Cylinder> & coll) const
 {
-  CloudMesher mesher;
+  // the convex intersection only relies on the vertices, so no simplices are built
   const UnsignedInteger size = coll.getSize();
+  MeshingStatistics statistics;
+  if (size == 1)
+  {
+    const Mesh result(coll[0].getMesh());
+    statistics.publish(statistics_);
+    return result;
+  }
+  MeshingTimer meshTimer(statistics, "cylinderMeshTime");
   Collection<Mesh> collMesh(size);
   for (UnsignedInteger i = 0; i < size; ++ i)
-    collMesh[i] = mesher.build(coll[i].getVertices());
-  return buildConvex(collMesh);
+    collMesh[i] = Mesh(coll[i].getVertices());
+  meshTimer.stop();
+  const Mesh result(buildConvex(collMesh, statistics));
+  statistics.publish(statistics_);
+  return result;
+}
+
+/* Statistics accessor */
+PointWithDescription IntersectionMesher::getStatistics() const
+{
+  return MeshingStatistics::Read(statistics_);
+}
+
+/* Cancellation token accessor */
+void IntersectionMesher::setCancellationToken(const CancellationToken & cancellationToken)
+{
+  cancellationToken_ = cancellationToken;
+}
+
+CancellationToken IntersectionMesher::getCancellationToken() const
+{
+  return cancellationToken_;
+}
+
+/* Time budget accessor */
+void IntersectionMesher::setMaximumTimeDuration(const Scalar maximumTimeDuration)
+{
+  maximumTimeDuration_ = maximumTimeDuration;
+}
+
+Scalar IntersectionMesher::getMaximumTimeDuration() const
+{
+  return maximumTimeDuration_;
+}
+
+/* Progress callback accessor */
+void IntersectionMesher::setProgressCallback(ProgressCallback callBack, void * state)
+{
+  // the state is not released by the mesher
+  setProgressCallback(callBack, ProgressCallbackState(state, [](void *) {}));
+}
+
+void IntersectionMesher::setProgressCallback(ProgressCallback callBack, const ProgressCallbackState & state)
+{
+  progressCallback_ = std::pair<ProgressCallback, ProgressCallbackState>(callBack, state);
 }
 
 /* Recompression flag accessor */
@@ -491,11 +751,23 @@ Bool IntersectionMesher::getRecompress() const
   return recompress_;
 }
 
+/* Compaction flag accessor */
+void IntersectionMesher::setCompact(const Bool compact)
+{
+  compact_ = compact;
+}
+
+Bool IntersectionMesher::getCompact() const
+{
+  return compact_;
+}
+
 /* Method save() stores the object through the StorageManager */
 void IntersectionMesher::save(Advocate & adv) const
 {
   PersistentObject::save(adv);
   adv.saveAttribute("recompress_", recompress_);
+  adv.saveAttribute("compact_", compact_);
 }
 
 /* Method load() reloads the object from the StorageManager */
@@ -503,6 +775,7 @@ void IntersectionMesher::load(Advocate & adv)
 {
   PersistentObject::load(adv);
   adv.loadAttribute("recompress_", recompress_);
+  adv.loadAttribute("compact_", compact_);
 }
 
 }
@@ -0,0 +1,298 @@
+//                                               -*- C++ -*-
+/**
+ *  @brief Nearest neighbour spatial index
+ *
+ *  Copyright 2005-2026 Airbus-EDF-IMACS-ONERA-Phimeca
+ *
+ *  This library is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License
+ *  along with this library.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+#include "otmeshing/KDTree2.hxx"
+
+#include <openturns/PersistentObjectFactory.hxx>
+#include <openturns/TBBImplementation.hxx>
+
+#include <nanoflann.hpp>
+#if NANOFLANN_VERSION < 0x150
+namespace nanoflann
+{
+using SearchParameters = SearchParams;
+}
+#endif
+
+using namespace OT;
+
+namespace OTMESHING
+{
+
+class KDTreeSampleAdaptor
+{
+public:
+  explicit KDTreeSampleAdaptor(const Sample & points)
+    : data_(points.getImplementation()->data())
+    , size_(points.getSize())
+    , dimension_(points.getDimension())
+  {
+  }
+
+  inline size_t kdtree_get_point_count() const
+  {
+    return size_;
+  }
+
+  inline Scalar kdtree_get_pt(const size_t idx, const size_t dim) const
+  {
+    return data_[dim + idx * dimension_];
+  }
+
+  template <class BBOX>
+  bool kdtree_get_bbox(BBOX & /*bb*/) const
+  {
+    return false;
+  }
+
+private:
+  const Scalar *data_ = nullptr;
+  UnsignedInteger size_ = 0;
+  UnsignedInteger dimension_ = 0;
+};
+
+using nano_kd_tree_t = nanoflann::KDTreeSingleIndexAdaptor <
+                       nanoflann::L2_Simple_Adaptor<Scalar, KDTreeSampleAdaptor >,
+                       KDTreeSampleAdaptor, -1, size_t >;
+
+/* The nanoflann index, kept out of the public header */
+class KDTree2Index
+{
+public:
+  explicit KDTree2Index(const Sample & points)
+    : points_(points)
+    , sampleAdaptor_(points_)
+  {
+    nanoflann::KDTreeSingleIndexAdaptorParams indexParameters;
+    indexParameters.leaf_max_size = ResourceMap::GetAsUnsignedInteger("KDTree-leaf_max_size");
+#if NANOFLANN_VERSION >= 0x150
+    indexParameters.n_thread_build = ResourceMap::GetAsUnsignedInteger("KDTree-n_thread_build");
+#endif
+    indexAdaptor_ = new nano_kd_tree_t(points.getDimension(), sampleAdaptor_, indexParameters);
+  }
+
+  Indices queryNearest(const Scalar * x, const UnsignedInteger k) const
+  {
+    std::vector<size_t> indices(k);
+    std::vector<Scalar> distances(k);
+    const UnsignedInteger nFound = indexAdaptor_->knnSearch(x, k, indices.data(), distances.data());
+    return Indices(indices.begin(), indices.begin() + nFound);
+  }
+
+  Indices queryRadius(const Scalar * x, const Scalar radius) const
+  {
+#if NANOFLANN_VERSION >= 0x150
+    std::vector<nanoflann::ResultItem<size_t, Scalar> > indicesDists;
+#else
+    std::vector<std::pair<size_t, Scalar> > indicesDists;
+#endif
+    nanoflann::SearchParameters searchParameters;
+    searchParameters.sorted = true;
+    const UnsignedInteger nFound = indexAdaptor_->radiusSearch(x, radius * radius, indicesDists, searchParameters);
+    Indices result(nFound);
+    for (UnsignedInteger k = 0; k < nFound; ++ k)
+      result[k] = indicesDists[k].first;
+    return result;
+  }
+
+private:
+  // holds the data read by the adaptor
+  const Sample points_;
+  KDTreeSampleAdaptor sampleAdaptor_;
+  Pointer<nano_kd_tree_t> indexAdaptor_;
+};
+
+/* Batch queries, each point is processed independently */
+struct KDTree2NearestPolicy
+{
+  const KDTree2Index & index_;
+  const Scalar * data_;
+  const UnsignedInteger dimension_;
+  const UnsignedInteger k_;
+  Collection<Indices> & output_;
+
+  KDTree2NearestPolicy(const KDTree2Index & index,
+                       const Sample & sample,
+                       const UnsignedInteger k,
+                       Collection<Indices> & output)
+    : index_(index)
+    , data_(sample.getImplementation()->data())
+    , dimension_(sample.getDimension())
+    , k_(k)
+    , output_(output)
+  {}
+
+  inline void operator()(const TBBImplementation::BlockedRange<UnsignedInteger> & r) const
+  {
+    for (UnsignedInteger i = r.begin(); i != r.end(); ++ i)
+      output_[i] = index_.queryNearest(data_ + i * dimension_, k_);
+  }
+}; /* end struct KDTree2NearestPolicy */
+
+struct KDTree2RadiusPolicy
+{
+  const KDTree2Index & index_;
+  const Scalar * data_;
+  const UnsignedInteger dimension_;
+  const Scalar radius_;
+  Collection<Indices> & output_;
+
+  KDTree2RadiusPolicy(const KDTree2Index & index,
+                      const Sample & sample,
+                      const Scalar radius,
+                      Collection<Indices> & output)
+    : index_(index)
+    , data_(sample.getImplementation()->data())
+    , dimension_(sample.getDimension())
+    , radius_(radius)
+    , output_(output)
+  {}
+
+  inline void operator()(const TBBImplementation::BlockedRange<UnsignedInteger> & r) const
+  {
+    for (UnsignedInteger i = r.begin(); i != r.end(); ++ i)
+      output_[i] = index_.queryRadius(data_ + i * dimension_, radius_);
+  }
+}; /* end struct KDTree2RadiusPolicy */
+
+CLASSNAMEINIT(KDTree2)
+
+static Factory<KDTree2> Factory_KDTree2;
+
+
+/* Default constructor */
+KDTree2::KDTree2()
+  : PersistentObject()
+{
+  // Nothing to do
+}
+
+/* Parameters constructor */
+KDTree2::KDTree2(const Sample & points)
+  : PersistentObject()
+  , points_(points)
+{
+  initialize();
+}
+
+/* Virtual constructor method */
+KDTree2 * KDTree2::clone() const
+{
+  return new KDTree2(*this);
+}
+
+/* Build the index, the adaptor reads the points in place */
+void KDTree2::initialize()
+{
+  if (!points_.getSize())
+    throw InvalidArgumentException(HERE) << "KDTree2 expected a non-empty sample";
+  index_ = new KDTree2Index(points_);
+}
+
+/* Indexed points accessor */
+Sample KDTree2::getPoints() const
+{
+  return points_;
+}
+
+/* Indices of the k nearest points */
+Indices KDTree2::queryNearest(const Point & x, const UnsignedInteger k) const
+{
+  if (index_.isNull())
+    throw NotDefinedException(HERE) << "KDTree2 is not built";
+  if (x.getDimension() != points_.getDimension())
+    throw InvalidArgumentException(HERE) << "Expected a point of dimension " << points_.getDimension() << ", got " << x.getDimension();
+  return index_->queryNearest(x.data(), std::min(k, points_.getSize()));
+}
+
+IndicesCollection KDTree2::queryNearest(const Sample & sample, const UnsignedInteger k) const
+{
+  if (index_.isNull())
+    throw NotDefinedException(HERE) << "KDTree2 is not built";
+  if (sample.getDimension() != points_.getDimension())
+    throw InvalidArgumentException(HERE) << "Expected a sample of dimension " << points_.getDimension() << ", got " << sample.getDimension();
+  const UnsignedInteger size = sample.getSize();
+  const UnsignedInteger kEff = std::min(k, points_.getSize());
+  Collection<Indices> result(size);
+  const KDTree2NearestPolicy policy(*index_, sample, kEff, result);
+  TBBImplementation::ParallelFor(0, size, policy);
+  IndicesCollection nearest(size, kEff);
+  for (UnsignedInteger i = 0; i < size; ++ i)
+    std::copy(result[i].begin(), result[i].end(), nearest.begin_at(i));
+  return nearest;
+}
+
+/* Indices of the points within a given radius */
+Indices KDTree2::queryRadius(const Point & x, const Scalar radius) const
+{
+  if (index_.isNull())
+    throw NotDefinedException(HERE) << "KDTree2 is not built";
+  if (x.getDimension() != points_.getDimension())
+    throw InvalidArgumentException(HERE) << "Expected a point of dimension " << points_.getDimension() << ", got " << x.getDimension();
+  if (!(radius >= 0.0))
+    throw InvalidArgumentException(HERE) << "Radius must be positive, here radius=" << radius;
+  return index_->queryRadius(x.data(), radius);
+}
+
+IndicesCollection KDTree2::queryRadius(const Sample & sample, const Scalar radius) const
+{
+  if (index_.isNull())
+    throw NotDefinedException(HERE) << "KDTree2 is not built";
+  if (sample.getDimension() != points_.getDimension())
+    throw InvalidArgumentException(HERE) << "Expected a sample of dimension " << points_.getDimension() << ", got " << sample.getDimension();
+  if (!(radius >= 0.0))
+    throw InvalidArgumentException(HERE) << "Radius must be positive, here radius=" << radius;
+  const UnsignedInteger size = sample.getSize();
+  Collection<Indices> result(size);
+  const KDTree2RadiusPolicy policy(*index_, sample, radius, result);
+  TBBImplementation::ParallelFor(0, size, policy);
+  // ragged collection, one row per query point
+  return IndicesCollection(result);
+}
+
+/* String converter */
+String KDTree2::__repr__() const
+{
+  OSS oss(true);
+  oss << "class=" << KDTree2::GetClassName()
+      << " size=" << points_.getSize()
+      << " dimension=" << points_.getDimension();
+  return oss;
+}
+
+/* Method save() stores the object through the StorageManager */
+void KDTree2::save(Advocate & adv) const
+{
+  PersistentObject::save(adv);
+  adv.saveAttribute("points_", points_);
+}
+
+/* Method load() reloads the object from the StorageManager */
+void KDTree2::load(Advocate & adv)
+{
+  PersistentObject::load(adv);
+  adv.loadAttribute("points_", points_);
+  // the index itself is not stored, it is rebuilt
+  index_.reset();
+  if (points_.getSize())
+    initialize();
+}
+
+} /* namespace OTMESHING */
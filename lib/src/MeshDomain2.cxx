@@ -22,6 +22,7 @@
 
 #include <openturns/PersistentObjectFactory.hxx>
 #include <openturns/SpecFunc.hxx>
+#include <openturns/TBBImplementation.hxx>
 
 #include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
 #if CGAL_VERSION_NR >= 1060000000
@@ -38,230 +39,717 @@
 #include <CGAL/AABB_face_graph_triangle_primitive.h>
 #include <CGAL/Side_of_triangle_mesh.h>
 
+#include <memory>
+
+#include "otmeshing/BoundingBoxTree.hxx"
+#include "otmeshing/KDTree2.hxx"
+#include "MeshingStatistics.hxx"
+
+using KernelInexact = CGAL::Exact_predicates_inexact_constructions_kernel;
+using Point3 = KernelInexact::Point_3;
+using Segment3 = KernelInexact::Segment_3;
+using Ray3 = KernelInexact::Ray_3;
+using Mesh3 = CGAL::Surface_mesh<Point3>;
+using Side_of_triangle_mesh = CGAL::Side_of_triangle_mesh<Mesh3, KernelInexact>;
+using EdgeIterator = std::vector<Segment3>::iterator;
+#if CGAL_VERSION_NR >= 1060000000
+using EdgePrimitive = CGAL::AABB_triangle_primitive_3<KernelInexact, EdgeIterator>;
+using EdgesTree = CGAL::AABB_tree<CGAL::AABB_traits_3<KernelInexact, EdgePrimitive> >;
+using FacesTree = CGAL::AABB_tree<CGAL::AABB_traits_3<KernelInexact, CGAL::AABB_face_graph_triangle_primitive<Mesh3> > >;
+#else
+using EdgePrimitive = CGAL::AABB_triangle_primitive<KernelInexact, EdgeIterator>;
+using EdgesTree = CGAL::AABB_tree<CGAL::AABB_traits<KernelInexact, EdgePrimitive> >;
+using FacesTree = CGAL::AABB_tree<CGAL::AABB_traits<KernelInexact, CGAL::AABB_face_graph_triangle_primitive<Mesh3> > >;
+#endif
+
 using namespace OT;
 
 namespace OTMESHING
 {
 
-CLASSNAMEINIT(MeshDomain2)
-static const Factory<MeshDomain2> Factory_MeshDomain2;
+/* Evaluate a query on each point, the query only reads structures built beforehand */
+template <class QueryFunction>
+struct MeshDomain2QueryPolicy
+{
+  const QueryFunction & query_;
+  Scalar * distances_;
 
+  MeshDomain2QueryPolicy(const QueryFunction & query, Scalar * distances)
+    : query_(query)
+    , distances_(distances)
+  {}
 
-/* Default constructor */
-MeshDomain2::MeshDomain2()
-  : MeshDomain()
+  inline void operator()(const TBBImplementation::BlockedRange<UnsignedInteger> & r) const
+  {
+    for (UnsignedInteger i = r.begin(); i != r.end(); ++ i)
+      distances_[i] = query_(i);
+  }
+}; /* end struct MeshDomain2QueryPolicy */
+
+/* Solve the n x n system a.x = b in place by Gaussian elimination with partial pivoting, false if it is singular */
+static Bool SolveLinearSystem(std::vector<Scalar> & a, std::vector<Scalar> & b, const UnsignedInteger n)
 {
-  // Nothing to do
+  Scalar scale = 0.0;
+  for (UnsignedInteger i = 0; i < n * n; ++ i)
+    scale = std::max(scale, std::abs(a[i]));
+  const Scalar threshold = 64.0 * std::numeric_limits<Scalar>::epsilon() * scale;
+  for (UnsignedInteger j = 0; j < n; ++ j)
+  {
+    UnsignedInteger pivot = j;
+    for (UnsignedInteger i = j + 1; i < n; ++ i)
+      if (std::abs(a[i * n + j]) > std::abs(a[pivot * n + j]))
+        pivot = i;
+    if (!(std::abs(a[pivot * n + j]) > threshold))
+      return false;
+    if (pivot != j)
+    {
+      std::swap_ranges(a.begin() + j * n, a.begin() + (j + 1) * n, a.begin() + pivot * n);
+      std::swap(b[j], b[pivot]);
+    }
+    for (UnsignedInteger i = j + 1; i < n; ++ i)
+    {
+      const Scalar factor = a[i * n + j] / a[j * n + j];
+      for (UnsignedInteger k = j; k < n; ++ k)
+        a[i * n + k] -= factor * a[j * n + k];
+      b[i] -= factor * b[j];
+    }
+  }
+  for (UnsignedInteger j = n; j > 0; -- j)
+  {
+    Scalar value = b[j - 1];
+    for (UnsignedInteger k = j; k < n; ++ k)
+      value -= a[(j - 1) * n + k] * b[k];
+    b[j - 1] = value / a[(j - 1) * n + j - 1];
+  }
+  return true;
 }
 
-/* Parameters constructor */
-MeshDomain2::MeshDomain2(const OT::Mesh & mesh)
-: MeshDomain(mesh)
+/* Squared distance from x to the simplex spanned by the given vertices, and the closest point */
+static Scalar SquaredDistanceToSimplex(const Scalar * x,
+                                       const Scalar * vertices,
+                                       const std::vector<UnsignedInteger> & simplex,
+                                       const UnsignedInteger dimension,
+                                       Scalar * closest)
 {
-  // Nothing to do
+  const UnsignedInteger k = simplex.size() - 1;
+  const Scalar * v0 = vertices + simplex[0] * dimension;
+  if (!k)
+  {
+    Scalar distance2 = 0.0;
+    for (UnsignedInteger l = 0; l < dimension; ++ l)
+    {
+      closest[l] = v0[l];
+      distance2 += (x[l] - v0[l]) * (x[l] - v0[l]);
+    }
+    return distance2;
+  }
+
+  // projection on the affine hull, from the normal equations of the edges
+  std::vector<Scalar> gram(k * k);
+  std::vector<Scalar> coordinates(k);
+  for (UnsignedInteger i = 0; i < k; ++ i)
+  {
+    const Scalar * vi = vertices + simplex[i + 1] * dimension;
+    coordinates[i] = 0.0;
+    for (UnsignedInteger l = 0; l < dimension; ++ l)
+      coordinates[i] += (vi[l] - v0[l]) * (x[l] - v0[l]);
+    for (UnsignedInteger j = 0; j < k; ++ j)
+    {
+      const Scalar * vj = vertices + simplex[j + 1] * dimension;
+      Scalar dot = 0.0;
+      for (UnsignedInteger l = 0; l < dimension; ++ l)
+        dot += (vi[l] - v0[l]) * (vj[l] - v0[l]);
+      gram[i * k + j] = dot;
+    }
+  }
+  const Bool projected = SolveLinearSystem(gram, coordinates, k);
+  Scalar coordinate0 = 1.0;
+  if (projected)
+  {
+    Bool inside = true;
+    for (UnsignedInteger i = 0; i < k; ++ i)
+    {
+      coordinate0 -= coordinates[i];
+      inside = inside && (coordinates[i] >= 0.0);
+    }
+    if (inside && (coordinate0 >= 0.0))
+    {
+      Scalar distance2 = 0.0;
+      for (UnsignedInteger l = 0; l < dimension; ++ l)
+      {
+        closest[l] = v0[l];
+        for (UnsignedInteger i = 0; i < k; ++ i)
+          closest[l] += coordinates[i] * (vertices[simplex[i + 1] * dimension + l] - v0[l]);
+        distance2 += (x[l] - closest[l]) * (x[l] - closest[l]);
+      }
+      return distance2;
+    }
+  }
+
+  // otherwise the closest point is on a facet opposite to a negative coordinate, any facet for a flat simplex
+  Scalar best = SpecFunc::MaxScalar;
+  std::vector<Scalar> facetClosest(dimension);
+  std::vector<UnsignedInteger> facet(k);
+  for (UnsignedInteger m = 0; m <= k; ++ m)
+  {
+    if (projected && (((m == 0) ? coordinate0 : coordinates[m - 1]) >= 0.0))
+      continue;
+    std::copy(simplex.begin(), simplex.begin() + m, facet.begin());
+    std::copy(simplex.begin() + m + 1, simplex.end(), facet.begin() + m);
+    const Scalar distance2 = SquaredDistanceToSimplex(x, vertices, facet, dimension, facetClosest.data());
+    if (distance2 < best)
+    {
+      best = distance2;
+      std::copy(facetClosest.begin(), facetClosest.end(), closest);
+    }
+  }
+  return best;
 }
 
-/* Virtual constructor */
-MeshDomain2 * MeshDomain2::clone() const
+/* Whether x lies in the full-dimensional simplex, up to a tolerance on its barycentric coordinates */
+static Bool SimplexContains(const Scalar * x,
+                            const Scalar * vertices,
+                            const UnsignedInteger * simplex,
+                            const UnsignedInteger dimension)
 {
-  return new MeshDomain2(*this);
+  const Scalar epsilon = 1.0e-12;
+  const Scalar * v0 = vertices + simplex[0] * dimension;
+  std::vector<Scalar> edges(dimension * dimension);
+  std::vector<Scalar> coordinates(dimension);
+  for (UnsignedInteger l = 0; l < dimension; ++ l)
+  {
+    for (UnsignedInteger j = 0; j < dimension; ++ j)
+      edges[l * dimension + j] = vertices[simplex[j + 1] * dimension + l] - v0[l];
+    coordinates[l] = x[l] - v0[l];
+  }
+  if (!SolveLinearSystem(edges, coordinates, dimension))
+    return false;
+  Scalar coordinate0 = 1.0;
+  for (UnsignedInteger j = 0; j < dimension; ++ j)
+  {
+    if (coordinates[j] < -epsilon)
+      return false;
+    coordinate0 -= coordinates[j];
+  }
+  return coordinate0 >= -epsilon;
 }
 
-/* Compute the Euclidean distance from a given point to the domain */
-Scalar MeshDomain2::computeDistance(const Point & point) const
+/* Outward unit normal of a boundary facet, the row ends with the vertex of its cell opposite to the facet */
+static void ComputeFacetNormal(const Scalar * vertices,
+                               const UnsignedInteger * facet,
+                               const UnsignedInteger dimension,
+                               Scalar * normal)
 {
-  return computeDistance(Sample(1, point))(0, 0);
+  // the opposite vertex minus its projection on the affine hull of the facet points inwards
+  const UnsignedInteger k = dimension - 1;
+  const Scalar * v0 = vertices + facet[0] * dimension;
+  const Scalar * opposite = vertices + facet[dimension] * dimension;
+  std::vector<Scalar> gram(k * k);
+  std::vector<Scalar> coordinates(k);
+  for (UnsignedInteger i = 0; i < k; ++ i)
+  {
+    const Scalar * vi = vertices + facet[i + 1] * dimension;
+    coordinates[i] = 0.0;
+    for (UnsignedInteger l = 0; l < dimension; ++ l)
+      coordinates[i] += (vi[l] - v0[l]) * (opposite[l] - v0[l]);
+    for (UnsignedInteger j = 0; j < k; ++ j)
+    {
+      const Scalar * vj = vertices + facet[j + 1] * dimension;
+      Scalar dot = 0.0;
+      for (UnsignedInteger l = 0; l < dimension; ++ l)
+        dot += (vi[l] - v0[l]) * (vj[l] - v0[l]);
+      gram[i * k + j] = dot;
+    }
+  }
+  std::fill(normal, normal + dimension, 0.0);
+  if (!SolveLinearSystem(gram, coordinates, k))
+    return;
+  Scalar norm2 = 0.0;
+  for (UnsignedInteger l = 0; l < dimension; ++ l)
+  {
+    normal[l] = v0[l] - opposite[l];
+    for (UnsignedInteger i = 0; i < k; ++ i)
+      normal[l] += coordinates[i] * (vertices[facet[i + 1] * dimension + l] - v0[l]);
+    norm2 += normal[l] * normal[l];
+  }
+  if (!(norm2 > 0.0))
+    return;
+  const Scalar norm = std::sqrt(norm2);
+  for (UnsignedInteger l = 0; l < dimension; ++ l)
+    normal[l] /= norm;
 }
 
-Sample MeshDomain2::computeDistance(const Sample & points) const
+/* Facets referenced by a single cell, sorted, each row ends with the vertex of the cell opposite to the facet */
+template <class IndexType>
+IndicesCollection extractBoundaryFacets(const IndexType * simplices,
+                                        const UnsignedInteger simplicesNumber,
+                                        const UnsignedInteger dimension)
 {
-  const UnsignedInteger dimension = getDimension();
-  const UnsignedInteger size = points.getSize();
-  if (points.getDimension() != dimension)
-    throw InvalidArgumentException(HERE) << "Expected a point of dimension " << dimension << " got " << points.getDimension();
-  const Mesh mesh(getMesh());
-  const Sample vertices(mesh.getVertices());
-  const IndicesCollection simplices(mesh.getSimplices());
-  Sample distances(size, 1);
+  // we want to filter out internal facet
+  // external facets are only referenced by one cell
+  std::map<Indices, std::pair<UnsignedInteger, UnsignedInteger> > facetMap;
+  for (UnsignedInteger i = 0; i < simplicesNumber; ++ i)
+  {
+    const IndexType * simplex = simplices + i * (dimension + 1);
+    for (UnsignedInteger j = 0; j <= dimension; ++ j)
+    {
+      Indices facet;
+      for (UnsignedInteger m = 0; m <= dimension; ++ m)
+        if (m != j)
+          facet.add(simplex[m]);
+      std::sort(facet.begin(), facet.end());
+      std::pair<UnsignedInteger, UnsignedInteger> & elt = facetMap[facet];
+      ++ elt.first;
+      elt.second = simplex[j];
+    }
+  }
+  UnsignedInteger facetsNumber = 0;
+  for (const auto & elt : facetMap)
+    if (elt.second.first == 1)
+      ++ facetsNumber;
+  IndicesCollection boundary(facetsNumber, dimension + 1);
+  UnsignedInteger f = 0;
+  for (const auto & elt : facetMap)
+    if (elt.second.first == 1)
+    {
+      std::copy(elt.first.begin(), elt.first.end(), &boundary(f, 0));
+      boundary(f, dimension) = elt.second.second;
+      ++ f;
+    }
+  return boundary;
+}
 
-  if (dimension == 2)
+/* Optional outputs of the queries, null when they are not requested */
+struct MeshDomain2Projection
+{
+  Scalar * closestPoints_ = nullptr;
+  UnsignedInteger * facetIndices_ = nullptr;
+  Scalar * normals_ = nullptr;
+
+  void set(const UnsignedInteger i,
+           const Scalar * closest,
+           const UnsignedInteger facet,
+           const Scalar * vertices,
+           const IndicesCollection & boundary,
+           const UnsignedInteger dimension) const
   {
-    using KernelInexact = CGAL::Exact_predicates_inexact_constructions_kernel;
-    using Point2 = KernelInexact::Point_2;
-    using Point3 = KernelInexact::Point_3;
-    using Segment2 = KernelInexact::Segment_2;
-    using Segment3 = KernelInexact::Segment_3;
-    using Ray2 = KernelInexact::Ray_2;
-    using TriangleIterator = std::vector<Segment3>::iterator;
-#if CGAL_VERSION_NR >= 1060000000
-    using Primitive = CGAL::AABB_triangle_primitive_3<KernelInexact, TriangleIterator>;
-    using AABB_Traits = CGAL::AABB_traits_3<KernelInexact, Primitive>;
-#else
-    using Primitive = CGAL::AABB_triangle_primitive<KernelInexact, TriangleIterator>;
-    using AABB_Traits = CGAL::AABB_traits<KernelInexact, Primitive>;
-#endif
-    using Tree = CGAL::AABB_tree<AABB_Traits>;
+    if (closestPoints_)
+      std::copy(closest, closest + dimension, closestPoints_ + i * dimension);
+    if (facetIndices_)
+      facetIndices_[i] = facet;
+    if (normals_)
+      ComputeFacetNormal(vertices, &(*boundary.cbegin_at(facet)), dimension, normals_ + i * dimension);
+  }
+}; /* end struct MeshDomain2Projection */
+
+/* Search structures of the boundary, built once per mesh and shared by the copies of the domain */
+class MeshDomain2Index
+{
+public:
+  template <class IndexType>
+  MeshDomain2Index(const Sample & vertices,
+                   const IndexType * simplices,
+                   const UnsignedInteger simplicesNumber,
+                   const IndicesCollection & boundary)
+    : vertices_(vertices)
+    , dimension_(vertices.getDimension())
+    , boundary_(boundary)
+  {
+    MeshingStatistics statistics;
+    MeshingTimer treeTimer(statistics, "treeBuildTime");
+    if (dimension_ == 2)
+      build2();
+    else if (dimension_ == 3)
+      build3();
+    else
+      buildN(simplices, simplicesNumber);
+    treeTimer.stop();
+    statistics.add("boundaryFacets", facetsNumber_);
+    statistics.publish(statistics_);
+  }
+
+  MeshDomain2Index(const MeshDomain2Index &) = delete;
+  MeshDomain2Index & operator=(const MeshDomain2Index &) = delete;
+
+  /** Build time and size of the structures */
+  PointWithDescription getStatistics() const
+  {
+    return statistics_;
+  }
 
-    // we want to filter out internal facet
-    // external facets are only referenced by one cell
-    std::map<Indices, UnsignedInteger> facetMap;
-    for (UnsignedInteger i = 0; i < simplices.getSize(); ++ i)
+  UnsignedInteger getDimension() const
+  {
+    return dimension_;
+  }
+
+  /** Throw if the structures cannot answer the queries */
+  void check() const
+  {
+    if (!facetsNumber_)
+      throw InvalidArgumentException(HERE) << "MeshDomain2 expected a mesh with boundary facets";
+    if ((dimension_ == 3) && !closed_)
+      throw InternalException(HERE) << "MeshDomain2.computeDistance(3d): mesh should be closed";
+  }
+
+  /** Signed distance of the i-th point, only reads the structures so it can be called concurrently */
+  Scalar computeDistance(const Scalar * x,
+                         const UnsignedInteger i,
+                         const MeshDomain2Projection & projection) const
+  {
+    if (dimension_ == 2)
+      return computeDistance2(x, i, projection);
+    if (dimension_ == 3)
+      return computeDistance3(x, i, projection);
+    return computeDistanceN(x, i, projection);
+  }
+
+private:
+  void build2()
+  {
+    // CGAL<6 does not support 2d AABB tree, so lift the edges
+    const Scalar * vertices = vertices_.getImplementation()->data();
+    facetsNumber_ = boundary_.getSize();
+    edges_.reserve(facetsNumber_);
+    for (UnsignedInteger f = 0; f < facetsNumber_; ++ f)
     {
-      const UnsignedInteger i0 = simplices(i, 0);
-      const UnsignedInteger i1 = simplices(i, 1);
-      const UnsignedInteger i2 = simplices(i, 2);
-      Indices f1 = {i0, i1};
-      Indices f2 = {i1, i2};
-      Indices f3 = {i2, i0};
-      std::sort(f1.begin(), f1.end());
-      std::sort(f2.begin(), f2.end());
-      std::sort(f3.begin(), f3.end());
-      ++ facetMap[f1];
-      ++ facetMap[f2];
-      ++ facetMap[f3];
+      const Scalar * v0 = vertices + boundary_(f, 0) * dimension_;
+      const Scalar * v1 = vertices + boundary_(f, 1) * dimension_;
+      edges_.emplace_back(Point3(v0[0], v0[1], 0.0), Point3(v1[0], v1[1], 0.0));
     }
+    if (!facetsNumber_)
+      return;
+    edgesTree_.insert(edges_.begin(), edges_.end());
+    edgesTree_.build();
+    edgesTree_.accelerate_distance_queries();
+    // the search structure of the distance queries is built on the first query, do it before the threads start
+    edgesTree_.closest_point(edges_[0].source());
+  }
 
-    // Build list of boundary edges
-    std::vector<Segment2> boundary_edges2;
-    std::vector<Segment3> boundary_edges3;
-    for (const auto & elt : facetMap)
+  void build3()
+  {
+    // boundary mesh representation instead of triangle representation
+    // allows to use Side_of_triangle_mesh boundary point location
+    const Scalar * vertices = vertices_.getImplementation()->data();
+    std::map<Point3, Mesh3::Vertex_index> vMap;
+    for (UnsignedInteger facet = 0; facet < boundary_.getSize(); ++ facet)
     {
-      if (elt.second == 1) // boundary edge
+      Mesh3::Vertex_index v[3];
+      for (UnsignedInteger j = 0; j < 3; ++ j)
       {
-        const UnsignedInteger i0 = elt.first[0];
-        const UnsignedInteger i1 = elt.first[1];
-
-        const Point2 v0{vertices(i0, 0), vertices(i0, 1)};
-        const Point2 v1{vertices(i1, 0), vertices(i1, 1)};
-
-        boundary_edges2.emplace_back(v0, v1);
-        boundary_edges3.emplace_back(Point3(v0[0], v0[1], 0.0), Point3(v1[0], v1[1], 0.0));
+        const Scalar * xj = vertices + boundary_(facet, j) * dimension_;
+        const Point3 vj(xj[0], xj[1], xj[2]);
+        // only add vertices of boundary facets
+        const std::map<Point3, Mesh3::Vertex_index>::const_iterator it = vMap.find(vj);
+        v[j] = (it == vMap.end()) ? (vMap[vj] = mesh3_.add_vertex(vj)) : it->second;
       }
+      auto f = mesh3_.add_face(v[0], v[1], v[2]);
+
+      // check for non-manifold edge
+      if (f == Mesh3::null_face())
+        f = mesh3_.add_face(v[0], v[2], v[1]);
+      // boundary facet of each face, the faces are numbered in insertion order
+      if (f != Mesh3::null_face())
+        faceFacets_.push_back(facet);
     }
+    facetsNumber_ = mesh3_.number_of_faces();
+    closed_ = CGAL::is_closed(mesh3_);
+    if (!facetsNumber_ || !closed_)
+      return;
+    facesTree_.insert(mesh3_.faces().begin(), mesh3_.faces().end(), mesh3_);
+    facesTree_.build();
+    facesTree_.accelerate_distance_queries();
 
-    // Build 3d tree (CGAL<6 does not support 2d AABB tree, so lift points)
-    Tree tree(boundary_edges3.begin(), boundary_edges3.end());
-    tree.accelerate_distance_queries();
+    // this is more robust than using simple ray intersection with AABB_tree
+    insideTester_.reset(new Side_of_triangle_mesh(mesh3_));
+    // the trees of the distance and of the inside tester are built on the first query, do it before the threads start
+    const Point3 origin(mesh3_.point(*mesh3_.vertices().begin()));
+    facesTree_.closest_point(origin);
+    (*insideTester_)(origin);
+  }
 
-    for (UnsignedInteger i = 0; i < size; ++ i)
-    {
-      // distance to closest simplex
-      const Point3 query(points(i, 0), points(i, 1), 0.0);
-      const Point3 closest = tree.closest_point(query);
-      distances(i, 0) = std::sqrt(CGAL::squared_distance(query, closest));
-
-      // Ray casting for general boundary edge list
-      UnsignedInteger intersections = 0;
-      const Ray2 ray(Point2(points(i, 0), points(i, 1)),
-                     Point2(points(i, 0) + 1.0, points(i, 1))); // horizontal ray
-      for (const auto& edge2 : boundary_edges2)
+  template <class IndexType>
+  void buildN(const IndexType * simplices, const UnsignedInteger simplicesNumber)
+  {
+    facetsNumber_ = boundary_.getSize();
+    if (!facetsNumber_)
+      return;
+    IndicesCollection facets(facetsNumber_, dimension_);
+    Sample centroids(facetsNumber_, dimension_);
+    for (UnsignedInteger f = 0; f < facetsNumber_; ++ f)
+      for (UnsignedInteger j = 0; j < dimension_; ++ j)
       {
-        if (CGAL::do_intersect(ray, edge2))
-          ++ intersections;
+        facets(f, j) = boundary_(f, j);
+        for (UnsignedInteger l = 0; l < dimension_; ++ l)
+          centroids(f, l) += vertices_(facets(f, j), l) / dimension_;
       }
-      const Bool inside = (intersections % 2) == 1;
-      if (inside)
-        distances(i, 0) = -distances(i, 0);
-      LOGDEBUG(OSS() << "query=" << points[i] << " closest=" << Point({closest[0], closest[1]}) << " intersections=" << intersections << " inside=" << inside << " dist=" << distances(i, 0));
-    }
+    centroidsTree_ = KDTree2(centroids);
+    facetsTree_ = BoundingBoxTree(Mesh(vertices_, facets));
+    cells_ = IndicesCollection(simplicesNumber, dimension_ + 1);
+    std::copy(simplices, simplices + simplicesNumber * (dimension_ + 1), &cells_(0, 0));
+    cellsTree_ = BoundingBoxTree(Mesh(vertices_, cells_));
   }
-  else if (dimension == 3)
+
+  Scalar computeDistance2(const Scalar * x,
+                          const UnsignedInteger i,
+                          const MeshDomain2Projection & projection) const
   {
-    using KernelInexact = CGAL::Exact_predicates_inexact_constructions_kernel;
-    using Point3 = KernelInexact::Point_3;
-    using Mesh3 = CGAL::Surface_mesh<Point3>;
-    using Side_of_triangle_mesh = CGAL::Side_of_triangle_mesh<Mesh3, KernelInexact>;
-    using Primitive = CGAL::AABB_face_graph_triangle_primitive<Mesh3>;
-#if CGAL_VERSION_NR >= 1060000000
-    using AABB_Traits = CGAL::AABB_traits_3<KernelInexact, Primitive>;
-#else
-    using AABB_Traits = CGAL::AABB_traits<KernelInexact, Primitive>;
-#endif
-    using Tree = CGAL::AABB_tree<AABB_Traits>;
+    // distance to closest simplex
+    const Point3 query(x[0], x[1], 0.0);
+    const auto closestAndPrimitive = edgesTree_.closest_point_and_primitive(query);
+    const Point3 closest = closestAndPrimitive.first;
+    Scalar distance = std::sqrt(CGAL::squared_distance(query, closest));
+    const Scalar closestCoordinates[2] = {closest[0], closest[1]};
+    projection.set(i, closestCoordinates, closestAndPrimitive.second - edges_.begin(), vertices_.getImplementation()->data(), boundary_, dimension_);
+
+    // ray casting through the tree, only the edges whose box meets the horizontal ray are tested
+    const Ray3 ray(query, Point3(x[0] + 1.0, x[1], 0.0));
+    const UnsignedInteger intersections = edgesTree_.number_of_intersected_primitives(ray);
+    const Bool inside = (intersections % 2) == 1;
+    if (inside)
+      distance = -distance;
+    LOGDEBUG(OSS() << "query=" << Point(x, x + dimension_) << " closest=" << Point({closest[0], closest[1]}) << " intersections=" << intersections << " inside=" << inside << " dist=" << distance);
+    return distance;
+  }
+
+  Scalar computeDistance3(const Scalar * x,
+                          const UnsignedInteger i,
+                          const MeshDomain2Projection & projection) const
+  {
+    // distance to closest facet
+    const Point3 query(x[0], x[1], x[2]);
+    const auto closestAndPrimitive = facesTree_.closest_point_and_primitive(query);
+    const Point3 closest = closestAndPrimitive.first;
+    const Scalar distance = std::sqrt(CGAL::squared_distance(query, closest));
+    const Scalar closestCoordinates[3] = {closest[0], closest[1], closest[2]};
+    projection.set(i, closestCoordinates, faceFacets_[closestAndPrimitive.second.idx()], vertices_.getImplementation()->data(), boundary_, dimension_);
+
+    // check whether the point is inside/outside the mesh
+    const CGAL::Bounded_side side = (*insideTester_)(query);
+
+    LOGDEBUG(OSS() << "query=" << Point(x, x + dimension_) << " closest=" << Point({closest[0], closest[1], closest[2]}) << " inside=" << (side == CGAL::ON_BOUNDED_SIDE));
+    return (side == CGAL::ON_BOUNDED_SIDE) ? -distance : distance;
+  }
+
+  Scalar computeDistanceN(const Scalar * x,
+                          const UnsignedInteger i,
+                          const MeshDomain2Projection & projection) const
+  {
+    const Scalar * vertices = vertices_.getImplementation()->data();
+    const Point query(x, x + dimension_);
 
-    // we want to filter out internal facet
-    // external facets are only referenced by one cell
-    std::map<Indices, UnsignedInteger> facetMap;
-    for (UnsignedInteger i = 0; i < simplices.getSize(); ++ i)
+    // exact projection on the facet of the nearest centroid, then on the facets whose box is closer
+    std::vector<Scalar> closest(dimension_);
+    std::vector<Scalar> candidateClosest(dimension_);
+    const UnsignedInteger nearest = centroidsTree_.queryNearest(query, 1)[0];
+    UnsignedInteger closestFacet = nearest;
+    std::vector<UnsignedInteger> facet(boundary_.cbegin_at(nearest), boundary_.cbegin_at(nearest) + dimension_);
+    Scalar distance2 = SquaredDistanceToSimplex(x, vertices, facet, dimension_, closest.data());
+    const Indices candidates(facetsTree_.queryWithinDistance(query, std::sqrt(distance2)));
+    for (const UnsignedInteger f : candidates)
     {
-      const UnsignedInteger i0 = simplices(i, 0);
-      const UnsignedInteger i1 = simplices(i, 1);
-      const UnsignedInteger i2 = simplices(i, 2);
-      const UnsignedInteger i3 = simplices(i, 3);
-      Indices f1 = {i0, i1, i2};
-      Indices f2 = {i0, i1, i3};
-      Indices f3 = {i0, i2, i3};
-      Indices f4 = {i1, i2, i3};
-      std::sort(f1.begin(), f1.end());
-      std::sort(f2.begin(), f2.end());
-      std::sort(f3.begin(), f3.end());
-      std::sort(f4.begin(), f4.end());
-      ++ facetMap[f1];
-      ++ facetMap[f2];
-      ++ facetMap[f3];
-      ++ facetMap[f4];
+      if (f == nearest)
+        continue;
+      std::copy(boundary_.cbegin_at(f), boundary_.cbegin_at(f) + dimension_, facet.begin());
+      const Scalar candidateDistance2 = SquaredDistanceToSimplex(x, vertices, facet, dimension_, candidateClosest.data());
+      if (candidateDistance2 < distance2)
+      {
+        distance2 = candidateDistance2;
+        closestFacet = f;
+        closest.swap(candidateClosest);
+      }
     }
+    const Scalar distance = std::sqrt(distance2);
+    projection.set(i, closest.data(), closestFacet, vertices, boundary_, dimension_);
 
-    // build boundary mesh representation instead of triangle representation
-    // allows to use Side_of_triangle_mesh boundary point location
-    Mesh3 mesh3;
-    std::map<Point3, Mesh3::Vertex_index> vMap;
-    for (const auto & elt : facetMap)
+    // check whether the point is inside/outside the mesh, from the cells containing the point
+    Bool inside = false;
+    if (distance > 0.0)
     {
-      // check if external facet
-      if (elt.second == 1)
-      {
-        const UnsignedInteger i0 = elt.first[0];
-        const UnsignedInteger i1 = elt.first[1];
-        const UnsignedInteger i2 = elt.first[2];
+      const Indices candidateCells(cellsTree_.queryContaining(query));
+      for (UnsignedInteger j = 0; (j < candidateCells.getSize()) && !inside; ++ j)
+        inside = SimplexContains(x, vertices, &(*cells_.cbegin_at(candidateCells[j])), dimension_);
+    }
 
-        const Point3 v0{vertices(i0, 0), vertices(i0, 1), vertices(i0, 2)};
-        const Point3 v1{vertices(i1, 0), vertices(i1, 1), vertices(i1, 2)};
-        const Point3 v2{vertices(i2, 0), vertices(i2, 1), vertices(i2, 2)};
+    LOGDEBUG(OSS() << "query=" << query << " closest=" << Point(closest.begin(), closest.end()) << " inside=" << inside);
+    return inside ? -distance : distance;
+  }
 
-        // only add vertices of boundary facets
-        if (vMap.find(v0) == vMap.end())
-          vMap[v0] = mesh3.add_vertex(v0);
-        if (vMap.find(v1) == vMap.end())
-          vMap[v1] = mesh3.add_vertex(v1);
-        if (vMap.find(v2) == vMap.end())
-          vMap[v2] = mesh3.add_vertex(v2);
-
-        Mesh3::Vertex_index v[3] = {vMap[v0], vMap[v1], vMap[v2]};
-        auto f = mesh3.add_face(v[0], v[1], v[2]);
-
-        // check for non-manifold edge
-        if (f == Mesh3::null_face())
-          mesh3.add_face(v[0], v[2], v[1]);
-      }
-    }
-    if (!CGAL::is_closed(mesh3))
-      throw InternalException(HERE) << "MeshDomain2.computeDistance(3d): mesh should be closed";
+  // holds the vertex block read by the structures
+  const Sample vertices_;
+  const UnsignedInteger dimension_;
+  const IndicesCollection boundary_;
+  UnsignedInteger facetsNumber_ = 0;
+  PointWithDescription statistics_;
 
-    // build tree
-    Tree tree(mesh3.faces().begin(), mesh3.faces().end(), mesh3);
-    tree.accelerate_distance_queries();
+  // dimension 2: the lifted boundary edges
+  std::vector<Segment3> edges_;
+  EdgesTree edgesTree_;
 
-    // this is more robust than using simple ray intersection with AABB_tree
-    const Side_of_triangle_mesh insideTester(mesh3);
+  // dimension 3: the boundary surface, its tree and the inside tester reading it
+  Mesh3 mesh3_;
+  std::vector<UnsignedInteger> faceFacets_;
+  Bool closed_ = false;
+  FacesTree facesTree_;
+  std::unique_ptr<Side_of_triangle_mesh> insideTester_;
+
+  // other dimensions: the facet centroids, the boxes of the facets and the boxes of the cells
+  KDTree2 centroidsTree_;
+  BoundingBoxTree facetsTree_;
+  IndicesCollection cells_;
+  BoundingBoxTree cellsTree_;
+};
 
-    for (UnsignedInteger i = 0; i < size; ++ i)
+/* Signed distance of a batch of points from the search structures of the mesh */
+static Sample computeSignedDistance(const MeshDomain2Index & index,
+                                    const Scalar * points,
+                                    const UnsignedInteger size,
+                                    MeshingStatistics & statistics,
+                                    const MeshDomain2Projection & projection = MeshDomain2Projection())
+{
+  Sample distances(size, 1);
+  statistics.add(index.getStatistics());
+  if (size)
+  {
+    index.check();
+    MeshingTimer queryTimer(statistics, "queryTime");
+    const UnsignedInteger dimension = index.getDimension();
+    const auto query = [&](const UnsignedInteger i)
     {
-      // distance to closest facet
-      const Point3 query(points(i, 0), points(i, 1), points(i, 2));
-      const Point3 closest = tree.closest_point(query);
-      distances(i, 0) = std::sqrt(CGAL::squared_distance(query, closest));
+      return index.computeDistance(points + i * dimension, i, projection);
+    };
+    const MeshDomain2QueryPolicy<decltype(query)> policy(query, &distances(0, 0));
+    TBBImplementation::ParallelFor(0, size, policy);
+  }
+  statistics.add("queriesNumber", size);
+  return distances;
+}
 
-      // check whether the point is inside/outside the mesh
-      const CGAL::Bounded_side side = insideTester(query);
-      distances(i, 0) = (side == CGAL::ON_BOUNDED_SIDE) ? -distances(i, 0) : distances(i, 0);
+CLASSNAMEINIT(MeshDomain2)
+static const Factory<MeshDomain2> Factory_MeshDomain2;
 
-      LOGDEBUG(OSS() << "query=" << points[i] << " closest=" << Point({closest[0], closest[1], closest[2]}) << " inside=" << (side == CGAL::ON_BOUNDED_SIDE));
-    }
+
+/* Default constructor */
+MeshDomain2::MeshDomain2()
+  : MeshDomain()
+{
+  // Nothing to do
+}
+
+/* Parameters constructor */
+MeshDomain2::MeshDomain2(const OT::Mesh & mesh)
+: MeshDomain(mesh)
+{
+  initialize();
+}
+
+/* Virtual constructor */
+MeshDomain2 * MeshDomain2::clone() const
+{
+  return new MeshDomain2(*this);
+}
+
+/* Extract the boundary and build the search structures, shared by the copies of the domain */
+void MeshDomain2::initialize()
+{
+  const Mesh mesh(getMesh());
+  const Sample vertices(mesh.getVertices());
+  const IndicesCollection simplices(mesh.getSimplices());
+  const UnsignedInteger simplicesNumber = simplices.getSize();
+  const UnsignedInteger * simplicesData = simplicesNumber ? &(*simplices.cbegin_at(0)) : nullptr;
+  boundary_ = extractBoundaryFacets(simplicesData, simplicesNumber, getDimension());
+  index_ = new MeshDomain2Index(vertices, simplicesData, simplicesNumber, boundary_);
+}
+
+/* Compute the Euclidean distance from a given point to the domain */
+Scalar MeshDomain2::computeDistance(const Point & point) const
+{
+  return computeDistance(Sample(1, point))(0, 0);
+}
+
+Sample MeshDomain2::computeDistance(const Sample & points) const
+{
+  return computeDistance(points.getImplementation()->data(), points.getSize(), points.getDimension());
+}
+
+/* The points are read in place, row after row, without being copied into a Sample */
+Sample MeshDomain2::computeDistance(const Scalar * points, const UnsignedInteger size, const UnsignedInteger pointDimension) const
+{
+  const UnsignedInteger dimension = getDimension();
+  if (pointDimension != dimension)
+    throw InvalidArgumentException(HERE) << "Expected a point of dimension " << dimension << " got " << pointDimension;
+  if (index_.isNull())
+    throw NotDefinedException(HERE) << "MeshDomain2 is not built";
+  MeshingStatistics statistics;
+  const Sample distances(computeSignedDistance(*index_, points, size, statistics));
+  statistics.publish(statistics_);
+  return distances;
+}
+
+/* The closest points, facets and normals come from the same pass as the distances */
+Sample MeshDomain2::computeProjection(const Sample & points,
+                                      Sample & closestPoints,
+                                      Indices & facetIndices,
+                                      Sample & normals) const
+{
+  const UnsignedInteger dimension = getDimension();
+  if (points.getDimension() != dimension)
+    throw InvalidArgumentException(HERE) << "Expected a point of dimension " << dimension << " got " << points.getDimension();
+  const UnsignedInteger size = points.getSize();
+  closestPoints = Sample(size, dimension);
+  facetIndices = Indices(size);
+  normals = Sample(size, dimension);
+  MeshDomain2Projection projection;
+  if (size)
+  {
+    projection.closestPoints_ = &closestPoints(0, 0);
+    projection.facetIndices_ = &facetIndices[0];
+    projection.normals_ = &normals(0, 0);
   }
-  else
-    throw NotYetImplementedException(HERE) << "MeshDomain2 does not support dimension " << dimension;
+  if (index_.isNull())
+    throw NotDefinedException(HERE) << "MeshDomain2 is not built";
+  MeshingStatistics statistics;
+  const Sample distances(computeSignedDistance(*index_, points.getImplementation()->data(), size, statistics, projection));
+  statistics.publish(statistics_);
+  closestPoints.setDescription(getMesh().getVertices().getDescription());
   return distances;
 }
 
+/* Boundary facets accessor */
+Mesh MeshDomain2::getBoundary() const
+{
+  const UnsignedInteger dimension = getDimension();
+  // drop the opposite vertices
+  IndicesCollection boundary(boundary_.getSize(), dimension);
+  for (UnsignedInteger f = 0; f < boundary_.getSize(); ++ f)
+    std::copy(boundary_.cbegin_at(f), boundary_.cbegin_at(f) + dimension, &boundary(f, 0));
+  return Mesh(getMesh().getVertices(), boundary);
+}
+
+/* The 32-bit indices are read in place */
+Sample MeshDomain2::ComputeDistance(const CompactMesh & mesh, const Sample & points)
+{
+  const UnsignedInteger dimension = mesh.getDimension();
+  if (points.getDimension() != dimension)
+    throw InvalidArgumentException(HERE) << "Expected a point of dimension " << dimension << " got " << points.getDimension();
+  const Sample vertices(mesh.getVertices());
+  const IndicesCollection boundary(extractBoundaryFacets(mesh.getSimplicesData(), mesh.getSimplicesNumber(), dimension));
+  const MeshDomain2Index index(vertices, mesh.getSimplicesData(), mesh.getSimplicesNumber(), boundary);
+  MeshingStatistics statistics;
+  return computeSignedDistance(index, points.getImplementation()->data(), points.getSize(), statistics);
+}
+
+/* Statistics accessor */
+PointWithDescription MeshDomain2::getStatistics() const
+{
+  return MeshingStatistics::Read(statistics_);
+}
+
+/* Method load() reloads the object from the StorageManager */
+void MeshDomain2::load(Advocate & adv)
+{
+  MeshDomain::load(adv);
+  // the boundary and the search structures are rebuilt
+  initialize();
+}
+
 }
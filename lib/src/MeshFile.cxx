@@ -0,0 +1,442 @@
+//                                               -*- C++ -*-
+/**
+ *  @brief Memory-mapped binary mesh file
+ *
+ *  Copyright 2005-2026 Airbus-EDF-IMACS-ONERA-Phimeca
+ *
+ *  This library is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License
+ *  along with this library.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+#include "otmeshing/MeshFile.hxx"
+
+#include <openturns/PersistentObjectFactory.hxx>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <limits>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+using namespace OT;
+
+namespace OTMESHING
+{
+
+/* Fixed-size header, the blocks follow at 64-byte aligned offsets */
+struct MeshFileHeader
+{
+  char magic_[8];
+  // written as 0x01020304 so that a file of the other byte order is detected
+  std::uint32_t byteOrder_;
+  std::uint32_t version_;
+  std::uint64_t dimension_;
+  std::uint64_t verticesNumber_;
+  std::uint64_t simplicesNumber_;
+  std::uint64_t simplexSize_;
+  std::uint64_t indexSize_;
+  std::uint64_t verticesOffset_;
+  std::uint64_t simplicesOffset_;
+};
+
+static const char MeshFileMagic[8] = {'O', 'T', 'M', 'E', 'S', 'H', '\0', '\0'};
+static const std::uint32_t MeshFileByteOrder = 0x01020304;
+static const std::uint32_t MeshFileVersion = 1;
+static const std::uint64_t MeshFileAlignment = 64;
+
+static std::uint64_t AlignOffset(const std::uint64_t offset)
+{
+  return (offset + MeshFileAlignment - 1) / MeshFileAlignment * MeshFileAlignment;
+}
+
+/* Read-only mapping of the whole file */
+class MeshFileMapping
+{
+public:
+  explicit MeshFileMapping(const FileName & fileName)
+  {
+#ifdef _WIN32
+    file_ = CreateFileA(fileName.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+    if (file_ == INVALID_HANDLE_VALUE)
+      throw FileOpenException(HERE) << "Cannot open mesh file " << fileName;
+    LARGE_INTEGER fileSize;
+    if (!GetFileSizeEx(file_, &fileSize))
+    {
+      CloseHandle(file_);
+      throw FileOpenException(HERE) << "Cannot read the size of mesh file " << fileName;
+    }
+    size_ = fileSize.QuadPart;
+    if (size_ < sizeof(MeshFileHeader))
+    {
+      CloseHandle(file_);
+      throw InvalidArgumentException(HERE) << fileName << " is not a mesh file, size=" << size_;
+    }
+    handle_ = CreateFileMappingA(file_, NULL, PAGE_READONLY, 0, 0, NULL);
+    data_ = handle_ ? static_cast<const char *>(MapViewOfFile(handle_, FILE_MAP_READ, 0, 0, 0)) : nullptr;
+    if (!data_)
+    {
+      if (handle_)
+        CloseHandle(handle_);
+      CloseHandle(file_);
+      throw FileOpenException(HERE) << "Cannot map mesh file " << fileName;
+    }
+#else
+    const int fd = open(fileName.c_str(), O_RDONLY);
+    if (fd < 0)
+      throw FileOpenException(HERE) << "Cannot open mesh file " << fileName << ": " << std::strerror(errno);
+    struct stat status;
+    if (fstat(fd, &status) < 0)
+    {
+      close(fd);
+      throw FileOpenException(HERE) << "Cannot read the size of mesh file " << fileName;
+    }
+    size_ = status.st_size;
+    if (size_ < sizeof(MeshFileHeader))
+    {
+      close(fd);
+      throw InvalidArgumentException(HERE) << fileName << " is not a mesh file, size=" << size_;
+    }
+    void * address = mmap(nullptr, size_, PROT_READ, MAP_SHARED, fd, 0);
+    // the mapping stays valid once the descriptor is closed
+    close(fd);
+    if (address == MAP_FAILED)
+      throw FileOpenException(HERE) << "Cannot map mesh file " << fileName << ": " << std::strerror(errno);
+    data_ = static_cast<const char *>(address);
+#endif
+  }
+
+  ~MeshFileMapping()
+  {
+#ifdef _WIN32
+    UnmapViewOfFile(data_);
+    CloseHandle(handle_);
+    CloseHandle(file_);
+#else
+    munmap(const_cast<char *>(data_), size_);
+#endif
+  }
+
+  const char * data() const
+  {
+    return data_;
+  }
+
+  std::uint64_t getSize() const
+  {
+    return size_;
+  }
+
+  const MeshFileHeader & getHeader() const
+  {
+    return *reinterpret_cast<const MeshFileHeader *>(data_);
+  }
+
+private:
+  MeshFileMapping(const MeshFileMapping &) = delete;
+  MeshFileMapping & operator=(const MeshFileMapping &) = delete;
+
+  const char * data_ = nullptr;
+  std::uint64_t size_ = 0;
+#ifdef _WIN32
+  HANDLE file_ = INVALID_HANDLE_VALUE;
+  HANDLE handle_ = NULL;
+#endif
+};
+
+/* Write the indices by chunks converted to the file index type */
+template <class IndexType>
+void WriteIndices(std::ofstream & file, const UnsignedInteger * first, const UnsignedInteger count)
+{
+  const UnsignedInteger chunkSize = 1 << 16;
+  std::vector<IndexType> chunk(std::min(count, chunkSize));
+  for (UnsignedInteger start = 0; start < count; start += chunkSize)
+  {
+    const UnsignedInteger chunkCount = std::min(chunkSize, count - start);
+    std::transform(first + start, first + start + chunkCount, chunk.begin(),
+                   [](const UnsignedInteger index)
+    {
+      return static_cast<IndexType>(index);
+    });
+    file.write(reinterpret_cast<const char *>(chunk.data()), chunkCount * sizeof(IndexType));
+  }
+}
+
+template <class IndexType>
+void ReadIndices(const char * data, const UnsignedInteger count, UnsignedInteger * output)
+{
+  const IndexType * first = reinterpret_cast<const IndexType *>(data);
+  std::copy(first, first + count, output);
+}
+
+/* Whether all the indices are less than a bound */
+template <class IndexType>
+Bool CheckIndices(const char * data, const UnsignedInteger count, const std::uint64_t bound)
+{
+  const IndexType * first = reinterpret_cast<const IndexType *>(data);
+  return std::all_of(first, first + count, [bound](const IndexType index) {return index < bound;});
+}
+
+CLASSNAMEINIT(MeshFile)
+
+static Factory<MeshFile> Factory_MeshFile;
+
+
+/* Default constructor */
+MeshFile::MeshFile()
+  : PersistentObject()
+{
+  // Nothing to do
+}
+
+/* Map an existing file */
+MeshFile::MeshFile(const FileName & fileName)
+  : PersistentObject()
+  , fileName_(fileName)
+{
+  initialize();
+}
+
+/* Virtual constructor method */
+MeshFile * MeshFile::clone() const
+{
+  return new MeshFile(*this);
+}
+
+/* Map the file, check the header and the simplex indices, the vertices are not read */
+void MeshFile::initialize()
+{
+  const FileName fileName(fileName_);
+  Pointer<MeshFileMapping> mapping(new MeshFileMapping(fileName));
+  const MeshFileHeader & header = mapping->getHeader();
+  if (std::memcmp(header.magic_, MeshFileMagic, sizeof(MeshFileMagic)))
+    throw InvalidArgumentException(HERE) << fileName << " is not a mesh file";
+  if (header.byteOrder_ != MeshFileByteOrder)
+    throw InvalidArgumentException(HERE) << "Mesh file " << fileName << " was written with another byte order";
+  if (header.version_ != MeshFileVersion)
+    throw InvalidArgumentException(HERE) << "Unsupported mesh file version " << header.version_ << " in " << fileName;
+  if ((header.indexSize_ != sizeof(std::uint32_t)) && (header.indexSize_ != sizeof(std::uint64_t)))
+    throw InvalidArgumentException(HERE) << "Unsupported index size " << header.indexSize_ << " in " << fileName;
+  const std::uint64_t fileSize = mapping->getSize();
+  if (!header.dimension_ || (header.dimension_ > fileSize / sizeof(Scalar)))
+    throw InvalidArgumentException(HERE) << "Invalid dimension " << header.dimension_ << " in " << fileName;
+  if (header.simplexSize_ != header.dimension_ + 1)
+    throw InvalidArgumentException(HERE) << "Inconsistent simplex size " << header.simplexSize_ << " for dimension " << header.dimension_ << " in " << fileName;
+  // the counts are compared to the room left by divisions, a corrupted count cannot overflow the block ends
+  const std::uint64_t vertexBytes = header.dimension_ * sizeof(Scalar);
+  const std::uint64_t simplexBytes = header.simplexSize_ * header.indexSize_;
+  if ((header.verticesOffset_ % MeshFileAlignment) || (header.simplicesOffset_ % MeshFileAlignment)
+      || (header.verticesOffset_ < sizeof(MeshFileHeader)) || (header.simplicesOffset_ < header.verticesOffset_)
+      || (header.simplicesOffset_ > fileSize)
+      || (header.verticesNumber_ > (header.simplicesOffset_ - header.verticesOffset_) / vertexBytes)
+      || (header.simplicesNumber_ > (fileSize - header.simplicesOffset_) / simplexBytes))
+    throw InvalidArgumentException(HERE) << "Truncated or corrupted mesh file " << fileName;
+  // the simplices are read without any check afterwards, so a corrupted index is rejected here
+  const char * simplicesData = mapping->data() + header.simplicesOffset_;
+  const UnsignedInteger indicesNumber = header.simplicesNumber_ * header.simplexSize_;
+  const Bool validIndices = (header.indexSize_ == sizeof(std::uint32_t))
+                            ? CheckIndices<std::uint32_t>(simplicesData, indicesNumber, header.verticesNumber_)
+                            : CheckIndices<std::uint64_t>(simplicesData, indicesNumber, header.verticesNumber_);
+  if (!validIndices)
+    throw InvalidArgumentException(HERE) << "Simplex indices out of the " << header.verticesNumber_ << " vertices in mesh file " << fileName;
+  mapping_ = mapping;
+}
+
+/* Write a mesh */
+void MeshFile::Write(const Mesh & mesh,
+                     const FileName & fileName,
+                     const Bool compactIndices)
+{
+  const Sample vertices(mesh.getVertices());
+  const IndicesCollection simplices(mesh.getSimplices());
+  const UnsignedInteger dimension = mesh.getDimension();
+  const UnsignedInteger verticesNumber = vertices.getSize();
+  const UnsignedInteger simplicesNumber = simplices.getSize();
+  const UnsignedInteger simplexSize = dimension + 1;
+  if (simplicesNumber && (simplices.cend_at(simplicesNumber - 1) - simplices.cbegin_at(0) != static_cast<SignedInteger>(simplicesNumber * simplexSize)))
+    throw InvalidArgumentException(HERE) << "MeshFile expected simplices of size " << simplexSize;
+  if (compactIndices && (verticesNumber > std::numeric_limits<std::uint32_t>::max()))
+    throw InvalidArgumentException(HERE) << "MeshFile cannot store " << verticesNumber << " vertices with 32-bit indices";
+
+  MeshFileHeader header;
+  std::memcpy(header.magic_, MeshFileMagic, sizeof(MeshFileMagic));
+  header.byteOrder_ = MeshFileByteOrder;
+  header.version_ = MeshFileVersion;
+  header.dimension_ = dimension;
+  header.verticesNumber_ = verticesNumber;
+  header.simplicesNumber_ = simplicesNumber;
+  header.simplexSize_ = simplexSize;
+  header.indexSize_ = compactIndices ? sizeof(std::uint32_t) : sizeof(std::uint64_t);
+  header.verticesOffset_ = AlignOffset(sizeof(MeshFileHeader));
+  header.simplicesOffset_ = AlignOffset(header.verticesOffset_ + verticesNumber * dimension * sizeof(Scalar));
+
+  std::ofstream file(fileName.c_str(), std::ios::binary | std::ios::trunc);
+  if (!file)
+    throw FileOpenException(HERE) << "Cannot open mesh file " << fileName << " for writing";
+  const std::vector<char> padding(MeshFileAlignment, 0);
+  file.write(reinterpret_cast<const char *>(&header), sizeof(MeshFileHeader));
+  file.write(padding.data(), header.verticesOffset_ - sizeof(MeshFileHeader));
+  if (verticesNumber)
+    file.write(reinterpret_cast<const char *>(vertices.getImplementation()->data()), verticesNumber * dimension * sizeof(Scalar));
+  file.write(padding.data(), header.simplicesOffset_ - (header.verticesOffset_ + verticesNumber * dimension * sizeof(Scalar)));
+  if (simplicesNumber)
+  {
+    const UnsignedInteger * first = &(*simplices.cbegin_at(0));
+    if (compactIndices)
+      WriteIndices<std::uint32_t>(file, first, simplicesNumber * simplexSize);
+    else
+      WriteIndices<std::uint64_t>(file, first, simplicesNumber * simplexSize);
+  }
+  file.close();
+  if (!file)
+    throw InternalException(HERE) << "Error while writing mesh file " << fileName;
+}
+
+/* File name accessor */
+FileName MeshFile::getFileName() const
+{
+  return fileName_;
+}
+
+void MeshFile::checkMapped() const
+{
+  if (mapping_.isNull())
+    throw NotDefinedException(HERE) << "MeshFile is not mapped";
+}
+
+/* Header accessors */
+UnsignedInteger MeshFile::getDimension() const
+{
+  checkMapped();
+  return mapping_->getHeader().dimension_;
+}
+
+UnsignedInteger MeshFile::getVerticesNumber() const
+{
+  checkMapped();
+  return mapping_->getHeader().verticesNumber_;
+}
+
+UnsignedInteger MeshFile::getSimplicesNumber() const
+{
+  checkMapped();
+  return mapping_->getHeader().simplicesNumber_;
+}
+
+UnsignedInteger MeshFile::getIndexSize() const
+{
+  checkMapped();
+  return mapping_->getHeader().indexSize_;
+}
+
+/* Mapped blocks */
+const Scalar * MeshFile::getVerticesData() const
+{
+  checkMapped();
+  return reinterpret_cast<const Scalar *>(mapping_->data() + mapping_->getHeader().verticesOffset_);
+}
+
+const void * MeshFile::getSimplicesData() const
+{
+  checkMapped();
+  return mapping_->data() + mapping_->getHeader().simplicesOffset_;
+}
+
+/* Random access to the mapped blocks */
+Point MeshFile::getVertex(const UnsignedInteger index) const
+{
+  const UnsignedInteger dimension = getDimension();
+  if (index >= getVerticesNumber())
+    throw OutOfBoundException(HERE) << "Vertex index " << index << " must be less than " << getVerticesNumber();
+  const Scalar * first = getVerticesData() + index * dimension;
+  return Point(first, first + dimension);
+}
+
+Indices MeshFile::getSimplex(const UnsignedInteger index) const
+{
+  const UnsignedInteger simplexSize = getDimension() + 1;
+  if (index >= getSimplicesNumber())
+    throw OutOfBoundException(HERE) << "Simplex index " << index << " must be less than " << getSimplicesNumber();
+  const UnsignedInteger indexSize = getIndexSize();
+  const char * first = static_cast<const char *>(getSimplicesData()) + index * simplexSize * indexSize;
+  Indices simplex(simplexSize);
+  if (indexSize == sizeof(std::uint32_t))
+    ReadIndices<std::uint32_t>(first, simplexSize, &simplex[0]);
+  else
+    ReadIndices<std::uint64_t>(first, simplexSize, &simplex[0]);
+  return simplex;
+}
+
+/* Copy of the mapped blocks into a mesh, no parsing involved */
+Mesh MeshFile::getMesh() const
+{
+  const UnsignedInteger dimension = getDimension();
+  const UnsignedInteger verticesNumber = getVerticesNumber();
+  const UnsignedInteger simplicesNumber = getSimplicesNumber();
+  Sample vertices(verticesNumber, dimension);
+  if (verticesNumber)
+    std::copy(getVerticesData(), getVerticesData() + verticesNumber * dimension, &vertices(0, 0));
+  IndicesCollection simplices(simplicesNumber, dimension + 1);
+  if (simplicesNumber)
+  {
+    const char * data = static_cast<const char *>(getSimplicesData());
+    if (getIndexSize() == sizeof(std::uint32_t))
+      ReadIndices<std::uint32_t>(data, simplicesNumber * (dimension + 1), &simplices(0, 0));
+    else
+      ReadIndices<std::uint64_t>(data, simplicesNumber * (dimension + 1), &simplices(0, 0));
+  }
+  return Mesh(vertices, simplices);
+}
+
+/* String converter */
+String MeshFile::__repr__() const
+{
+  OSS oss(true);
+  oss << "class=" << MeshFile::GetClassName()
+      << " fileName=" << fileName_;
+  if (!mapping_.isNull())
+    oss << " dimension=" << getDimension()
+        << " vertices=" << getVerticesNumber()
+        << " simplices=" << getSimplicesNumber()
+        << " indexSize=" << getIndexSize();
+  return oss;
+}
+
+/* Method save() stores the object through the StorageManager */
+void MeshFile::save(Advocate & adv) const
+{
+  PersistentObject::save(adv);
+  adv.saveAttribute("fileName_", fileName_);
+}
+
+/* Method load() reloads the object from the StorageManager */
+void MeshFile::load(Advocate & adv)
+{
+  PersistentObject::load(adv);
+  adv.loadAttribute("fileName_", fileName_);
+  // only the file name is stored, the file is mapped again
+  mapping_.reset();
+  if (!fileName_.empty())
+    initialize();
+}
+
+} /* namespace OTMESHING */
@@ -0,0 +1,93 @@
+//                                               -*- C++ -*-
+/**
+ *  @brief Cancellation, time budget and progress of the builds
+ *
+ *  Copyright 2005-2026 Airbus-EDF-IMACS-ONERA-Phimeca
+ *
+ *  This library is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License
+ *  along with this library.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+#include "MeshingMonitor.hxx"
+
+#include <openturns/Exception.hxx>
+
+using namespace OT;
+
+namespace OTMESHING
+{
+
+MeshingMonitor::MeshingMonitor(const char * name,
+                               const CancellationToken & token,
+                               const Scalar maximumTimeDuration,
+                               const ProgressCallback callback,
+                               const ProgressCallbackState & state)
+  : name_(name)
+  , token_(token)
+  , maximumTimeDuration_(maximumTimeDuration)
+  , callback_(callback)
+  , state_(state)
+  , start_(std::chrono::steady_clock::now())
+{
+  // Nothing to do
+}
+
+void MeshingMonitor::setPhase(const char * phase, const Scalar start, const Scalar end)
+{
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    phase_ = phase;
+    phaseStart_ = start;
+    phaseEnd_ = end;
+    // always report the start of a phase
+    lastReported_ = -1.0;
+  }
+  progress(0.0);
+}
+
+void MeshingMonitor::progress(const Scalar fraction)
+{
+  if (callback_)
+    report(fraction);
+}
+
+void MeshingMonitor::report(const Scalar fraction)
+{
+  Scalar overall = 0.0;
+  const char * phase = nullptr;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    overall = phaseStart_ + std::min(std::max(fraction, 0.0), 1.0) * (phaseEnd_ - phaseStart_);
+    // every percent is enough for a progress bar
+    if ((lastReported_ >= 0.0) && (overall < lastReported_ + 0.01) && (overall < 1.0))
+      return;
+    lastReported_ = overall;
+    phase = phase_;
+  }
+  // a slow callback does not block the other threads
+  callback_(overall, phase, state_.get());
+}
+
+void MeshingMonitor::check() const
+{
+  if (token_.isCancelled())
+    throw InterruptionException(HERE) << CancellationToken::GetInterruptionPrefix() << name_ << " cancelled";
+  if (maximumTimeDuration_ > 0.0)
+  {
+    const Scalar elapsed = std::chrono::duration<Scalar>(std::chrono::steady_clock::now() - start_).count();
+    if (elapsed > maximumTimeDuration_)
+      throw InterruptionException(HERE) << CancellationToken::GetInterruptionPrefix() << name_ << " maximum time duration of " << maximumTimeDuration_ << "s exceeded after " << elapsed << "s";
+  }
+}
+
+}
@@ -0,0 +1,78 @@
+//                                               -*- C++ -*-
+/**
+ *  @brief Cancellation, time budget and progress of the builds
+ *
+ *  Copyright 2005-2026 Airbus-EDF-IMACS-ONERA-Phimeca
+ *
+ *  This library is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License
+ *  along with this library.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+#ifndef OTMESHING_MESHINGMONITOR_HXX
+#define OTMESHING_MESHINGMONITOR_HXX
+
+#include <chrono>
+#include <mutex>
+
+#include "otmeshing/CancellationToken.hxx"
+
+namespace OTMESHING
+{
+
+/**
+ * Watches a build: cancellation token, wall-clock budget and progress.
+ * A build is split into phases covering consecutive ranges of [0, 1], the
+ * progress inside a phase is mapped onto its range before being reported.
+ * Reports are throttled so that the callback can be called from loops, the
+ * throttling state is updated under a lock but the callback is called after
+ * releasing it, so a callback reached from worker threads must be thread-safe.
+ * The monitor keeps the callback state alive until the end of the build.
+ */
+class MeshingMonitor
+{
+public:
+  MeshingMonitor(const char * name,
+                 const CancellationToken & token,
+                 const OT::Scalar maximumTimeDuration,
+                 const ProgressCallback callback,
+                 const ProgressCallbackState & state);
+
+  /** Enter a phase covering the range [start, end] of the build */
+  void setPhase(const char * phase, const OT::Scalar start, const OT::Scalar end);
+
+  /** Progress in [0, 1] inside the current phase */
+  void progress(const OT::Scalar fraction);
+
+  /** Throws an InterruptionException if the token is cancelled or the budget is exhausted */
+  void check() const;
+
+private:
+  void report(const OT::Scalar fraction);
+
+  const char * name_;
+  CancellationToken token_;
+  OT::Scalar maximumTimeDuration_;
+  ProgressCallback callback_;
+  ProgressCallbackState state_;
+  std::chrono::steady_clock::time_point start_;
+
+  std::mutex mutex_;
+  const char * phase_ = "";
+  OT::Scalar phaseStart_ = 0.0;
+  OT::Scalar phaseEnd_ = 1.0;
+  OT::Scalar lastReported_ = -1.0;
+};
+
+}
+
+#endif /* OTMESHING_MESHINGMONITOR_HXX */
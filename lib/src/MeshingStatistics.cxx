@@ -0,0 +1,124 @@
+//                                               -*- C++ -*-
+/**
+ *  @brief Phase timings and counters of the meshers
+ *
+ *  Copyright 2005-2026 Airbus-EDF-IMACS-ONERA-Phimeca
+ *
+ *  This library is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License
+ *  along with this library.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+#include "MeshingStatistics.hxx"
+
+#include <openturns/ResourceMap.hxx>
+
+#include <mutex>
+
+#ifdef _WIN32
+#include <windows.h>
+#include <psapi.h>
+#else
+#include <sys/resource.h>
+#endif
+
+using namespace OT;
+
+namespace OTMESHING
+{
+
+static std::mutex MeshingStatisticsMutex;
+
+/* Registers the default values of the keys of the module when the library is loaded */
+static const struct MeshingStatisticsResourceMapInit
+{
+  MeshingStatisticsResourceMapInit()
+  {
+    if (!ResourceMap::HasKey("MeshingStatistics-Enabled"))
+      ResourceMap::AddAsBool("MeshingStatistics-Enabled", false);
+  }
+} MeshingStatisticsResourceMapInit_;
+
+Bool MeshingStatistics::IsEnabled()
+{
+  return ResourceMap::GetAsBool("MeshingStatistics-Enabled");
+}
+
+UnsignedInteger MeshingStatistics::PeakMemory()
+{
+#ifdef _WIN32
+  PROCESS_MEMORY_COUNTERS counters;
+  if (!GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)))
+    return 0;
+  return counters.PeakWorkingSetSize;
+#else
+  struct rusage usage;
+  if (getrusage(RUSAGE_SELF, &usage))
+    return 0;
+#ifdef __APPLE__
+  // bytes on macOS, kilobytes elsewhere
+  return usage.ru_maxrss;
+#else
+  return 1024 * static_cast<UnsignedInteger>(usage.ru_maxrss);
+#endif
+#endif
+}
+
+MeshingStatistics::MeshingStatistics()
+  : enabled_(IsEnabled())
+{
+  // Nothing to do
+}
+
+void MeshingStatistics::add(const PointWithDescription & other)
+{
+  if (!enabled_)
+    return;
+  const Description names(other.getDescription());
+  for (UnsignedInteger i = 0; i < other.getDimension(); ++ i)
+    addValue(names[i], other[i]);
+}
+
+void MeshingStatistics::addValue(const String & name, const Scalar value)
+{
+  // few entries, insertion order is kept
+  for (UnsignedInteger i = 0; i < names_.getSize(); ++ i)
+    if (names_[i] == name)
+    {
+      values_[i] += value;
+      return;
+    }
+  names_.add(name);
+  values_.add(value);
+}
+
+PointWithDescription MeshingStatistics::getStatistics() const
+{
+  PointWithDescription result(values_);
+  result.setDescription(names_);
+  return result;
+}
+
+void MeshingStatistics::publish(PointWithDescription & shared) const
+{
+  const PointWithDescription statistics(getStatistics());
+  std::lock_guard<std::mutex> lock(MeshingStatisticsMutex);
+  shared = statistics;
+}
+
+PointWithDescription MeshingStatistics::Read(const PointWithDescription & shared)
+{
+  std::lock_guard<std::mutex> lock(MeshingStatisticsMutex);
+  return shared;
+}
+
+}
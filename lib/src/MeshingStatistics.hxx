@@ -0,0 +1,123 @@
+//                                               -*- C++ -*-
+/**
+ *  @brief Phase timings and counters of the meshers
+ *
+ *  Copyright 2005-2026 Airbus-EDF-IMACS-ONERA-Phimeca
+ *
+ *  This library is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License
+ *  along with this library.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+#ifndef OTMESHING_MESHINGSTATISTICS_HXX
+#define OTMESHING_MESHINGSTATISTICS_HXX
+
+#include <chrono>
+
+#include <openturns/PointWithDescription.hxx>
+
+namespace OTMESHING
+{
+
+/**
+ * Phase wall-times and counters recorded by a mesher during a build.
+ * Recording is switched on by the MeshingStatistics-Enabled ResourceMap key,
+ * registered as false when the library is loaded, otherwise every call
+ * reduces to a flag test.
+ * The meshers keep the record of their last build in a mutable member, which
+ * is only accessed through publish() and Read() so that concurrent builds on
+ * the same instance are safe (the record then comes from one of them).
+ */
+class MeshingStatistics
+{
+public:
+  /** Value of the MeshingStatistics-Enabled key, false by default */
+  static OT::Bool IsEnabled();
+
+  /** High-water mark of the resident memory of the process in bytes since it started, zero when unavailable.
+      It is not reset between builds, so it only bounds the memory of a given build from above */
+  static OT::UnsignedInteger PeakMemory();
+
+  /** Empty record */
+  MeshingStatistics();
+
+  OT::Bool isEnabled() const
+  {
+    return enabled_;
+  }
+
+  /** Add a value to a counter or a phase time */
+  void add(const char * name, const OT::Scalar value)
+  {
+    if (enabled_)
+      addValue(name, value);
+  }
+
+  /** Add the values of another record, eg from a nested mesher */
+  void add(const OT::PointWithDescription & other);
+
+  /** Recorded values, empty when disabled */
+  OT::PointWithDescription getStatistics() const;
+
+  /** Copy the recorded values to the member of a mesher, which may be read by other threads */
+  void publish(OT::PointWithDescription & shared) const;
+
+  /** Read the member of a mesher */
+  static OT::PointWithDescription Read(const OT::PointWithDescription & shared);
+
+private:
+  void addValue(const OT::String & name, const OT::Scalar value);
+
+  OT::Bool enabled_ = false;
+  OT::Description names_;
+  OT::Point values_;
+};
+
+/**
+ * Adds the wall-time of a scope to a phase of a record
+ */
+class MeshingTimer
+{
+public:
+  MeshingTimer(MeshingStatistics & statistics, const char * name)
+    : statistics_(statistics)
+    , name_(name)
+    , running_(statistics.isEnabled())
+  {
+    if (running_)
+      start_ = std::chrono::steady_clock::now();
+  }
+
+  ~MeshingTimer()
+  {
+    stop();
+  }
+
+  /** Record the elapsed time before the end of the scope */
+  void stop()
+  {
+    if (!running_)
+      return;
+    running_ = false;
+    statistics_.add(name_, std::chrono::duration<OT::Scalar>(std::chrono::steady_clock::now() - start_).count());
+  }
+
+private:
+  MeshingStatistics & statistics_;
+  const char * name_;
+  OT::Bool running_;
+  std::chrono::steady_clock::time_point start_;
+};
+
+}
+
+#endif /* OTMESHING_MESHINGSTATISTICS_HXX */
@@ -0,0 +1,489 @@
+//                                               -*- C++ -*-
+/**
+ *  @brief Batch point location in a mesh
+ *
+ *  Copyright 2005-2026 Airbus-EDF-IMACS-ONERA-Phimeca
+ *
+ *  This library is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License
+ *  along with this library.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+#include "otmeshing/PointLocator.hxx"
+
+#include <openturns/PersistentObjectFactory.hxx>
+#include <openturns/SpecFunc.hxx>
+#include <openturns/TBBImplementation.hxx>
+
+#include <cmath>
+#include <limits>
+#include <numeric>
+
+using namespace OT;
+
+namespace OTMESHING
+{
+
+/* Gauss-Jordan inversion with partial pivoting of a small row-major matrix, false when it is singular */
+static Bool InvertMatrix(std::vector<Scalar> & a, Scalar * inverse, const UnsignedInteger dimension)
+{
+  Scalar scale = 0.0;
+  for (UnsignedInteger k = 0; k < dimension * dimension; ++ k)
+    scale = std::max(scale, std::abs(a[k]));
+  const Scalar tolerance = SpecFunc::ScalarEpsilon * dimension * scale;
+  std::fill(inverse, inverse + dimension * dimension, 0.0);
+  for (UnsignedInteger k = 0; k < dimension; ++ k)
+    inverse[k * dimension + k] = 1.0;
+  for (UnsignedInteger j = 0; j < dimension; ++ j)
+  {
+    UnsignedInteger pivot = j;
+    for (UnsignedInteger i = j + 1; i < dimension; ++ i)
+      if (std::abs(a[i * dimension + j]) > std::abs(a[pivot * dimension + j]))
+        pivot = i;
+    if (!(std::abs(a[pivot * dimension + j]) > tolerance))
+      return false;
+    if (pivot != j)
+      for (UnsignedInteger l = 0; l < dimension; ++ l)
+      {
+        std::swap(a[pivot * dimension + l], a[j * dimension + l]);
+        std::swap(inverse[pivot * dimension + l], inverse[j * dimension + l]);
+      }
+    const Scalar factor = 1.0 / a[j * dimension + j];
+    for (UnsignedInteger l = 0; l < dimension; ++ l)
+    {
+      a[j * dimension + l] *= factor;
+      inverse[j * dimension + l] *= factor;
+    }
+    for (UnsignedInteger i = 0; i < dimension; ++ i)
+    {
+      const Scalar f = a[i * dimension + j];
+      if ((i == j) || (f == 0.0))
+        continue;
+      for (UnsignedInteger l = 0; l < dimension; ++ l)
+      {
+        a[i * dimension + l] -= f * a[j * dimension + l];
+        inverse[i * dimension + l] -= f * inverse[j * dimension + l];
+      }
+    }
+  }
+  return true;
+}
+
+/* The barycentric coordinates of a point are an affine function of the point in each simplex */
+struct PointLocatorInversePolicy
+{
+  const Sample & vertices_;
+  const IndicesCollection & simplices_;
+  Scalar * inverses_;
+  Indices & flat_;
+
+  PointLocatorInversePolicy(const Sample & vertices,
+                            const IndicesCollection & simplices,
+                            Scalar * inverses,
+                            Indices & flat)
+    : vertices_(vertices)
+    , simplices_(simplices)
+    , inverses_(inverses)
+    , flat_(flat)
+  {}
+
+  inline void operator()(const TBBImplementation::BlockedRange<UnsignedInteger> & r) const
+  {
+    const UnsignedInteger dimension = vertices_.getDimension();
+    std::vector<Scalar> edges(dimension * dimension);
+    for (UnsignedInteger i = r.begin(); i != r.end(); ++ i)
+    {
+      // column l is the edge from the first vertex to the vertex l + 1
+      const UnsignedInteger origin = simplices_(i, 0);
+      for (UnsignedInteger l = 0; l < dimension; ++ l)
+        for (UnsignedInteger k = 0; k < dimension; ++ k)
+          edges[k * dimension + l] = vertices_(simplices_(i, l + 1), k) - vertices_(origin, k);
+      flat_[i] = !InvertMatrix(edges, inverses_ + i * dimension * dimension, dimension);
+    }
+  }
+}; /* end struct PointLocatorInversePolicy */
+
+/* Copy of a row of a sample */
+static Point RowToPoint(const Scalar * x, const UnsignedInteger dimension)
+{
+  Point point(dimension);
+  std::copy(x, x + dimension, point.begin());
+  return point;
+}
+
+/* Interleaved bits of the quantized coordinates, close codes are close points */
+static UnsignedInteger MortonCode(const Scalar * x, const Point & lowerBound, const Point & upperBound)
+{
+  const UnsignedInteger dimension = lowerBound.getDimension();
+  const UnsignedInteger bits = std::max<UnsignedInteger>(1, std::min<UnsignedInteger>(20, 63 / dimension));
+  const Scalar levels = (1 << bits) - 1.0;
+  std::vector<UnsignedInteger> quantized(dimension);
+  for (UnsignedInteger k = 0; k < dimension; ++ k)
+  {
+    const Scalar range = upperBound[k] - lowerBound[k];
+    const Scalar t = (range > 0.0) ? (x[k] - lowerBound[k]) / range : 0.0;
+    quantized[k] = static_cast<UnsignedInteger>(std::min(std::max(t, 0.0), 1.0) * levels);
+  }
+  UnsignedInteger code = 0;
+  for (SignedInteger b = bits - 1; b >= 0; -- b)
+    for (UnsignedInteger k = 0; k < dimension; ++ k)
+      code = (code << 1) | ((quantized[k] >> b) & 1);
+  return code;
+}
+
+/* Each block of consecutive points along the curve is located sequentially, a walk starting from the simplex of the previous point */
+struct PointLocatorPolicy
+{
+  const Sample & vertices_;
+  const IndicesCollection & simplices_;
+  const Scalar * inverses_;
+  const Indices & flat_;
+  const IndicesCollection & neighbours_;
+  const Indices & vertexSimplex_;
+  const KDTree2 & verticesTree_;
+  const BoundingBoxTree & boxTree_;
+  const Scalar epsilon_;
+  const Sample & sample_;
+  const Indices & order_;
+  Indices & output_;
+  Scalar * coordinates_;
+  const UnsignedInteger maximumSteps_;
+
+  PointLocatorPolicy(const Sample & vertices,
+                     const IndicesCollection & simplices,
+                     const Scalar * inverses,
+                     const Indices & flat,
+                     const IndicesCollection & neighbours,
+                     const Indices & vertexSimplex,
+                     const KDTree2 & verticesTree,
+                     const BoundingBoxTree & boxTree,
+                     const Scalar epsilon,
+                     const Sample & sample,
+                     const Indices & order,
+                     Indices & output,
+                     Scalar * coordinates)
+    : vertices_(vertices)
+    , simplices_(simplices)
+    , inverses_(inverses)
+    , flat_(flat)
+    , neighbours_(neighbours)
+    , vertexSimplex_(vertexSimplex)
+    , verticesTree_(verticesTree)
+    , boxTree_(boxTree)
+    , epsilon_(epsilon)
+    , sample_(sample)
+    , order_(order)
+    , output_(output)
+    , coordinates_(coordinates)
+    // walks may cycle in non-Delaunay meshes, a long walk is left to the tree
+    , maximumSteps_(16 + 4 * static_cast<UnsignedInteger>(std::pow(1.0 * simplices.getSize(), 1.0 / vertices.getDimension())))
+  {}
+
+  /* Barycentric coordinates in a simplex, the index of the smallest one */
+  UnsignedInteger computeCoordinates(const UnsignedInteger simplex, const Scalar * x, Scalar * lambda) const
+  {
+    const UnsignedInteger dimension = vertices_.getDimension();
+    const UnsignedInteger origin = simplices_(simplex, 0);
+    const Scalar * inverse = inverses_ + simplex * dimension * dimension;
+    lambda[0] = 1.0;
+    UnsignedInteger smallest = 0;
+    for (UnsignedInteger l = 0; l < dimension; ++ l)
+    {
+      Scalar value = 0.0;
+      for (UnsignedInteger k = 0; k < dimension; ++ k)
+        value += inverse[l * dimension + k] * (x[k] - vertices_(origin, k));
+      lambda[l + 1] = value;
+      lambda[0] -= value;
+    }
+    for (UnsignedInteger j = 1; j <= dimension; ++ j)
+      if (lambda[j] < lambda[smallest])
+        smallest = j;
+    return smallest;
+  }
+
+  /* Visibility walk, crossing the facet of the most negative coordinate */
+  UnsignedInteger walk(const Scalar * x, UnsignedInteger & simplex, Scalar * lambda) const
+  {
+    const UnsignedInteger simplicesNumber = simplices_.getSize();
+    for (UnsignedInteger step = 0; step < maximumSteps_; ++ step)
+    {
+      if (flat_[simplex])
+        return simplicesNumber;
+      const UnsignedInteger smallest = computeCoordinates(simplex, x, lambda);
+      if (lambda[smallest] >= -epsilon_)
+        return simplex;
+      const UnsignedInteger next = neighbours_(simplex, smallest);
+      if (next == simplicesNumber)
+        return simplicesNumber;
+      simplex = next;
+    }
+    return simplicesNumber;
+  }
+
+  /* Exhaustive test of the simplices whose box contains the point */
+  UnsignedInteger search(const Scalar * x, Scalar * lambda) const
+  {
+    const UnsignedInteger dimension = vertices_.getDimension();
+    const Indices candidates(boxTree_.queryContaining(RowToPoint(x, dimension)));
+    for (UnsignedInteger i = 0; i < candidates.getSize(); ++ i)
+      if (!flat_[candidates[i]] && (lambda[computeCoordinates(candidates[i], x, lambda)] >= -epsilon_))
+        return candidates[i];
+    return simplices_.getSize();
+  }
+
+  inline void operator()(const TBBImplementation::BlockedRange<UnsignedInteger> & r) const
+  {
+    const UnsignedInteger dimension = vertices_.getDimension();
+    const UnsignedInteger simplicesNumber = simplices_.getSize();
+    std::vector<Scalar> lambda(dimension + 1);
+    UnsignedInteger hint = simplicesNumber;
+    for (UnsignedInteger i = r.begin(); i != r.end(); ++ i)
+    {
+      const UnsignedInteger index = order_[i];
+      const Scalar * x = &sample_(index, 0);
+      if (hint == simplicesNumber)
+      {
+        hint = vertexSimplex_[verticesTree_.queryNearest(RowToPoint(x, dimension), 1)[0]];
+        if (hint == simplicesNumber)
+          hint = 0;
+      }
+      UnsignedInteger simplex = walk(x, hint, lambda.data());
+      if (simplex == simplicesNumber)
+        simplex = search(x, lambda.data());
+      if (simplex != simplicesNumber)
+        hint = simplex;
+      else if (flat_[hint])
+        hint = simplicesNumber;
+      output_[index] = simplex;
+      if (coordinates_)
+      {
+        Scalar * row = coordinates_ + index * (dimension + 1);
+        if (simplex != simplicesNumber)
+          std::copy(lambda.begin(), lambda.end(), row);
+        else
+          std::fill(row, row + dimension + 1, 0.0);
+      }
+    }
+  }
+}; /* end struct PointLocatorPolicy */
+
+CLASSNAMEINIT(PointLocator)
+
+static Factory<PointLocator> Factory_PointLocator;
+
+
+/* Default constructor */
+PointLocator::PointLocator()
+  : PersistentObject()
+{
+  // Nothing to do
+}
+
+/* Parameters constructor */
+PointLocator::PointLocator(const Mesh & mesh)
+  : PersistentObject()
+  , mesh_(mesh)
+{
+  initialize();
+}
+
+/* Virtual constructor method */
+PointLocator * PointLocator::clone() const
+{
+  return new PointLocator(*this);
+}
+
+/* Compute the affine maps, the adjacency and the trees */
+void PointLocator::initialize()
+{
+  const UnsignedInteger dimension = mesh_.getDimension();
+  const UnsignedInteger simplicesNumber = mesh_.getSimplicesNumber();
+  if (!simplicesNumber)
+    throw InvalidArgumentException(HERE) << "PointLocator expected a mesh with simplices";
+  if (mesh_.getIntrinsicDimension() != dimension)
+    throw InvalidArgumentException(HERE) << "PointLocator expected a volumetric mesh, here got dimension=" << dimension << " and intrinsicDimension=" << mesh_.getIntrinsicDimension();
+  const Sample vertices(mesh_.getVertices());
+  const IndicesCollection simplices(mesh_.getSimplices());
+
+  inverses_ = Sample(simplicesNumber, dimension * dimension);
+  flat_ = Indices(simplicesNumber);
+  const PointLocatorInversePolicy inversePolicy(vertices, simplices, &inverses_(0, 0), flat_);
+  TBBImplementation::ParallelFor(0, simplicesNumber, inversePolicy);
+
+  // sorted facet keys, the two sides of an interior facet end up consecutive
+  const UnsignedInteger facetsNumber = simplicesNumber * (dimension + 1);
+  std::vector<UnsignedInteger> keys(facetsNumber * dimension);
+  for (UnsignedInteger i = 0; i < simplicesNumber; ++ i)
+    for (UnsignedInteger j = 0; j <= dimension; ++ j)
+    {
+      UnsignedInteger * key = &keys[(i * (dimension + 1) + j) * dimension];
+      UnsignedInteger l = 0;
+      for (UnsignedInteger m = 0; m <= dimension; ++ m)
+        if (m != j)
+          key[l++] = simplices(i, m);
+      std::sort(key, key + dimension);
+    }
+  std::vector<UnsignedInteger> order(facetsNumber);
+  std::iota(order.begin(), order.end(), 0);
+  const UnsignedInteger * keysData = keys.data();
+  std::sort(order.begin(), order.end(), [keysData, dimension](const UnsignedInteger a, const UnsignedInteger b)
+  {
+    return std::lexicographical_compare(keysData + a * dimension, keysData + (a + 1) * dimension,
+                                        keysData + b * dimension, keysData + (b + 1) * dimension);
+  });
+  neighbours_ = IndicesCollection(simplicesNumber, dimension + 1);
+  std::fill(&neighbours_(0, 0), &neighbours_(0, 0) + facetsNumber, simplicesNumber);
+  for (UnsignedInteger f = 0; f + 1 < facetsNumber; ++ f)
+  {
+    const UnsignedInteger a = order[f];
+    const UnsignedInteger b = order[f + 1];
+    if (std::equal(keysData + a * dimension, keysData + (a + 1) * dimension, keysData + b * dimension))
+    {
+      neighbours_(a / (dimension + 1), a % (dimension + 1)) = b / (dimension + 1);
+      neighbours_(b / (dimension + 1), b % (dimension + 1)) = a / (dimension + 1);
+      // a non-manifold facet only links its first two sides
+      ++ f;
+    }
+  }
+
+  vertexSimplex_ = Indices(vertices.getSize(), simplicesNumber);
+  for (UnsignedInteger i = 0; i < simplicesNumber; ++ i)
+    if (!flat_[i])
+      for (IndicesCollection::const_iterator it = simplices.cbegin_at(i); it != simplices.cend_at(i); ++ it)
+        if (vertexSimplex_[*it] == simplicesNumber)
+          vertexSimplex_[*it] = i;
+  verticesTree_ = KDTree2(vertices);
+  boxTree_ = BoundingBoxTree(mesh_);
+  lowerBound_ = vertices.getMin();
+  upperBound_ = vertices.getMax();
+}
+
+/* Indexed mesh accessor */
+Mesh PointLocator::getMesh() const
+{
+  return mesh_;
+}
+
+/* Index of the simplex containing the point */
+UnsignedInteger PointLocator::query(const Point & x) const
+{
+  return query(Sample(1, x))[0];
+}
+
+Indices PointLocator::query(const Sample & sample) const
+{
+  Sample barycentricCoordinates;
+  return query(sample, barycentricCoordinates);
+}
+
+Indices PointLocator::query(const Sample & sample, Sample & barycentricCoordinates) const
+{
+  const UnsignedInteger dimension = mesh_.getDimension();
+  if (sample.getDimension() != dimension)
+    throw InvalidArgumentException(HERE) << "PointLocator expected points of dimension " << dimension << " got " << sample.getDimension();
+  const UnsignedInteger size = sample.getSize();
+  barycentricCoordinates = Sample(size, dimension + 1);
+  Indices result(size);
+  if (!size)
+    return result;
+
+  // spatially coherent order, consecutive points are located from each other
+  std::vector<std::pair<UnsignedInteger, UnsignedInteger> > codes(size);
+  for (UnsignedInteger i = 0; i < size; ++ i)
+    codes[i] = std::make_pair(MortonCode(&sample(i, 0), lowerBound_, upperBound_), i);
+  std::sort(codes.begin(), codes.end());
+  Indices order(size);
+  for (UnsignedInteger i = 0; i < size; ++ i)
+    order[i] = codes[i].second;
+
+  const Sample vertices(mesh_.getVertices());
+  const IndicesCollection simplices(mesh_.getSimplices());
+  const PointLocatorPolicy policy(vertices, simplices, &inverses_(0, 0), flat_, neighbours_, vertexSimplex_,
+                                  verticesTree_, boxTree_, barycentricCoordinatesEpsilon_, sample, order, result, &barycentricCoordinates(0, 0));
+  TBBImplementation::ParallelFor(0, size, policy);
+  return result;
+}
+
+/* Barycentric interpolation of values given at the vertices */
+Sample PointLocator::interpolate(const Sample & vertexValues, const Sample & sample) const
+{
+  if (vertexValues.getSize() != mesh_.getVerticesNumber())
+    throw InvalidArgumentException(HERE) << "PointLocator expected one value per vertex, got " << vertexValues.getSize() << " values for " << mesh_.getVerticesNumber() << " vertices";
+  Sample barycentricCoordinates;
+  const Indices simplexIndices(query(sample, barycentricCoordinates));
+  const UnsignedInteger simplicesNumber = mesh_.getSimplicesNumber();
+  const IndicesCollection simplices(mesh_.getSimplices());
+  const UnsignedInteger outputDimension = vertexValues.getDimension();
+  Sample result(sample.getSize(), outputDimension);
+  for (UnsignedInteger i = 0; i < sample.getSize(); ++ i)
+  {
+    const UnsignedInteger simplex = simplexIndices[i];
+    for (UnsignedInteger p = 0; p < outputDimension; ++ p)
+    {
+      if (simplex == simplicesNumber)
+      {
+        result(i, p) = std::numeric_limits<Scalar>::quiet_NaN();
+        continue;
+      }
+      Scalar value = 0.0;
+      for (UnsignedInteger j = 0; j < barycentricCoordinates.getDimension(); ++ j)
+        value += barycentricCoordinates(i, j) * vertexValues(simplices(simplex, j), p);
+      result(i, p) = value;
+    }
+  }
+  result.setDescription(vertexValues.getDescription());
+  return result;
+}
+
+/* Barycentric coordinates tolerance accessor */
+void PointLocator::setBarycentricCoordinatesEpsilon(const Scalar barycentricCoordinatesEpsilon)
+{
+  if (!(barycentricCoordinatesEpsilon >= 0.0))
+    throw InvalidArgumentException(HERE) << "Barycentric coordinates epsilon must be positive, here epsilon=" << barycentricCoordinatesEpsilon;
+  barycentricCoordinatesEpsilon_ = barycentricCoordinatesEpsilon;
+}
+
+Scalar PointLocator::getBarycentricCoordinatesEpsilon() const
+{
+  return barycentricCoordinatesEpsilon_;
+}
+
+/* String converter */
+String PointLocator::__repr__() const
+{
+  OSS oss(true);
+  oss << "class=" << PointLocator::GetClassName()
+      << " simplices=" << mesh_.getSimplicesNumber()
+      << " barycentricCoordinatesEpsilon=" << barycentricCoordinatesEpsilon_;
+  return oss;
+}
+
+/* Method save() stores the object through the StorageManager */
+void PointLocator::save(Advocate & adv) const
+{
+  PersistentObject::save(adv);
+  adv.saveAttribute("mesh_", mesh_);
+  adv.saveAttribute("barycentricCoordinatesEpsilon_", barycentricCoordinatesEpsilon_);
+}
+
+/* Method load() reloads the object from the StorageManager */
+void PointLocator::load(Advocate & adv)
+{
+  PersistentObject::load(adv);
+  adv.loadAttribute("mesh_", mesh_);
+  adv.loadAttribute("barycentricCoordinatesEpsilon_", barycentricCoordinatesEpsilon_);
+  // the affine maps, the adjacency and the trees are rebuilt
+  if (mesh_.getSimplicesNumber())
+    initialize();
+}
+
+} /* namespace OTMESHING */
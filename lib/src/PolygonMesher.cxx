@@ -21,29 +21,218 @@
 #include "openturns/PersistentObjectFactory.hxx"
 #include "otmeshing/PolygonMesher.hxx"
 
+#include <openturns/TBBImplementation.hxx>
+
 #include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
-#include <CGAL/Polygon_2.h>
-#include <CGAL/Polygon_triangulation_decomposition_2.h>
+#include <CGAL/Constrained_Delaunay_triangulation_2.h>
+#include <CGAL/Triangulation_vertex_base_with_info_2.h>
+#include <CGAL/Triangulation_face_base_with_info_2.h>
+
+#include <list>
 
+#include "MeshingStatistics.hxx"
 
 using KernelInexact = CGAL::Exact_predicates_inexact_constructions_kernel;
 using Point_2 = CGAL::Point_2<KernelInexact>;
-using Polygon_2 = CGAL::Polygon_2<KernelInexact>;
 
-struct Point2Hash
+/* Nesting level of the faces, odd levels are inside the domain */
+struct FaceInfo2
 {
-    std::size_t operator()(const Point_2& p) const
-    {
-        std::hash<double> h;
-        return h(p.x()) ^ (h(p.y()) << 1);
-    }
+  int nesting_level = -1;
+  bool in_domain() const
+  {
+    return nesting_level % 2 == 1;
+  }
 };
 
+// the vertices carry their input index
+using Vb = CGAL::Triangulation_vertex_base_with_info_2<OT::UnsignedInteger, KernelInexact>;
+using Fbb = CGAL::Triangulation_face_base_with_info_2<FaceInfo2, KernelInexact>;
+using Fb = CGAL::Constrained_triangulation_face_base_2<KernelInexact, Fbb>;
+using TDS = CGAL::Triangulation_data_structure_2<Vb, Fb>;
+using CDT = CGAL::Constrained_Delaunay_triangulation_2<KernelInexact, TDS>;
+
 using namespace OT;
 
 namespace OTMESHING
 {
 
+/* Flood the faces reachable without crossing a constraint */
+static void markDomain(CDT & cdt, CDT::Face_handle start, const int index, std::list<CDT::Edge> & border)
+{
+  if (start->info().nesting_level != -1)
+    return;
+  std::list<CDT::Face_handle> queue;
+  queue.push_back(start);
+  while (!queue.empty())
+  {
+    CDT::Face_handle fh = queue.front();
+    queue.pop_front();
+    if (fh->info().nesting_level == -1)
+    {
+      fh->info().nesting_level = index;
+      for (int i = 0; i < 3; ++ i)
+      {
+        const CDT::Edge e(fh, i);
+        CDT::Face_handle n = fh->neighbor(i);
+        if (n->info().nesting_level == -1)
+        {
+          if (cdt.is_constrained(e))
+            border.push_back(e);
+          else
+            queue.push_back(n);
+        }
+      }
+    }
+  }
+}
+
+/* Nesting level of each face, starting from the infinite face */
+static void markDomains(CDT & cdt)
+{
+  std::list<CDT::Edge> border;
+  markDomain(cdt, cdt.infinite_face(), 0, border);
+  while (!border.empty())
+  {
+    const CDT::Edge e = border.front();
+    border.pop_front();
+    CDT::Face_handle n = e.first->neighbor(e.second);
+    if (n->info().nesting_level == -1)
+      markDomain(cdt, n, e.first->info().nesting_level + 1, border);
+  }
+}
+
+/* Components spanned by the polygon */
+static Indices computeIntrinsicComponents(const Sample & points)
+{
+  const UnsignedInteger dimension = points.getDimension();
+  const Point stddev(points.computeStandardDeviation());
+  Indices intrinsic;
+  for (UnsignedInteger j = 0; j < dimension; ++ j)
+    if (stddev[j] > 0.0)
+      intrinsic.add(j);
+  if (intrinsic.getSize() != 2)
+    throw InvalidArgumentException(HERE) << "PolygonMesher expected an intrinsic dimension of 2, got " << intrinsic.getSize();
+  return intrinsic;
+}
+
+/* Constrained Delaunay triangulation of a polygon with holes */
+static Mesh buildPolygon(const Sample & outer, const Collection<Sample> & holes)
+{
+  const UnsignedInteger dimension = outer.getDimension();
+  const UnsignedInteger size = outer.getSize();
+  if (size < 3)
+    throw InvalidArgumentException(HERE) << "PolygonMesher expected points of size >=3, got " << size;
+  const Indices intrinsic(computeIntrinsicComponents(outer));
+
+  // the vertices of the mesh are the outer ring followed by the holes
+  Sample vertices(outer);
+  Collection<Sample> rings(1, outer);
+  for (UnsignedInteger h = 0; h < holes.getSize(); ++ h)
+  {
+    if (holes[h].getDimension() != dimension)
+      throw InvalidArgumentException(HERE) << "PolygonMesher expected holes of dimension " << dimension << ", got " << holes[h].getDimension();
+    if (holes[h].getSize() < 3)
+      throw InvalidArgumentException(HERE) << "PolygonMesher expected holes of size >=3, got " << holes[h].getSize();
+    // the components off the plane of the outer ring are constant
+    for (UnsignedInteger k = 0; k < dimension; ++ k)
+      if ((k != intrinsic[0]) && (k != intrinsic[1]))
+        for (UnsignedInteger i = 0; i < holes[h].getSize(); ++ i)
+          if (holes[h](i, k) != outer(0, k))
+            throw InvalidArgumentException(HERE) << "PolygonMesher expected holes in the plane of the outer ring, hole " << h << " is not";
+    vertices.add(holes[h]);
+    rings.add(holes[h]);
+  }
+
+  CDT cdt;
+  UnsignedInteger offset = 0;
+  try
+  {
+    for (UnsignedInteger r = 0; r < rings.getSize(); ++ r)
+    {
+      const Sample & ring = rings[r];
+      const UnsignedInteger ringSize = ring.getSize();
+      std::vector<CDT::Vertex_handle> handles(ringSize);
+      for (UnsignedInteger i = 0; i < ringSize; ++ i)
+      {
+        const UnsignedInteger verticesNumber = cdt.number_of_vertices();
+        handles[i] = cdt.insert(Point_2(ring(i, intrinsic[0]), ring(i, intrinsic[1])));
+        // A polygon is called simple if there is no pair of nonconsecutive edges sharing a point
+        if (cdt.number_of_vertices() == verticesNumber)
+          throw InvalidArgumentException(HERE) << "PolygonMesher expected a simple polygon (no redundant vertex)";
+        handles[i]->info() = offset + i;
+      }
+      for (UnsignedInteger i = 0; i < ringSize; ++ i)
+        cdt.insert_constraint(handles[i], handles[(i + 1) % ringSize]);
+      offset += ringSize;
+    }
+  }
+  catch (const InvalidArgumentException &)
+  {
+    throw;
+  }
+  catch (const std::exception &)
+  {
+    // intersecting constraints are rejected by the triangulation
+    throw InvalidArgumentException(HERE) << "PolygonMesher expected a simple polygon (no intersecting edges)";
+  }
+  markDomains(cdt);
+
+  // the outer ring separates the levels 0 and 1 and the holes the levels 1 and 2,
+  // which rejects a hole out of the outer ring or inside another hole
+  for (CDT::Finite_edges_iterator eit = cdt.finite_edges_begin(); eit != cdt.finite_edges_end(); ++ eit)
+  {
+    if (!cdt.is_constrained(*eit))
+      continue;
+    const int level = std::max(eit->first->info().nesting_level, eit->first->neighbor(eit->second)->info().nesting_level);
+    const int expected = (eit->first->vertex(CDT::cw(eit->second))->info() < size) ? 1 : 2;
+    if (level != expected)
+      throw InvalidArgumentException(HERE) << "PolygonMesher expected holes nested in the outer ring and disjoint from each other";
+  }
+
+  // retrieve triangles
+  UnsignedInteger trianglesNumber = 0;
+  for (CDT::Finite_faces_iterator fit = cdt.finite_faces_begin(); fit != cdt.finite_faces_end(); ++ fit)
+    if (fit->info().in_domain())
+      ++ trianglesNumber;
+  IndicesCollection simplices(trianglesNumber, dimension + 1);
+  UnsignedInteger i = 0;
+  for (CDT::Finite_faces_iterator fit = cdt.finite_faces_begin(); fit != cdt.finite_faces_end(); ++ fit)
+  {
+    if (!fit->info().in_domain())
+      continue;
+    for (UnsignedInteger j = 0; j < 3; ++ j)
+      simplices(i, j) = fit->vertex(j)->info();
+    // repeat last index to mark intrinsic dimension
+    for (UnsignedInteger j = 3; j <= dimension; ++ j)
+      simplices(i, j) = simplices(i, 2);
+    ++ i;
+  }
+  return Mesh(vertices, simplices);
+}
+
+/* Triangulate independent polygons */
+struct PolygonMesherPolicy
+{
+  const Collection<Sample> & polygons_;
+  const Collection< Collection<Sample> > & holes_;
+  Collection<Mesh> & output_;
+
+  PolygonMesherPolicy(const Collection<Sample> & polygons,
+                      const Collection< Collection<Sample> > & holes,
+                      Collection<Mesh> & output)
+    : polygons_(polygons)
+    , holes_(holes)
+    , output_(output)
+  {}
+
+  inline void operator()(const TBBImplementation::BlockedRange<UnsignedInteger> & r) const
+  {
+    for (UnsignedInteger i = r.begin(); i != r.end(); ++ i)
+      output_[i] = buildPolygon(polygons_[i], holes_[i]);
+  }
+}; /* end struct PolygonMesherPolicy */
+
 CLASSNAMEINIT(PolygonMesher)
 static const Factory<PolygonMesher> Factory_PolygonMesher;
 
@@ -79,54 +268,55 @@ String PolygonMesher::__str__(const String & ) const
 
 Mesh PolygonMesher::build(const Sample & points) const
 {
-  const UnsignedInteger dimension = points.getDimension();
-  const UnsignedInteger size = points.getSize();
+  return build(points, Collection<Sample>());
+}
 
-  if (size < 3)
-    throw InvalidArgumentException(HERE) << "PolygonMesher expected points of size >=3, got " << size;
+Mesh PolygonMesher::build(const Sample & outer, const Collection<Sample> & holes) const
+{
+  MeshingStatistics statistics;
+  MeshingTimer triangulationTimer(statistics, "triangulationTime");
+  const Mesh result(buildPolygon(outer, holes));
+  triangulationTimer.stop();
+  statistics.add("simplicesProduced", result.getSimplicesNumber());
+  statistics.publish(statistics_);
+  return result;
+}
 
-  const Point stddev(points.computeStandardDeviation());
-  Indices intrinsic;
-  for (UnsignedInteger j = 0; j < dimension; ++ j)
-    if (stddev[j] > 0.0)
-      intrinsic.add(j);
-  if (intrinsic.getSize() != 2)
-    throw InvalidArgumentException(HERE) << "PolygonMesher expected an intrinsic dimension of 2, got " << size;
+/* Mesh several polygons in parallel */
+Collection<Mesh> PolygonMesher::buildBatch(const Collection<Sample> & polygons) const
+{
+  return buildBatch(polygons, Collection<Sample>(), Indices());
+}
 
-  // the indices are not stored so we need to query a map
-  std::vector<Point_2> points2;
-  std::unordered_map<Point_2, UnsignedInteger> vertexToIndexMap;
-  for (UnsignedInteger i = 0; i < size; ++ i)
+Collection<Mesh> PolygonMesher::buildBatch(const Collection<Sample> & outers,
+                                           const Collection<Sample> & holes,
+                                           const Indices & holeOwners) const
+{
+  const UnsignedInteger size = outers.getSize();
+  if (holeOwners.getSize() != holes.getSize())
+    throw InvalidArgumentException(HERE) << "PolygonMesher expected one owner per hole, got " << holeOwners.getSize() << " owners for " << holes.getSize() << " holes";
+  Collection< Collection<Sample> > polygonHoles(size);
+  for (UnsignedInteger h = 0; h < holes.getSize(); ++ h)
   {
-    const Point_2 p2(points(i, intrinsic[0]), points(i, intrinsic[1]));
-    points2.push_back(p2);
-    // A polygon is called simple if there is no pair of nonconsecutive edges sharing a point
-    if (vertexToIndexMap.count(p2) > 0)
-      throw InvalidArgumentException(HERE) << "PolygonMesher expected a simple polygon (no redundant vertex)";
-    vertexToIndexMap[p2] = i;
+    if (holeOwners[h] >= size)
+      throw InvalidArgumentException(HERE) << "PolygonMesher expected hole owners lower than " << size << ", got " << holeOwners[h];
+    polygonHoles[holeOwners[h]].add(holes[h]);
   }
+  MeshingStatistics statistics;
+  MeshingTimer triangulationTimer(statistics, "triangulationTime");
+  Collection<Mesh> result(size);
+  const PolygonMesherPolicy policy(outers, polygonHoles, result);
+  TBBImplementation::ParallelFor(0, size, policy);
+  triangulationTimer.stop();
+  statistics.add("piecesProduced", size);
+  statistics.publish(statistics_);
+  return result;
+}
 
-  const Polygon_2 polygon(points2.begin(), points2.end());
-
-  // perform triangulation
-  std::vector<Polygon_2> triangles;
-  const CGAL::Polygon_triangulation_decomposition_2<KernelInexact> decomposition2;
-  decomposition2(polygon, std::back_inserter(triangles));
-
-  // retrieve triangles
-  IndicesCollection simplices(triangles.size(), dimension + 1);
-  for (UnsignedInteger i = 0; i < triangles.size(); ++ i)
-  {
-    for (UnsignedInteger j = 0; j < 3; ++ j)
-    {
-      const Point_2 & vh = triangles[i].vertex(j);
-      simplices(i, j) = vertexToIndexMap[vh];
-    }
-    // repeat last index to mark intrinsic dimension
-    for (UnsignedInteger j = 3; j <= dimension; ++ j)
-      simplices(i, j) = simplices(i, 2);
-  }
-  return Mesh(points, simplices);
+/* Statistics accessor */
+PointWithDescription PolygonMesher::getStatistics() const
+{
+  return MeshingStatistics::Read(statistics_);
 }
 
 /* Method save() stores the object through the StorageManager */
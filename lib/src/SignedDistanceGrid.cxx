@@ -0,0 +1,297 @@
+//                                               -*- C++ -*-
+/**
+ *  @brief Signed distance sampled on a regular grid
+ *
+ *  Copyright 2005-2026 Airbus-EDF-IMACS-ONERA-Phimeca
+ *
+ *  This library is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License
+ *  along with this library.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+#include "otmeshing/SignedDistanceGrid.hxx"
+
+#include <openturns/PersistentObjectFactory.hxx>
+#include <openturns/TBBImplementation.hxx>
+
+using namespace OT;
+
+namespace OTMESHING
+{
+
+/* Multilinear interpolation of the node values in the cell of each point */
+struct SignedDistanceGridPolicy
+{
+  const Sample & sample_;
+  const Point & lowerBound_;
+  const Point & upperBound_;
+  const Indices & discretization_;
+  const Indices & strides_;
+  const Scalar * values_;
+  Scalar * output_;
+  Indices & outside_;
+
+  SignedDistanceGridPolicy(const Sample & sample,
+                           const Point & lowerBound,
+                           const Point & upperBound,
+                           const Indices & discretization,
+                           const Indices & strides,
+                           const Scalar * values,
+                           Scalar * output,
+                           Indices & outside)
+    : sample_(sample)
+    , lowerBound_(lowerBound)
+    , upperBound_(upperBound)
+    , discretization_(discretization)
+    , strides_(strides)
+    , values_(values)
+    , output_(output)
+    , outside_(outside)
+  {}
+
+  inline void operator()(const TBBImplementation::BlockedRange<UnsignedInteger> & r) const
+  {
+    const UnsignedInteger dimension = sample_.getDimension();
+    const UnsignedInteger cornersNumber = static_cast<UnsignedInteger>(1) << dimension;
+    Indices cell(dimension);
+    Point fraction(dimension);
+    for (UnsignedInteger i = r.begin(); i != r.end(); ++ i)
+    {
+      Bool inside = true;
+      UnsignedInteger base = 0;
+      for (UnsignedInteger k = 0; (k < dimension) && inside; ++ k)
+      {
+        const Scalar x = sample_(i, k);
+        // also rejects NaN
+        inside = (x >= lowerBound_[k]) && (x <= upperBound_[k]);
+        const Scalar t = (x - lowerBound_[k]) / (upperBound_[k] - lowerBound_[k]) * discretization_[k];
+        // the points on the upper bound belong to the last cell
+        cell[k] = std::min(static_cast<UnsignedInteger>(std::max(t, 0.0)), discretization_[k] - 1);
+        fraction[k] = std::min(std::max(t - cell[k], 0.0), 1.0);
+        base += cell[k] * strides_[k];
+      }
+      if (!inside)
+      {
+        outside_[i] = 1;
+        continue;
+      }
+      Scalar value = 0.0;
+      for (UnsignedInteger corner = 0; corner < cornersNumber; ++ corner)
+      {
+        Scalar weight = 1.0;
+        UnsignedInteger node = base;
+        for (UnsignedInteger k = 0; k < dimension; ++ k)
+        {
+          if ((corner >> k) & 1)
+          {
+            weight *= fraction[k];
+            node += strides_[k];
+          }
+          else
+            weight *= 1.0 - fraction[k];
+        }
+        value += weight * values_[node];
+      }
+      output_[i] = value;
+    }
+  }
+}; /* end struct SignedDistanceGridPolicy */
+
+CLASSNAMEINIT(SignedDistanceGrid)
+
+static Factory<SignedDistanceGrid> Factory_SignedDistanceGrid;
+
+
+/* Default constructor */
+SignedDistanceGrid::SignedDistanceGrid()
+  : PersistentObject()
+{
+  // Nothing to do
+}
+
+/* Parameters constructor */
+SignedDistanceGrid::SignedDistanceGrid(const MeshDomain2 & domain,
+                                       const Indices & discretization)
+  : PersistentObject()
+  , domain_(domain)
+  , discretization_(discretization)
+{
+  const Sample vertices(domain.getMesh().getVertices());
+  if (!vertices.getSize())
+    throw InvalidArgumentException(HERE) << "SignedDistanceGrid expected a domain with vertices";
+  bounds_ = Interval(vertices.getMin(), vertices.getMax());
+  initialize();
+}
+
+SignedDistanceGrid::SignedDistanceGrid(const MeshDomain2 & domain,
+                                       const Interval & bounds,
+                                       const Indices & discretization)
+  : PersistentObject()
+  , domain_(domain)
+  , bounds_(bounds)
+  , discretization_(discretization)
+{
+  initialize();
+}
+
+/* Virtual constructor method */
+SignedDistanceGrid * SignedDistanceGrid::clone() const
+{
+  return new SignedDistanceGrid(*this);
+}
+
+/* Compute the exact distances at the nodes */
+void SignedDistanceGrid::initialize()
+{
+  const UnsignedInteger dimension = domain_.getDimension();
+  if (bounds_.getDimension() != dimension)
+    throw InvalidArgumentException(HERE) << "SignedDistanceGrid expected bounds of dimension " << dimension << " got " << bounds_.getDimension();
+  if (discretization_.getSize() != dimension)
+    throw InvalidArgumentException(HERE) << "SignedDistanceGrid expected a discretization of dimension " << dimension << " got " << discretization_.getSize();
+  const Point lowerBound(bounds_.getLowerBound());
+  const Point upperBound(bounds_.getUpperBound());
+  UnsignedInteger nodesNumber = 1;
+  for (UnsignedInteger k = 0; k < dimension; ++ k)
+  {
+    if (!discretization_[k])
+      throw InvalidArgumentException(HERE) << "SignedDistanceGrid expected at least one cell along each axis, here discretization=" << discretization_;
+    if (!(upperBound[k] > lowerBound[k]))
+      throw InvalidArgumentException(HERE) << "SignedDistanceGrid expected non-degenerate bounds, here bounds=" << bounds_;
+    nodesNumber *= discretization_[k] + 1;
+  }
+
+  Sample nodes(nodesNumber, dimension);
+  for (UnsignedInteger j = 0; j < nodesNumber; ++ j)
+  {
+    UnsignedInteger index = j;
+    for (UnsignedInteger k = 0; k < dimension; ++ k)
+    {
+      const UnsignedInteger n = discretization_[k];
+      const UnsignedInteger ik = index % (n + 1);
+      index /= n + 1;
+      // exact upper bound on the last node
+      nodes(j, k) = (ik == n) ? upperBound[k] : lowerBound[k] + ik * (upperBound[k] - lowerBound[k]) / n;
+    }
+  }
+  LOGINFO(OSS() << "SignedDistanceGrid: computing the distance at " << nodesNumber << " nodes");
+  values_ = domain_.computeDistance(nodes);
+}
+
+/* Accessors */
+MeshDomain2 SignedDistanceGrid::getDomain() const
+{
+  return domain_;
+}
+
+Interval SignedDistanceGrid::getBounds() const
+{
+  return bounds_;
+}
+
+Indices SignedDistanceGrid::getDiscretization() const
+{
+  return discretization_;
+}
+
+Sample SignedDistanceGrid::getValues() const
+{
+  return values_;
+}
+
+/* The signed distance is 1-Lipschitz and the interpolation weights are convex */
+Scalar SignedDistanceGrid::getErrorBound() const
+{
+  const Point extent(bounds_.getUpperBound() - bounds_.getLowerBound());
+  Scalar halfDiagonal2 = 0.0;
+  for (UnsignedInteger k = 0; k < discretization_.getSize(); ++ k)
+  {
+    const Scalar step = extent[k] / discretization_[k];
+    halfDiagonal2 += 0.25 * step * step;
+  }
+  return std::sqrt(halfDiagonal2);
+}
+
+/* Approximate signed distance */
+Scalar SignedDistanceGrid::computeDistance(const Point & point) const
+{
+  return computeDistance(Sample(1, point))(0, 0);
+}
+
+Sample SignedDistanceGrid::computeDistance(const Sample & sample) const
+{
+  const UnsignedInteger dimension = discretization_.getSize();
+  if (sample.getDimension() != dimension)
+    throw InvalidArgumentException(HERE) << "Expected a point of dimension " << dimension << " got " << sample.getDimension();
+  const UnsignedInteger size = sample.getSize();
+  Sample distances(size, 1);
+  if (!size)
+    return distances;
+  if (!values_.getSize())
+    throw NotDefinedException(HERE) << "SignedDistanceGrid is not built";
+
+  Indices strides(dimension, 1);
+  for (UnsignedInteger k = 1; k < dimension; ++ k)
+    strides[k] = strides[k - 1] * (discretization_[k - 1] + 1);
+  const Point lowerBound(bounds_.getLowerBound());
+  const Point upperBound(bounds_.getUpperBound());
+  Indices outside(size);
+  const SignedDistanceGridPolicy policy(sample, lowerBound, upperBound, discretization_, strides,
+                                        values_.getImplementation()->data(), &distances(0, 0), outside);
+  TBBImplementation::ParallelFor(0, size, policy);
+
+  // the points out of the grid are computed in one exact batch
+  Indices outsideIndices;
+  for (UnsignedInteger i = 0; i < size; ++ i)
+    if (outside[i])
+      outsideIndices.add(i);
+  if (outsideIndices.getSize())
+  {
+    const Sample exact(domain_.computeDistance(sample.select(outsideIndices)));
+    for (UnsignedInteger j = 0; j < outsideIndices.getSize(); ++ j)
+      distances(outsideIndices[j], 0) = exact(j, 0);
+  }
+  return distances;
+}
+
+/* String converter */
+String SignedDistanceGrid::__repr__() const
+{
+  OSS oss(true);
+  oss << "class=" << SignedDistanceGrid::GetClassName()
+      << " bounds=" << bounds_
+      << " discretization=" << discretization_
+      << " errorBound=" << (values_.getSize() ? getErrorBound() : 0.0);
+  return oss;
+}
+
+/* Method save() stores the object through the StorageManager */
+void SignedDistanceGrid::save(Advocate & adv) const
+{
+  PersistentObject::save(adv);
+  adv.saveAttribute("domain_", domain_);
+  adv.saveAttribute("bounds_", bounds_);
+  adv.saveAttribute("discretization_", discretization_);
+  adv.saveAttribute("values_", values_);
+}
+
+/* Method load() reloads the object from the StorageManager */
+void SignedDistanceGrid::load(Advocate & adv)
+{
+  PersistentObject::load(adv);
+  adv.loadAttribute("domain_", domain_);
+  adv.loadAttribute("bounds_", bounds_);
+  adv.loadAttribute("discretization_", discretization_);
+  // the node values are stored, nothing is recomputed
+  adv.loadAttribute("values_", values_);
+}
+
+} /* namespace OTMESHING */
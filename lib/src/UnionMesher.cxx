@@ -19,98 +19,248 @@
  *
  */
 #include "otmeshing/UnionMesher.hxx"
+#include "otmeshing/CloudMesher.hxx"
+#include "otmeshing/BoundingBoxTree.hxx"
 
 #include <openturns/PersistentObjectFactory.hxx>
 #include <openturns/SpecFunc.hxx>
+#include <openturns/Matrix.hxx>
 
-#include <nanoflann.hpp>
-#if NANOFLANN_VERSION < 0x150
-namespace nanoflann
-{
-using SearchParameters = SearchParams;
-}
-#endif
+#include <openturns/TBBImplementation.hxx>
+
+#include <limits>
+#include <numeric>
+
+#include "CddUtilities.hxx"
+#include "MeshingStatistics.hxx"
+#include "VertexGrid.hxx"
 
 using namespace OT;
 
 namespace OTMESHING
 {
 
-class KDTreeSampleAdaptor
+/* Find the smallest index of the vertices within tolerance of each vertex */
+struct GridRepresentativePolicy
 {
-public:
-  explicit KDTreeSampleAdaptor(const Sample & points)
-    : data_(points.getImplementation()->data())
-    , size_(points.getSize())
-    , dimension_(points.getDimension())
+  const Scalar * data_;
+  const UnsignedInteger dimension_;
+  const Scalar tolerance_;
+  const VertexGrid & grid_;
+  Indices & representative_;
+
+  GridRepresentativePolicy(const Scalar * data,
+                           const UnsignedInteger dimension,
+                           const Scalar tolerance,
+                           const VertexGrid & grid,
+                           Indices & representative)
+    : data_(data)
+    , dimension_(dimension)
+    , tolerance_(tolerance)
+    , grid_(grid)
+    , representative_(representative)
+  {}
+
+  inline void operator()(const TBBImplementation::BlockedRange<UnsignedInteger> & r) const
   {
+    const Scalar tolerance2 = tolerance_ * tolerance_;
+    for (UnsignedInteger i = r.begin(); i != r.end(); ++ i)
+    {
+      const Scalar * xi = data_ + i * dimension_;
+      UnsignedInteger best = i;
+      grid_.visit(xi, [&](const UnsignedInteger j)
+      {
+        if (j >= best)
+          return false;
+        const Scalar * xj = data_ + j * dimension_;
+        Scalar distance2 = 0.0;
+        for (UnsignedInteger k = 0; (k < dimension_) && (distance2 <= tolerance2); ++ k)
+          distance2 += (xi[k] - xj[k]) * (xi[k] - xj[k]);
+        if (distance2 <= tolerance2)
+          best = j;
+        return false;
+      });
+      representative_[i] = best;
+    }
   }
+}; /* end struct GridRepresentativePolicy */
+
+/* Sorted vertex indices of each simplex after deduplication, and whether it is collapsed */
+struct SimplexKeyPolicy
+{
+  const IndicesCollection & simplices_;
+  const UnsignedInteger simplexSize_;
+  const Indices & vertexMap_;
+  UnsignedInteger * keys_;
+  Indices & kept_;
 
-  inline size_t kdtree_get_point_count() const
+  SimplexKeyPolicy(const IndicesCollection & simplices,
+                   const UnsignedInteger simplexSize,
+                   const Indices & vertexMap,
+                   UnsignedInteger * keys,
+                   Indices & kept)
+    : simplices_(simplices)
+    , simplexSize_(simplexSize)
+    , vertexMap_(vertexMap)
+    , keys_(keys)
+    , kept_(kept)
+  {}
+
+  inline void operator()(const TBBImplementation::BlockedRange<UnsignedInteger> & r) const
   {
-    return size_;
+    std::vector<UnsignedInteger> original(simplexSize_);
+    for (UnsignedInteger i = r.begin(); i != r.end(); ++ i)
+    {
+      UnsignedInteger * key = keys_ + i * simplexSize_;
+      for (UnsignedInteger j = 0; j < simplexSize_; ++ j)
+      {
+        original[j] = simplices_(i, j);
+        key[j] = vertexMap_[original[j]];
+      }
+      // repeated indices are also used to mark a lower intrinsic dimension
+      std::sort(original.begin(), original.end());
+      std::sort(key, key + simplexSize_);
+      UnsignedInteger originalNumber = 1;
+      UnsignedInteger keyNumber = 1;
+      for (UnsignedInteger j = 1; j < simplexSize_; ++ j)
+      {
+        originalNumber += original[j] != original[j - 1];
+        keyNumber += key[j] != key[j - 1];
+      }
+      if (keyNumber < originalNumber)
+        kept_[i] = 0;
+    }
   }
+}; /* end struct SimplexKeyPolicy */
 
-  inline Scalar kdtree_get_pt(const size_t idx, const size_t dim) const
+/* Renumber the kept simplices and copy the used vertices */
+struct CompressMeshPolicy
+{
+  const Scalar * data_;
+  const UnsignedInteger dimension_;
+  const Indices & vertexMap_;
+  const Indices & newVertexIndex_;
+  Scalar * verticesOut_;
+
+  CompressMeshPolicy(const Scalar * data,
+                     const UnsignedInteger dimension,
+                     const Indices & vertexMap,
+                     const Indices & newVertexIndex,
+                     Scalar * verticesOut)
+    : data_(data)
+    , dimension_(dimension)
+    , vertexMap_(vertexMap)
+    , newVertexIndex_(newVertexIndex)
+    , verticesOut_(verticesOut)
+  {}
+
+  inline void operator()(const TBBImplementation::BlockedRange<UnsignedInteger> & r) const
   {
-    return data_[dim + idx * dimension_];
+    const UnsignedInteger fullSize = vertexMap_.getSize();
+    for (UnsignedInteger i = r.begin(); i != r.end(); ++ i)
+    {
+      // only representatives that are still referenced are written
+      if ((vertexMap_[i] != i) || (newVertexIndex_[i] >= fullSize))
+        continue;
+      std::copy(data_ + i * dimension_, data_ + (i + 1) * dimension_, verticesOut_ + newVertexIndex_[i] * dimension_);
+    }
   }
+}; /* end struct CompressMeshPolicy */
+
+/* Renumber the kept simplices */
+struct CompressSimplicesPolicy
+{
+  const IndicesCollection & simplices_;
+  const UnsignedInteger simplexSize_;
+  const Indices & simplexOffset_;
+  const Indices & vertexMap_;
+  const Indices & newVertexIndex_;
+  UnsignedInteger * simplicesOut_;
 
-  template <class BBOX>
-  bool kdtree_get_bbox(BBOX & /*bb*/) const
+  CompressSimplicesPolicy(const IndicesCollection & simplices,
+                          const UnsignedInteger simplexSize,
+                          const Indices & simplexOffset,
+                          const Indices & vertexMap,
+                          const Indices & newVertexIndex,
+                          UnsignedInteger * simplicesOut)
+    : simplices_(simplices)
+    , simplexSize_(simplexSize)
+    , simplexOffset_(simplexOffset)
+    , vertexMap_(vertexMap)
+    , newVertexIndex_(newVertexIndex)
+    , simplicesOut_(simplicesOut)
+  {}
+
+  inline void operator()(const TBBImplementation::BlockedRange<UnsignedInteger> & r) const
   {
-    return false;
+    const UnsignedInteger droppedOffset = simplexOffset_.getSize() * simplexSize_;
+    for (UnsignedInteger i = r.begin(); i != r.end(); ++ i)
+    {
+      // dropped simplices are marked with an out of range offset
+      if (simplexOffset_[i] >= droppedOffset)
+        continue;
+      for (UnsignedInteger j = 0; j < simplexSize_; ++ j)
+        simplicesOut_[simplexOffset_[i] + j] = newVertexIndex_[vertexMap_[simplices_(i, j)]];
+    }
   }
+}; /* end struct CompressSimplicesPolicy */
 
-private:
-  const Scalar *data_ = nullptr;
-  UnsignedInteger size_ = 0;
-  UnsignedInteger dimension_ = 0;
-};
+/* Contiguous simplex block shifted by the vertex offset, in the index type of the mesh */
+static void CopyShiftedSimplices(const Mesh & mesh, const UnsignedInteger count, const UnsignedInteger offset, UnsignedInteger * simplicesOut)
+{
+  const IndicesCollection simplices(mesh.getSimplices());
+  std::transform(simplices.cbegin_at(0), simplices.cbegin_at(0) + count, simplicesOut,
+                 [offset](const UnsignedInteger index) {return index + offset;});
+}
 
-using nano_kd_tree_t = nanoflann::KDTreeSingleIndexAdaptor <
-                       nanoflann::L2_Simple_Adaptor<Scalar, KDTreeSampleAdaptor >,
-                       KDTreeSampleAdaptor, -1 >;
+static void CopyShiftedSimplices(const CompactMesh & mesh, const UnsignedInteger count, const UnsignedInteger offset, std::uint32_t * simplicesOut)
+{
+  const std::uint32_t * simplices = mesh.getSimplicesData();
+  std::transform(simplices, simplices + count, simplicesOut,
+                 [offset](const std::uint32_t index) {return static_cast<std::uint32_t>(index + offset);});
+}
 
-class KDTree2
+/* Copy each mesh into its slot of the union */
+template <class MeshType, class IndexType>
+struct UnionMeshPolicy
 {
-public:
-  explicit KDTree2(const Sample & points)
-  {
-    const UnsignedInteger dimension = points.getDimension();
-    sampleAdaptor_ = new KDTreeSampleAdaptor(points);
-    nanoflann::KDTreeSingleIndexAdaptorParams indexParameters;
-    indexParameters.leaf_max_size = ResourceMap::GetAsUnsignedInteger("KDTree-leaf_max_size");
-#if NANOFLANN_VERSION >= 0x150
-    indexParameters.n_thread_build = ResourceMap::GetAsUnsignedInteger("KDTree-n_thread_build");
-#endif
-    indexAdaptor_ = new nano_kd_tree_t(dimension, *sampleAdaptor_, indexParameters);
-  }
+  const Collection<MeshType> & coll_;
+  const UnsignedInteger dimension_;
+  const Indices & vertexOffset_;
+  const Indices & simplexOffset_;
+  Scalar * verticesOut_;
+  IndexType * simplicesOut_;
+
+  UnionMeshPolicy(const Collection<MeshType> & coll,
+                  const UnsignedInteger dimension,
+                  const Indices & vertexOffset,
+                  const Indices & simplexOffset,
+                  Scalar * verticesOut,
+                  IndexType * simplicesOut)
+    : coll_(coll)
+    , dimension_(dimension)
+    , vertexOffset_(vertexOffset)
+    , simplexOffset_(simplexOffset)
+    , verticesOut_(verticesOut)
+    , simplicesOut_(simplicesOut)
+  {}
 
-  Indices queryRadius(const Point & x, const Scalar radius, Point & distanceOut, const Bool sorted = false) const
+  inline void operator()(const TBBImplementation::BlockedRange<UnsignedInteger> & r) const
   {
-#if NANOFLANN_VERSION >= 0x150
-    std::vector<nanoflann::ResultItem<unsigned int, Scalar> > indicesDists;
-#else
-    std::vector<std::pair<UnsignedInteger, Scalar> > indicesDists;
-#endif
-    nanoflann::SearchParameters searchParameters;
-    searchParameters.sorted = sorted;
-    const UnsignedInteger nFound = indexAdaptor_->radiusSearch(x.data(), radius * radius, indicesDists, searchParameters);
-    Indices result(nFound);
-    distanceOut.resize(nFound);
-    for(UnsignedInteger k = 0; k < nFound; ++ k)
+    for (UnsignedInteger i = r.begin(); i != r.end(); ++ i)
     {
-      result[k] = indicesDists[k].first;
-      distanceOut[k] = std::sqrt(indicesDists[k].second);
+      // bulk copy of the contiguous vertex block
+      const Sample verticesI(coll_[i].getVertices());
+      const Scalar * data = verticesI.getImplementation()->data();
+      std::copy(data, data + (vertexOffset_[i + 1] - vertexOffset_[i]) * dimension_, verticesOut_ + vertexOffset_[i] * dimension_);
+
+      const UnsignedInteger simplicesNumberI = simplexOffset_[i + 1] - simplexOffset_[i];
+      if (!simplicesNumberI)
+        continue;
+      CopyShiftedSimplices(coll_[i], simplicesNumberI * (dimension_ + 1), vertexOffset_[i], simplicesOut_ + simplexOffset_[i] * (dimension_ + 1));
     }
-    return result;
   }
-
-private:
-  Pointer<KDTreeSampleAdaptor> sampleAdaptor_;
-  Pointer<nano_kd_tree_t> indexAdaptor_;
-};
+}; /* end struct UnionMeshPolicy */
 
 CLASSNAMEINIT(UnionMesher)
 static const Factory<UnionMesher> Factory_UnionMesher;
@@ -151,40 +301,301 @@ Mesh UnionMesher::CompressMesh(const Mesh & mesh)
   const UnsignedInteger fullSize = vertices.getSize();
   if (!fullSize)
     return mesh;
-  IndicesCollection simplices(mesh.getSimplices());
-  Indices compressedVertexMap(fullSize, fullSize);
-  const KDTree2 tree(vertices);
+  const IndicesCollection simplices(mesh.getSimplices());
+  const UnsignedInteger simplicesNumber = simplices.getSize();
+  const Scalar * data = vertices.getImplementation()->data();
+
+  // the representative of each vertex is the first vertex within tolerance
   const Scalar tolerance = SpecFunc::Precision * vertices.computeRange().norm();
-  Sample verticesCompressed(0, dimension);
+  const VertexGrid grid(data, fullSize, dimension, tolerance);
+  Indices vertexMap(fullSize);
+  const GridRepresentativePolicy representativePolicy(data, dimension, tolerance, grid, vertexMap);
+  TBBImplementation::ParallelFor(0, fullSize, representativePolicy);
+
+  // resolve chains, representatives always have a smaller index
   for (UnsignedInteger i = 0; i < fullSize; ++ i)
+    vertexMap[i] = vertexMap[vertexMap[i]];
+
+  // drop simplices collapsed by the deduplication or duplicated, the first of equal keys is kept
+  const UnsignedInteger simplexSize = dimension + 1;
+  std::vector<UnsignedInteger> keys(simplicesNumber * simplexSize);
+  Indices kept(simplicesNumber, 1);
+  const SimplexKeyPolicy keyPolicy(simplices, simplexSize, vertexMap, keys.data(), kept);
+  TBBImplementation::ParallelFor(0, simplicesNumber, keyPolicy);
+  std::vector<UnsignedInteger> order(simplicesNumber);
+  std::iota(order.begin(), order.end(), 0);
+  const UnsignedInteger * keysData = keys.data();
+  TBBImplementation::ParallelSort(order.begin(), order.end(), [keysData, simplexSize](const UnsignedInteger a, const UnsignedInteger b)
   {
-    // check if already marked
-    if (compressedVertexMap[i] < fullSize)
+    for (UnsignedInteger j = 0; j < simplexSize; ++ j)
+      if (keysData[a * simplexSize + j] != keysData[b * simplexSize + j])
+        return keysData[a * simplexSize + j] < keysData[b * simplexSize + j];
+    return a < b;
+  });
+  for (UnsignedInteger i = 1; i < simplicesNumber; ++ i)
+    if (std::equal(keysData + order[i] * simplexSize, keysData + (order[i] + 1) * simplexSize, keysData + order[i - 1] * simplexSize))
+      kept[order[i]] = 0;
+
+  // drop the vertices that are no longer referenced
+  Indices newVertexIndex(fullSize, fullSize);
+  Indices simplexOffset(simplicesNumber, simplicesNumber * simplexSize);
+  UnsignedInteger keptNumber = 0;
+  for (UnsignedInteger i = 0; i < simplicesNumber; ++ i)
+  {
+    if (!kept[i])
       continue;
+    simplexOffset[i] = keptNumber * simplexSize;
+    ++ keptNumber;
+    for (UnsignedInteger j = 0; j < simplexSize; ++ j)
+      newVertexIndex[vertexMap[simplices(i, j)]] = 0;
+  }
+  UnsignedInteger compressedSize = 0;
+  for (UnsignedInteger i = 0; i < fullSize; ++ i)
+    if ((vertexMap[i] == i) && (newVertexIndex[i] < fullSize))
+    {
+      newVertexIndex[i] = compressedSize;
+      ++ compressedSize;
+    }
+  LOGDEBUG(OSS() << "recompression fullSize=" << fullSize << " compressedSize=" << compressedSize << " simplices=" << simplicesNumber << " kept=" << keptNumber);
+
+  // write the output arrays in one pass
+  Sample verticesCompressed(compressedSize, dimension);
+  if (compressedSize)
+  {
+    const CompressMeshPolicy compressPolicy(data, dimension, vertexMap, newVertexIndex, &verticesCompressed(0, 0));
+    TBBImplementation::ParallelFor(0, fullSize, compressPolicy);
+  }
+  IndicesCollection simplicesCompressed(keptNumber, simplexSize);
+  if (keptNumber)
+  {
+    const CompressSimplicesPolicy simplicesPolicy(simplices, simplexSize, simplexOffset, vertexMap, newVertexIndex, &simplicesCompressed(0, 0));
+    TBBImplementation::ParallelFor(0, simplicesNumber, simplicesPolicy);
+  }
+  return Mesh(verticesCompressed, simplicesCompressed);
+}
+
+#ifdef OPENTURNS_HAVE_CDDLIB
+/* Convex piece in both H and V representations */
+struct ConvexPiece
+{
+  Sample inequalities_;
+  Sample vertices_;
+};
+
+/* Whether the points span the full space */
+static Bool isFullDimensional(const Sample & points, const UnsignedInteger dimension)
+{
+  const UnsignedInteger size = points.getSize();
+  if (size < dimension + 1)
+    return false;
+  Matrix differences(dimension, size - 1);
+  for (UnsignedInteger i = 1; i < size; ++ i)
+    for (UnsignedInteger k = 0; k < dimension; ++ k)
+      differences(k, i - 1) = points(i, k) - points(0, k);
+  const Point singularValues(differences.computeSingularValues());
+  const Scalar threshold = std::sqrt(SpecFunc::Precision) * singularValues[0];
+  UnsignedInteger rank = 0;
+  for (UnsignedInteger k = 0; k < singularValues.getDimension(); ++ k)
+    if (singularValues[k] > threshold)
+      ++ rank;
+  return rank == dimension;
+}
+#endif
+
+/* Union without overlaps: each simplex is clipped against the simplices of the previous meshes */
+Mesh UnionMesher::buildDisjoint(const MeshCollection & coll) const
+{
+#ifdef OPENTURNS_HAVE_CDDLIB
+  const UnsignedInteger size = coll.getSize();
+  const UnsignedInteger dimension = coll[0].getDimension();
+  const UnsignedInteger simplexSize = dimension + 1;
+  MeshingStatistics statistics;
+  UnsignedInteger testedNumber = 0;
+  UnsignedInteger prunedNumber = 0;
+  UnsignedInteger cddCallsNumber = 0;
+
+  // bounding boxes of all the simplices
+  Indices meshOffset(size + 1);
+  for (UnsignedInteger i = 0; i < size; ++ i)
+    meshOffset[i + 1] = meshOffset[i] + coll[i].getSimplicesNumber();
+  const UnsignedInteger simplicesNumber = meshOffset[size];
+  Collection<Sample> simplexVertices(simplicesNumber);
+  Sample lower(simplicesNumber, dimension);
+  Sample upper(simplicesNumber, dimension);
+  Indices degenerate(simplicesNumber);
+  for (UnsignedInteger i = 0; i < size; ++ i)
+  {
+    const Sample vertices(coll[i].getVertices());
+    const IndicesCollection simplices(coll[i].getSimplices());
+    for (UnsignedInteger j = 0; j < simplices.getSize(); ++ j)
+    {
+      const UnsignedInteger global = meshOffset[i] + j;
+      Sample simplex(simplexSize, dimension);
+      for (UnsignedInteger l = 0; l < simplexSize; ++ l)
+        simplex[l] = vertices[simplices(j, l)];
+      // repeated indices mark a lower intrinsic dimension, such simplices are kept as is
+      Indices sorted(simplices.cbegin_at(j), simplices.cend_at(j));
+      std::sort(sorted.begin(), sorted.end());
+      degenerate[global] = std::unique(sorted.begin(), sorted.end()) != sorted.end();
+      lower[global] = simplex.getMin();
+      upper[global] = simplex.getMax();
+      simplexVertices[global] = simplex;
+    }
+  }
 
-    // retrieve the indices of unique points, beware the last few decimals can actually differ
-    Point distance;
-    const Indices nearest(tree.queryRadius(vertices[i], tolerance, distance));
+  // broad phase: a tree over the boxes of each mesh, queried by the simplices of the next meshes
+  Collection<BoundingBoxTree> trees(size);
+  for (UnsignedInteger i = 0; i + 1 < size; ++ i)
+    if (coll[i].getSimplicesNumber())
+      trees[i] = BoundingBoxTree(coll[i]);
+
+  // each piece depends on the previous cuts, the clipping is sequential
+  MeshingTimer clippingTimer(statistics, "clippingTime");
+  const CddGlobalConstants cddConstants;
+  Collection<Sample> hRepresentation(simplicesNumber);
+  for (UnsignedInteger i = 0; i < simplicesNumber; ++ i)
+    if (!degenerate[i])
+    {
+      hRepresentation[i] = computeInequalities(simplexVertices[i]);
+      ++ cddCallsNumber;
+    }
 
-    // mark the whole set of unique points (contains i index)
-    const UnsignedInteger currentSize = verticesCompressed.getSize();
-    for (UnsignedInteger k = 0; k < nearest.getSize(); ++ k)
-      compressedVertexMap[nearest[k]] = currentSize;
+  CloudMesher cloudMesher;
+  MeshCollection pieceMeshes;
+  UnsignedInteger clippedNumber = 0;
+  for (UnsignedInteger i = 0; i < size; ++ i)
+  {
+    const IndicesCollection simplices(coll[i].getSimplices());
+    for (UnsignedInteger global = meshOffset[i]; global < meshOffset[i + 1]; ++ global)
+    {
+      Collection<ConvexPiece> pieces(1);
+      pieces[0].inequalities_ = hRepresentation[global];
+      pieces[0].vertices_ = simplexVertices[global];
+      Bool clipped = false;
+      if ((i > 0) && !degenerate[global])
+      {
+        // only the simplices of the previous meshes whose box overlaps are subtracted
+        const Interval box(lower[global], upper[global]);
+        Indices candidates;
+        for (UnsignedInteger io = 0; io < i; ++ io)
+          if (coll[io].getSimplicesNumber())
+          {
+            const Indices local(trees[io].queryIntersecting(box));
+            for (UnsignedInteger j = 0; j < local.getSize(); ++ j)
+              candidates.add(meshOffset[io] + local[j]);
+          }
+        for (UnsignedInteger ic = 0; (ic < candidates.getSize()) && pieces.getSize(); ++ ic)
+        {
+          const UnsignedInteger other = candidates[ic];
+          if (degenerate[other])
+            continue;
+          ++ testedNumber;
+          Bool toSkip = false;
+          for (UnsignedInteger k = 0; k < dimension; ++ k)
+          {
+            toSkip = (lower(other, k) >= upper(global, k)) || (lower(global, k) >= upper(other, k));
+            if (toSkip)
+              break;
+          }
+          if (toSkip)
+          {
+            ++ prunedNumber;
+            continue;
+          }
 
-    // store the point
-    verticesCompressed.add(vertices[i]);
+          // P \ T is the disjoint union of the P n h_1 n ... n h_{j-1} n not(h_j)
+          const Sample & cut = hRepresentation[other];
+          Collection<ConvexPiece> remaining;
+          for (UnsignedInteger p = 0; p < pieces.getSize(); ++ p)
+          {
+            Sample intersection(pieces[p].inequalities_);
+            intersection.add(cut);
+            ++ cddCallsNumber;
+            if (!isFullDimensional(computeVertices(intersection), dimension))
+            {
+              remaining.add(pieces[p]);
+              continue;
+            }
+            clipped = true;
+            Sample inequalities(pieces[p].inequalities_);
+            for (UnsignedInteger j = 0; j < cut.getSize(); ++ j)
+            {
+              Sample candidate(inequalities);
+              candidate.add(cut[j] * (-1.0));
+              const Sample candidateVertices(computeVertices(candidate));
+              ++ cddCallsNumber;
+              if (isFullDimensional(candidateVertices, dimension))
+              {
+                ConvexPiece piece;
+                piece.inequalities_ = candidate;
+                piece.vertices_ = candidateVertices;
+                remaining.add(piece);
+              }
+              inequalities.add(cut[j]);
+            }
+          }
+          pieces = remaining;
+        }
+      }
+      if (!clipped)
+      {
+        // untouched simplices keep their original orientation
+        const Indices simplex(simplices.cbegin_at(global - meshOffset[i]), simplices.cend_at(global - meshOffset[i]));
+        Indices local(simplexSize);
+        local.fill();
+        // repeated indices are preserved
+        for (UnsignedInteger l = 1; l < simplexSize; ++ l)
+          for (UnsignedInteger m = 0; m < l; ++ m)
+            if (simplex[m] == simplex[l])
+            {
+              local[l] = local[m];
+              break;
+            }
+        pieceMeshes.add(Mesh(simplexVertices[global], IndicesCollection(Collection<Indices>(1, local))));
+        continue;
+      }
+      ++ clippedNumber;
+      statistics.add("piecesProduced", pieces.getSize());
+      MeshingTimer triangulationTimer(statistics, "triangulationTime");
+      for (UnsignedInteger p = 0; p < pieces.getSize(); ++ p)
+      {
+        const Sample & vertices = pieces[p].vertices_;
+        if (vertices.getSize() == simplexSize)
+        {
+          Indices simplex(simplexSize);
+          simplex.fill(); // orientation may be incorrect
+          pieceMeshes.add(Mesh(vertices, IndicesCollection(Collection<Indices>(1, simplex))));
+        }
+        else
+          pieceMeshes.add(cloudMesher.build(vertices));
+      }
+    }
   }
-  LOGDEBUG(OSS() << "recompression fullSize=" << fullSize << " compressedSize=" << verticesCompressed.getSize());
+  clippingTimer.stop();
+  statistics.add("pairsTested", testedNumber);
+  statistics.add("pairsPruned", prunedNumber);
+  statistics.add("cddCalls", cddCallsNumber);
+  statistics.add("clippedSimplices", clippedNumber);
 
-  // renumber vertex indices
-  for (UnsignedInteger i = 0; i < simplices.getSize(); ++ i)
-    for (UnsignedInteger j = 0; j <= dimension; ++ j)
-      simplices(i, j) = compressedVertexMap[simplices(i, j)];
-  return Mesh(verticesCompressed, simplices);
+  MeshingTimer concatenationTimer(statistics, "concatenationTime");
+  const Mesh pieceMesh(UnionMesher().build(pieceMeshes));
+  concatenationTimer.stop();
+  MeshingTimer compressTimer(statistics, "compressTime");
+  const Mesh result(CompressMesh(pieceMesh));
+  compressTimer.stop();
+  statistics.add("verticesDeduplicated", pieceMesh.getVerticesNumber() - result.getVerticesNumber());
+  statistics.publish(statistics_);
+  LOGINFO(OSS() << "UnionMesher resolved overlaps simplices=" << simplicesNumber << "->" << result.getSimplicesNumber() << " clipped=" << clippedNumber);
+  return result;
+#else
+  (void)coll;
+  throw NotYetImplementedException(HERE) << "No cddlib support";
+#endif
 }
 
 Mesh UnionMesher::build(const MeshCollection & coll) const
 {
+  MeshingStatistics().publish(statistics_);
   const UnsignedInteger size = coll.getSize();
   if (size == 0)
     return Mesh(Sample(0, 0));
@@ -196,39 +607,105 @@ Mesh UnionMesher::build(const MeshCollection & coll) const
     if (coll[i].getDimension() != dimension)
       throw InvalidArgumentException(HERE) << "UnionMesher expected meshes of same dimension";
 
-  UnsignedInteger simplicesNumber = 0;
-  Sample vertices(0, dimension);
+  if (resolveOverlaps_)
+    return buildDisjoint(coll);
+
+  // prefix sums of vertex and simplex counts give the slot of each mesh
+  MeshingStatistics statistics;
+  MeshingTimer concatenationTimer(statistics, "concatenationTime");
+  Indices vertexOffset(size + 1);
+  Indices simplexOffset(size + 1);
   for (UnsignedInteger i = 0; i < size; ++ i)
   {
-    vertices.add(coll[i].getVertices());
-    simplicesNumber += coll[i].getSimplicesNumber();
+    vertexOffset[i + 1] = vertexOffset[i] + coll[i].getVerticesNumber();
+    simplexOffset[i + 1] = simplexOffset[i] + coll[i].getSimplicesNumber();
   }
-  IndicesCollection simplices(simplicesNumber, dimension + 1);
-  UnsignedInteger simplicesOffset = 0;
-  UnsignedInteger vertexOffset = 0;
-  for (UnsignedInteger i = 0; i < size; ++ i)
+  Sample vertices(vertexOffset[size], dimension);
+  IndicesCollection simplices(simplexOffset[size], dimension + 1);
+  if (vertexOffset[size])
   {
-    IndicesCollection simplicesI(coll[i].getSimplices());
-    const UnsignedInteger sizeI = simplicesI.getSize();
-    for (UnsignedInteger j = 0; j < sizeI; ++ j)
-      for (UnsignedInteger k = 0; k <= dimension; ++ k)
-        simplices(simplicesOffset + j, k) = simplicesI(j, k) + vertexOffset;
-    simplicesOffset += sizeI;
-    vertexOffset += coll[i].getVerticesNumber();
+    UnsignedInteger * simplicesData = simplexOffset[size] ? &simplices(0, 0) : nullptr;
+    const UnionMeshPolicy<Mesh, UnsignedInteger> policy(coll, dimension, vertexOffset, simplexOffset, &vertices(0, 0), simplicesData);
+    TBBImplementation::ParallelFor(0, size, policy);
   }
+  concatenationTimer.stop();
+  statistics.publish(statistics_);
   return Mesh(vertices, simplices);
 }
 
+/* The disjoint union is concatenated directly with 32-bit indices */
+CompactMesh UnionMesher::buildCompact(const CompactMeshCollection & coll) const
+{
+  const UnsignedInteger size = coll.getSize();
+  if (size == 1)
+    return coll[0];
+  if (!size || resolveOverlaps_)
+  {
+    // the overlap resolution works on the regular meshes
+    MeshCollection meshes(size);
+    for (UnsignedInteger i = 0; i < size; ++ i)
+      meshes[i] = coll[i].getMesh();
+    return CompactMesh(build(meshes));
+  }
+
+  MeshingStatistics().publish(statistics_);
+  const UnsignedInteger dimension = coll[0].getDimension();
+  for (UnsignedInteger i = 1; i < size; ++ i)
+    if (coll[i].getDimension() != dimension)
+      throw InvalidArgumentException(HERE) << "UnionMesher expected meshes of same dimension";
+
+  MeshingStatistics statistics;
+  MeshingTimer concatenationTimer(statistics, "concatenationTime");
+  Indices vertexOffset(size + 1);
+  Indices simplexOffset(size + 1);
+  for (UnsignedInteger i = 0; i < size; ++ i)
+  {
+    vertexOffset[i + 1] = vertexOffset[i] + coll[i].getVerticesNumber();
+    simplexOffset[i + 1] = simplexOffset[i] + coll[i].getSimplicesNumber();
+  }
+  if (vertexOffset[size] > std::numeric_limits<std::uint32_t>::max())
+    throw InvalidArgumentException(HERE) << "UnionMesher cannot index " << vertexOffset[size] << " vertices on 32 bits";
+  Sample vertices(vertexOffset[size], dimension);
+  CompactMesh::IndexStorage simplices(simplexOffset[size] * (dimension + 1));
+  if (vertexOffset[size])
+  {
+    const UnionMeshPolicy<CompactMesh, std::uint32_t> policy(coll, dimension, vertexOffset, simplexOffset, &vertices(0, 0), simplices.data());
+    TBBImplementation::ParallelFor(0, size, policy);
+  }
+  concatenationTimer.stop();
+  statistics.publish(statistics_);
+  return CompactMesh(vertices, std::move(simplices));
+}
+
+/* Statistics accessor */
+PointWithDescription UnionMesher::getStatistics() const
+{
+  return MeshingStatistics::Read(statistics_);
+}
+
+/* Overlap resolution flag accessor */
+void UnionMesher::setResolveOverlaps(const Bool resolveOverlaps)
+{
+  resolveOverlaps_ = resolveOverlaps;
+}
+
+Bool UnionMesher::getResolveOverlaps() const
+{
+  return resolveOverlaps_;
+}
+
 /* Method save() stores the object through the StorageManager */
 void UnionMesher::save(Advocate & adv) const
 {
   PersistentObject::save(adv);
+  adv.saveAttribute("resolveOverlaps_", resolveOverlaps_);
 }
 
 /* Method load() reloads the object from the StorageManager */
 void UnionMesher::load(Advocate & adv)
 {
   PersistentObject::load(adv);
+  adv.loadAttribute("resolveOverlaps_", resolveOverlaps_);
 }
 
 }
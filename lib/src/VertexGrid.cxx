@@ -0,0 +1,82 @@
+//                                               -*- C++ -*-
+/**
+ *  @brief Grid of the vertices within a tolerance
+ *
+ *  Copyright 2005-2026 Airbus-EDF-IMACS-ONERA-Phimeca
+ *
+ *  This library is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License
+ *  along with this library.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+#include "VertexGrid.hxx"
+
+#include <numeric>
+
+#include <openturns/SpecFunc.hxx>
+#include <openturns/TBBImplementation.hxx>
+
+using namespace OT;
+
+namespace OTMESHING
+{
+
+/* Cell of each vertex */
+struct VertexGridKeyPolicy
+{
+  VertexGrid & grid_;
+
+  explicit VertexGridKeyPolicy(VertexGrid & grid)
+    : grid_(grid)
+  {}
+
+  inline void operator()(const TBBImplementation::BlockedRange<UnsignedInteger> & r) const
+  {
+    const UnsignedInteger dimension = grid_.dimension_;
+    for (UnsignedInteger i = r.begin(); i != r.end(); ++ i)
+      for (UnsignedInteger k = 0; k < dimension; ++ k)
+        grid_.keys_[i * dimension + k] = static_cast<SignedInteger>(std::floor((grid_.data_[i * dimension + k] - grid_.origin_[k]) / grid_.cellSize_));
+  }
+}; /* end struct VertexGridKeyPolicy */
+
+VertexGrid::VertexGrid(const Scalar * data,
+                       const UnsignedInteger size,
+                       const UnsignedInteger dimension,
+                       const Scalar tolerance)
+  : data_(data)
+  , dimension_(dimension)
+  , tolerance_(tolerance)
+  , cellSize_(tolerance > 0.0 ? 4.0 * tolerance : 1.0)
+  , origin_(dimension, SpecFunc::MaxScalar)
+  , keys_(size * dimension)
+  , order_(size)
+{
+  for (UnsignedInteger i = 0; i < size; ++ i)
+    for (UnsignedInteger k = 0; k < dimension; ++ k)
+      origin_[k] = std::min(origin_[k], data[i * dimension + k]);
+  if (!size)
+    return;
+  const VertexGridKeyPolicy keyPolicy(*this);
+  TBBImplementation::ParallelFor(0, size, keyPolicy);
+  std::iota(order_.begin(), order_.end(), 0);
+  // ties are broken by index, so the vertices of a cell are sorted
+  const SignedInteger * keys = keys_.data();
+  TBBImplementation::ParallelSort(order_.begin(), order_.end(), [keys, dimension](const UnsignedInteger a, const UnsignedInteger b)
+  {
+    for (UnsignedInteger k = 0; k < dimension; ++ k)
+      if (keys[a * dimension + k] != keys[b * dimension + k])
+        return keys[a * dimension + k] < keys[b * dimension + k];
+    return a < b;
+  });
+}
+
+}
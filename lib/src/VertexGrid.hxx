@@ -0,0 +1,109 @@
+//                                               -*- C++ -*-
+/**
+ *  @brief Grid of the vertices within a tolerance
+ *
+ *  Copyright 2005-2026 Airbus-EDF-IMACS-ONERA-Phimeca
+ *
+ *  This library is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License
+ *  along with this library.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+#ifndef OTMESHING_VERTEXGRID_HXX
+#define OTMESHING_VERTEXGRID_HXX
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include <openturns/Point.hxx>
+
+namespace OTMESHING
+{
+
+/**
+ * Vertices snapped to a regular grid over all their components.
+ * The cell keys are stored in a flat array and the vertices are sorted by
+ * key in parallel, so the vertices of a cell are found by binary search.
+ * The cells are four tolerances wide: the vertices within the tolerance of
+ * a point are in its cell, or in the neighbouring cells along the components
+ * where the point is close to a face of its cell.
+ * The vertex block is read in place, it must outlive the grid.
+ */
+class VertexGrid
+{
+public:
+  VertexGrid(const OT::Scalar * data,
+             const OT::UnsignedInteger size,
+             const OT::UnsignedInteger dimension,
+             const OT::Scalar tolerance);
+
+  /** Call visitor(j) on the vertices of the cells reachable from x until it returns true, then return true */
+  template <class Visitor>
+  OT::Bool visit(const OT::Scalar * x, const Visitor & visitor) const
+  {
+    std::vector<OT::SignedInteger> cell(dimension_);
+    std::vector<OT::SignedInteger> lowOffset(dimension_);
+    std::vector<OT::SignedInteger> highOffset(dimension_);
+    std::vector<OT::SignedInteger> neighbour(dimension_);
+    for (OT::UnsignedInteger k = 0; k < dimension_; ++ k)
+    {
+      const OT::Scalar t = (x[k] - origin_[k]) / cellSize_;
+      cell[k] = static_cast<OT::SignedInteger>(std::floor(t));
+      const OT::Scalar position = (t - cell[k]) * cellSize_;
+      lowOffset[k] = (position <= tolerance_) ? -1 : 0;
+      highOffset[k] = (position >= cellSize_ - tolerance_) ? 1 : 0;
+      neighbour[k] = cell[k] + lowOffset[k];
+    }
+    // odometer over the reachable cells
+    while (true)
+    {
+      const OT::SignedInteger * key = neighbour.data();
+      const OT::UnsignedInteger dimension = dimension_;
+      const OT::SignedInteger * keys = keys_.data();
+      const std::vector<OT::UnsignedInteger>::const_iterator first = std::lower_bound(order_.begin(), order_.end(), key,
+          [keys, dimension](const OT::UnsignedInteger i, const OT::SignedInteger * value)
+      {
+        return std::lexicographical_compare(keys + i * dimension, keys + (i + 1) * dimension, value, value + dimension);
+      });
+      for (std::vector<OT::UnsignedInteger>::const_iterator it = first; (it != order_.end()) && std::equal(key, key + dimension, keys + *it * dimension); ++ it)
+        if (visitor(*it))
+          return true;
+      OT::UnsignedInteger k = 0;
+      while ((k < dimension_) && (neighbour[k] == cell[k] + highOffset[k]))
+      {
+        neighbour[k] = cell[k] + lowOffset[k];
+        ++ k;
+      }
+      if (k == dimension_)
+        return false;
+      ++ neighbour[k];
+    }
+  }
+
+private:
+  friend struct VertexGridKeyPolicy;
+
+  const OT::Scalar * data_;
+  OT::UnsignedInteger dimension_;
+  OT::Scalar tolerance_;
+  OT::Scalar cellSize_;
+  OT::Point origin_;
+
+  // cell of each vertex, row-major, and the vertices sorted by cell
+  std::vector<OT::SignedInteger> keys_;
+  std::vector<OT::UnsignedInteger> order_;
+};
+
+}
+
+#endif /* OTMESHING_VERTEXGRID_HXX */
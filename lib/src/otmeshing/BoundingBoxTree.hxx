@@ -0,0 +1,96 @@
+//                                               -*- C++ -*-
+/**
+ *  @brief Bounding box index over mesh simplices
+ *
+ *  Copyright 2005-2026 Airbus-EDF-IMACS-ONERA-Phimeca
+ *
+ *  This library is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License
+ *  along with this library.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+#ifndef OTMESHING_BOUNDINGBOXTREE_HXX
+#define OTMESHING_BOUNDINGBOXTREE_HXX
+
+#include <openturns/Mesh.hxx>
+#include <openturns/IndicesCollection.hxx>
+#include <openturns/Interval.hxx>
+#include "otmeshing/otmeshingprivate.hxx"
+
+namespace OTMESHING
+{
+
+/**
+ * @class BoundingBoxTree
+ *
+ * Spatial index over the bounding boxes of the simplices of a mesh
+ */
+class OTMESHING_API BoundingBoxTree
+  : public OT::PersistentObject
+{
+  CLASSNAME
+
+public:
+  /** Default constructor */
+  BoundingBoxTree();
+
+  /** Parameters constructor */
+  explicit BoundingBoxTree(const OT::Mesh & mesh);
+
+  /** Virtual constructor method */
+  BoundingBoxTree * clone() const override;
+
+  /** Indexed mesh accessor */
+  OT::Mesh getMesh() const;
+
+  /** Indices of the simplices whose bounding box contains the point */
+  OT::Indices queryContaining(const OT::Point & x) const;
+  OT::IndicesCollection queryContaining(const OT::Sample & sample) const;
+
+  /** Indices of the simplices whose bounding box is within a distance of the point */
+  OT::Indices queryWithinDistance(const OT::Point & x, const OT::Scalar radius) const;
+
+  /** Indices of the simplices whose bounding box intersects the interval */
+  OT::Indices queryIntersecting(const OT::Interval & box) const;
+
+  /** String converter */
+  OT::String __repr__() const override;
+
+  /** Method save() stores the object through the StorageManager */
+  void save(OT::Advocate & adv) const override;
+
+  /** Method load() reloads the object from the StorageManager */
+  void load(OT::Advocate & adv) override;
+
+private:
+  void initialize();
+
+  OT::Mesh mesh_;
+
+  // bounding boxes of the simplices
+  OT::Sample lowerBounds_;
+  OT::Sample upperBounds_;
+
+  // bounding volume hierarchy: the boxes of the nodes, the range of each node
+  // in order_ and the index of its first child, 0 for a leaf
+  OT::Sample nodeLowerBounds_;
+  OT::Sample nodeUpperBounds_;
+  OT::Indices nodeRanges_;
+  OT::Indices nodeChildren_;
+  OT::Indices order_;
+  OT::Scalar tolerance_ = 0.0;
+
+}; /* class BoundingBoxTree */
+
+} /* namespace OTMESHING */
+
+#endif /* OTMESHING_BOUNDINGBOXTREE_HXX */
@@ -0,0 +1,103 @@
+//                                               -*- C++ -*-
+/**
+ *  @brief Cooperative cancellation of the builds
+ *
+ *  Copyright 2005-2026 Airbus-EDF-IMACS-ONERA-Phimeca
+ *
+ *  This library is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License
+ *  along with this library.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+#ifndef OTMESHING_CANCELLATIONTOKEN_HXX
+#define OTMESHING_CANCELLATIONTOKEN_HXX
+
+#include <openturns/Exception.hxx>
+#include <openturns/PersistentObject.hxx>
+#include <openturns/StorageManager.hxx>
+#include "otmeshing/otmeshingprivate.hxx"
+
+#include <atomic>
+#include <memory>
+
+namespace OTMESHING
+{
+
+/** Progress callback of the builds, called with the fraction done in [0, 1] and the current phase */
+typedef void (*ProgressCallback)(OT::Scalar fraction, const char * phase, void * state);
+
+/** State of a progress callback, shared by the copies of a mesher and released with the last one */
+typedef std::shared_ptr<void> ProgressCallbackState;
+
+/**
+ * Exception thrown by a build stopped by a cancellation token or a time budget,
+ * so that an interruption is caught apart from a failure
+ */
+class OTMESHING_API InterruptionException
+  : public OT::Exception
+{
+public:
+  explicit InterruptionException(const OT::PointInSourceFile & point);
+  virtual ~InterruptionException() throw();
+
+  template <class T> InterruptionException & operator << (T obj)
+  {
+    this->Exception::operator << (obj);
+    return *this;
+  }
+};
+
+/**
+ * @class CancellationToken
+ *
+ * Flag shared by the copies of the token, a build checks it regularly and
+ * stops once it is set, possibly from another thread
+ */
+class OTMESHING_API CancellationToken
+  : public OT::PersistentObject
+{
+  CLASSNAME
+
+public:
+  /** Default constructor */
+  CancellationToken();
+
+  /** Virtual constructor method */
+  CancellationToken * clone() const override;
+
+  /** Request the cancellation of the builds sharing this token */
+  void cancel();
+
+  /** Withdraw the request so that the token can be reused */
+  void reset();
+
+  /** Cancellation request accessor */
+  OT::Bool isCancelled() const;
+
+  /** Prefix of the messages of the exceptions thrown by the interrupted builds */
+  static OT::String GetInterruptionPrefix();
+
+  /** Whether an exception message comes from an InterruptionException, as opposed to a failure */
+  static OT::Bool IsInterruption(const OT::String & message);
+
+  /** String converter */
+  OT::String __repr__() const override;
+
+private:
+  // copies share the flag
+  OT::Pointer<std::atomic<bool> > cancelled_;
+
+}; /* class CancellationToken */
+
+} /* namespace OTMESHING */
+
+#endif /* OTMESHING_CANCELLATIONTOKEN_HXX */
@@ -24,6 +24,9 @@
 #include <openturns/PersistentObject.hxx>
 #include <openturns/StorageManager.hxx>
 #include <openturns/Mesh.hxx>
+#include <openturns/PointWithDescription.hxx>
+#include "otmeshing/CancellationToken.hxx"
+#include "otmeshing/CompactMesh.hxx"
 #include "otmeshing/otmeshingprivate.hxx"
 
 namespace OTMESHING
@@ -51,6 +54,40 @@ public:
   /** example of a func that return a point squared. **/
   OT::Mesh build(const OT::Sample & points) const;
 
+  /** Generate mesh from a contiguous row-major buffer of size x dimension points */
+  OT::Mesh build(const OT::Scalar * data, const OT::UnsignedInteger size, const OT::UnsignedInteger dimension) const;
+
+  /** Generate mesh with 32-bit simplex indices */
+  CompactMesh buildCompact(const OT::Sample & points) const;
+
+  /** Predicted number of simplices and memory in bytes of a build, from sampled sub-triangulations */
+  OT::PointWithDescription estimate(const OT::Sample & points) const;
+
+  /** Memory budget of a build in bytes, checked against the prediction before the build, no budget when zero */
+  void setMaximumMemory(const OT::UnsignedInteger maximumMemory);
+  OT::UnsignedInteger getMaximumMemory() const;
+
+  /** Whether a Delaunay build above the budget falls back to the basic triangulation instead of failing */
+  void setMemoryFallback(const OT::Bool memoryFallback);
+  OT::Bool getMemoryFallback() const;
+
+  /** Cancellation token accessor, the token is checked between batches of inserted points */
+  void setCancellationToken(const CancellationToken & cancellationToken);
+  CancellationToken getCancellationToken() const;
+
+  /** Wall-clock budget of a build in seconds, no budget when not positive */
+  void setMaximumTimeDuration(const OT::Scalar maximumTimeDuration);
+  OT::Scalar getMaximumTimeDuration() const;
+
+  /** Progress callback accessor, the state is borrowed */
+  void setProgressCallback(ProgressCallback callBack, void * state = nullptr);
+
+  /** Progress callback accessor, the state is owned by the copies of the mesher */
+  void setProgressCallback(ProgressCallback callBack, const ProgressCallbackState & state);
+
+  /** Phase times and counters of the last build, recorded when the MeshingStatistics-Enabled key is true */
+  OT::PointWithDescription getStatistics() const;
+
   /** String converter */
   OT::String __repr__() const override;
 
@@ -62,6 +99,14 @@ public:
 
 private:
   OT::UnsignedInteger triangulationMethod_ = BASIC;
+  OT::UnsignedInteger maximumMemory_ = 0;
+  OT::Bool memoryFallback_ = false;
+  mutable OT::PointWithDescription statistics_;
+
+  // the build controls are not saved
+  CancellationToken cancellationToken_;
+  OT::Scalar maximumTimeDuration_ = 0.0;
+  std::pair<ProgressCallback, ProgressCallbackState> progressCallback_;
 
 }; /* class CloudMesher */
 
@@ -0,0 +1,105 @@
+//                                               -*- C++ -*-
+/**
+ *  @brief Mesh with 32-bit simplex indices
+ *
+ *  Copyright 2005-2026 Airbus-EDF-IMACS-ONERA-Phimeca
+ *
+ *  This library is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License
+ *  along with this library.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+#ifndef OTMESHING_COMPACTMESH_HXX
+#define OTMESHING_COMPACTMESH_HXX
+
+#include <openturns/PersistentObject.hxx>
+#include <openturns/StorageManager.hxx>
+#include <openturns/Mesh.hxx>
+#include "otmeshing/otmeshingprivate.hxx"
+
+#include <cstdint>
+#include <vector>
+
+namespace OTMESHING
+{
+
+/**
+ * @class CompactMesh
+ *
+ * Mesh storing its simplices with 32-bit indices, half the size of the
+ * indices of OT::Mesh, for meshes of less than 2^32 vertices
+ */
+class OTMESHING_API CompactMesh
+  : public OT::PersistentObject
+{
+  CLASSNAME
+
+public:
+  typedef std::vector<std::uint32_t> IndexStorage;
+
+  /** Default constructor */
+  CompactMesh();
+
+  /** Conversion from a mesh */
+  explicit CompactMesh(const OT::Mesh & mesh);
+
+  /** Parameters constructors */
+  CompactMesh(const OT::Sample & vertices,
+              const OT::IndicesCollection & simplices);
+
+  /** The indices are moved, row after row, dimension + 1 per simplex */
+  CompactMesh(const OT::Sample & vertices,
+              IndexStorage && simplices);
+
+  /** Virtual constructor method */
+  CompactMesh * clone() const override;
+
+  /** Dimension accessor */
+  OT::UnsignedInteger getDimension() const;
+
+  /** Vertices accessors */
+  OT::UnsignedInteger getVerticesNumber() const;
+  OT::Sample getVertices() const;
+
+  /** Simplices accessors, the indices are widened */
+  OT::UnsignedInteger getSimplicesNumber() const;
+  OT::IndicesCollection getSimplices() const;
+  OT::Indices getSimplex(const OT::UnsignedInteger index) const;
+
+  /** Contiguous 32-bit indices, row after row */
+  const std::uint32_t * getSimplicesData() const;
+
+  /** Conversion to a mesh */
+  OT::Mesh getMesh() const;
+
+  /** String converter */
+  OT::String __repr__() const override;
+
+  /** Method save() stores the object through the StorageManager */
+  void save(OT::Advocate & adv) const override;
+
+  /** Method load() reloads the object from the StorageManager */
+  void load(OT::Advocate & adv) override;
+
+private:
+  void checkIndices() const;
+
+  OT::Sample vertices_;
+
+  // the indices are immutable, so they are shared by copies
+  OT::Pointer<IndexStorage> simplices_;
+
+}; /* class CompactMesh */
+
+} /* namespace OTMESHING */
+
+#endif /* OTMESHING_COMPACTMESH_HXX */
@@ -24,11 +24,15 @@
 #include <openturns/PersistentObject.hxx>
 #include <openturns/StorageManager.hxx>
 #include <openturns/Mesh.hxx>
+#include <openturns/PointWithDescription.hxx>
 #include "otmeshing/otmeshingprivate.hxx"
+#include "otmeshing/CancellationToken.hxx"
 
 namespace OTMESHING
 {
 
+class MeshingMonitor;
+
 /**
  * @class ConvexDecompositionMesher
  *
@@ -40,9 +44,10 @@ class OTMESHING_API ConvexDecompositionMesher
   CLASSNAME
 
 public:
- 
+  enum DecompositionMethod {EXACT, APPROXIMATE};
+
   /** Default constructor */
-  ConvexDecompositionMesher();
+  explicit ConvexDecompositionMesher(const DecompositionMethod method = EXACT);
 
   /** Virtual constructor method */
   ConvexDecompositionMesher * clone() const override;
@@ -56,6 +61,31 @@ public:
   /** Check if mesh is convex */
   static OT::Bool IsConvex(const OT::Mesh & mesh);
 
+  /** Concavity tolerance accessor, for the approximate method */
+  void setConcavityTolerance(const OT::Scalar concavityTolerance);
+  OT::Scalar getConcavityTolerance() const;
+
+  /** Maximum number of parts accessor, for the approximate method */
+  void setMaximumPartNumber(const OT::UnsignedInteger maximumPartNumber);
+  OT::UnsignedInteger getMaximumPartNumber() const;
+
+  /** Cancellation token accessor, the token is checked between the unions and the parts */
+  void setCancellationToken(const CancellationToken & cancellationToken);
+  CancellationToken getCancellationToken() const;
+
+  /** Wall-clock budget of a build in seconds, no budget when not positive */
+  void setMaximumTimeDuration(const OT::Scalar maximumTimeDuration);
+  OT::Scalar getMaximumTimeDuration() const;
+
+  /** Progress callback accessor, the state is borrowed */
+  void setProgressCallback(ProgressCallback callBack, void * state = nullptr);
+
+  /** Progress callback accessor, the state is owned by the copies of the mesher */
+  void setProgressCallback(ProgressCallback callBack, const ProgressCallbackState & state);
+
+  /** Phase times and counters of the last build, recorded when the MeshingStatistics-Enabled key is true */
+  OT::PointWithDescription getStatistics() const;
+
   /** Method save() stores the object through the StorageManager */
   void save(OT::Advocate & adv) const override;
 
@@ -63,6 +93,17 @@ public:
   void load(OT::Advocate & adv) override;
 
 private:
+  OT::Collection<OT::Mesh> buildApproximate(const OT::Mesh & mesh, MeshingMonitor & monitor) const;
+
+  OT::UnsignedInteger decompositionMethod_ = EXACT;
+  OT::Scalar concavityTolerance_ = 0.05;
+  OT::UnsignedInteger maximumPartNumber_ = 64;
+  mutable OT::PointWithDescription statistics_;
+
+  // the build controls are not saved
+  CancellationToken cancellationToken_;
+  OT::Scalar maximumTimeDuration_ = 0.0;
+  std::pair<ProgressCallback, ProgressCallbackState> progressCallback_;
 
 }; /* class ConvexDecompositionMesher */
 
@@ -24,6 +24,7 @@
 #include <openturns/PersistentObject.hxx>
 #include <openturns/StorageManager.hxx>
 #include <openturns/Mesh.hxx>
+#include <openturns/PointWithDescription.hxx>
 #include "otmeshing/otmeshingprivate.hxx"
 
 namespace OTMESHING
@@ -49,6 +50,12 @@ public:
   /** example of a func that return a point squared. **/
   OT::Mesh build(const OT::Sample & points) const;
 
+  /** Generate the hull from a contiguous row-major buffer of size x dimension points */
+  OT::Mesh build(const OT::Scalar * data, const OT::UnsignedInteger size, const OT::UnsignedInteger dimension) const;
+
+  /** Phase times and counters of the last build, recorded when the MeshingStatistics-Enabled key is true */
+  OT::PointWithDescription getStatistics() const;
+
   /** String converter */
   OT::String __repr__() const override;
 
@@ -59,6 +66,7 @@ public:
   void load(OT::Advocate & adv) override;
 
 private:
+  mutable OT::PointWithDescription statistics_;
 
 }; /* class ConvexHullMesher */
 
@@ -21,17 +21,21 @@
 #ifndef OTMESHING_CYLINDER_HXX
 #define OTMESHING_CYLINDER_HXX
 
+#include <openturns/DomainImplementation.hxx>
 #include <openturns/Mesh.hxx>
+#include "otmeshing/MeshDomain2.hxx"
 #include "otmeshing/otmeshingprivate.hxx"
 
 namespace OTMESHING
 {
 
+class CylinderBaseDomain;
+
 /**
  * @class Cylinder
  */
 class OTMESHING_API Cylinder
-  : public OT::PersistentObject
+  : public OT::DomainImplementation
 {
   CLASSNAME
 public:
@@ -57,12 +61,25 @@ public:
   /** Vertices accessor */
   OT::Sample getVertices() const;
 
+  /** Product mesh accessor */
+  OT::Mesh getMesh() const;
+
   /** BBox accessor */
   OT::Interval getBoundingBox() const;
 
   /** Volume accessor */
   OT::Scalar getVolume() const;
 
+  /** Check if the given points are inside of the domain */
+  using OT::DomainImplementation::contains;
+  OT::Bool contains(const OT::Point & point) const override;
+  BoolCollection contains(const OT::Sample & sample) const override;
+
+  /** Compute the signed Euclidean distance from given points to the domain */
+  using OT::DomainImplementation::computeDistance;
+  OT::Scalar computeDistance(const OT::Point & point) const override;
+  OT::Sample computeDistance(const OT::Sample & sample) const override;
+
   /** Method save() stores the object through the StorageManager */
   void save(OT::Advocate & adv) const override;
 
@@ -73,6 +90,9 @@ protected:
   void initialize();
 
   OT::Point combine(const OT::Point & pBase, const OT::Point & pExtension) const;
+
+  /** Distance queries on the base, built on the first query */
+  MeshDomain2 getBaseDomain() const;
   
   OT::Mesh base_;
   OT::Interval extension_;
@@ -81,8 +101,10 @@ protected:
 
   OT::UnsignedInteger baseDimension_ = 0;
   OT::UnsignedInteger extensionDimension_ = 0;
-  OT::UnsignedInteger dimension_ = 0;
   OT::Indices complement_;
+
+  // distance queries on the base, in the complement coordinates, built once and shared by copies
+  OT::Pointer<CylinderBaseDomain> baseDomain_;
 private:
 
 }; /* class Cylinder */
@@ -22,12 +22,17 @@
 #define OTMESHING_INTERSECTIONMESHER_HXX
 
 #include <openturns/Mesh.hxx>
+#include <openturns/PointWithDescription.hxx>
 #include "otmeshing/otmeshingprivate.hxx"
 #include "otmeshing/Cylinder.hxx"
+#include "otmeshing/CancellationToken.hxx"
 
 namespace OTMESHING
 {
 
+class MeshingMonitor;
+class MeshingStatistics;
+
 /**
  * @class IntersectionMesher
  */
@@ -64,6 +69,27 @@ public:
   void setRecompress(const OT::Bool recompress);
   OT::Bool getRecompress() const;
 
+  /** Compaction flag accessor */
+  void setCompact(const OT::Bool compact);
+  OT::Bool getCompact() const;
+
+  /** Cancellation token accessor, the token is checked between simplex pairs */
+  void setCancellationToken(const CancellationToken & cancellationToken);
+  CancellationToken getCancellationToken() const;
+
+  /** Wall-clock budget of a build in seconds, no budget when not positive */
+  void setMaximumTimeDuration(const OT::Scalar maximumTimeDuration);
+  OT::Scalar getMaximumTimeDuration() const;
+
+  /** Progress callback accessor, the state is borrowed */
+  void setProgressCallback(ProgressCallback callBack, void * state = nullptr);
+
+  /** Progress callback accessor, the state is owned by the copies of the mesher */
+  void setProgressCallback(ProgressCallback callBack, const ProgressCallbackState & state);
+
+  /** Phase times and counters of the last build, recorded when the MeshingStatistics-Enabled key is true */
+  OT::PointWithDescription getStatistics() const;
+
   /** Method save() stores the object through the StorageManager */
   void save(OT::Advocate & adv) const override;
 
@@ -71,9 +97,18 @@ public:
   void load(OT::Advocate & adv) override;
 
 protected:
-  OT::Mesh build2(const OT::Mesh & mesh1, const OT::Mesh & mesh2) const;
+  /** The statistics of a build are recorded locally and published once at its end */
+  OT::Mesh build2(const OT::Mesh & mesh1, const OT::Mesh & mesh2, MeshingMonitor & monitor, MeshingStatistics & statistics) const;
+  OT::Mesh buildConvex(const MeshCollection & coll, MeshingStatistics & statistics) const;
 
   OT::Bool recompress_ = true;
+  OT::Bool compact_ = false;
+  mutable OT::PointWithDescription statistics_;
+
+  // the build controls are not saved
+  CancellationToken cancellationToken_;
+  OT::Scalar maximumTimeDuration_ = 0.0;
+  std::pair<ProgressCallback, ProgressCallbackState> progressCallback_;
 private:
 
 }; /* class IntersectionMesher */
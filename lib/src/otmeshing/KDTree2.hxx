@@ -0,0 +1,87 @@
+//                                               -*- C++ -*-
+/**
+ *  @brief Nearest neighbour spatial index
+ *
+ *  Copyright 2005-2026 Airbus-EDF-IMACS-ONERA-Phimeca
+ *
+ *  This library is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License
+ *  along with this library.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+#ifndef OTMESHING_KDTREE2_HXX
+#define OTMESHING_KDTREE2_HXX
+
+#include <openturns/PersistentObject.hxx>
+#include <openturns/StorageManager.hxx>
+#include <openturns/Sample.hxx>
+#include <openturns/IndicesCollection.hxx>
+#include "otmeshing/otmeshingprivate.hxx"
+
+namespace OTMESHING
+{
+
+class KDTree2Index;
+
+/**
+ * @class KDTree2
+ *
+ * Spatial index over a set of points, built once and queried by batches
+ */
+class OTMESHING_API KDTree2
+  : public OT::PersistentObject
+{
+  CLASSNAME
+
+public:
+  /** Default constructor */
+  KDTree2();
+
+  /** Parameters constructor */
+  explicit KDTree2(const OT::Sample & points);
+
+  /** Virtual constructor method */
+  KDTree2 * clone() const override;
+
+  /** Indexed points accessor */
+  OT::Sample getPoints() const;
+
+  /** Indices of the k nearest points, by increasing distance */
+  OT::Indices queryNearest(const OT::Point & x, const OT::UnsignedInteger k) const;
+  OT::IndicesCollection queryNearest(const OT::Sample & sample, const OT::UnsignedInteger k) const;
+
+  /** Indices of the points within a given radius, by increasing distance */
+  OT::Indices queryRadius(const OT::Point & x, const OT::Scalar radius) const;
+  OT::IndicesCollection queryRadius(const OT::Sample & sample, const OT::Scalar radius) const;
+
+  /** String converter */
+  OT::String __repr__() const override;
+
+  /** Method save() stores the object through the StorageManager */
+  void save(OT::Advocate & adv) const override;
+
+  /** Method load() reloads the object from the StorageManager */
+  void load(OT::Advocate & adv) override;
+
+private:
+  void initialize();
+
+  OT::Sample points_;
+
+  // the index is immutable once built, so it is shared by copies
+  OT::Pointer<KDTree2Index> index_;
+
+}; /* class KDTree2 */
+
+} /* namespace OTMESHING */
+
+#endif /* OTMESHING_KDTREE2_HXX */
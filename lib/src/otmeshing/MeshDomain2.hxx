@@ -22,11 +22,15 @@
 #define OTMESHING_MESHDOMAIN2_HXX
 
 #include <openturns/MeshDomain.hxx>
+#include <openturns/PointWithDescription.hxx>
+#include "otmeshing/CompactMesh.hxx"
 #include "otmeshing/otmeshingprivate.hxx"
 
 namespace OTMESHING
 {
 
+class MeshDomain2Index;
+
 /**
  * @class MeshDomain2
  */
@@ -49,9 +53,38 @@ public:
   OT::Scalar computeDistance(const OT::Point & point) const override;
   OT::Sample computeDistance(const OT::Sample & point) const override;
 
+  /** Compute the distances from a contiguous row-major buffer of size x dimension points */
+  OT::Sample computeDistance(const OT::Scalar * points, const OT::UnsignedInteger size, const OT::UnsignedInteger dimension) const;
+
+  /** Signed distances with the closest points of the boundary, the index of their facet in getBoundary() and its outward unit normal */
+  OT::Sample computeProjection(const OT::Sample & points,
+                               OT::Sample & closestPoints,
+                               OT::Indices & facetIndices,
+                               OT::Sample & normals) const;
+
+  /** Boundary facets, referenced by a single simplex of the mesh */
+  OT::Mesh getBoundary() const;
+
+  /** Compute the distances to a mesh with 32-bit indices, without converting it */
+  static OT::Sample ComputeDistance(const CompactMesh & mesh, const OT::Sample & points);
+
+  /** Tree build time of the domain and query time of the last distance computation, recorded when the MeshingStatistics-Enabled key is true */
+  OT::PointWithDescription getStatistics() const;
+
+  /** Method load() reloads the object from the StorageManager */
+  void load(OT::Advocate & adv) override;
+
 protected:
-  
+  mutable OT::PointWithDescription statistics_;
+
 private:
+  void initialize();
+
+  // boundary facets, each row ends with the vertex of its cell opposite to the facet
+  OT::IndicesCollection boundary_;
+
+  // the distance trees and the inside test of the boundary, immutable once built, so they are shared by copies
+  OT::Pointer<MeshDomain2Index> index_;
 
 }; /* class MeshDomain2 */
 
@@ -0,0 +1,103 @@
+//                                               -*- C++ -*-
+/**
+ *  @brief Memory-mapped binary mesh file
+ *
+ *  Copyright 2005-2026 Airbus-EDF-IMACS-ONERA-Phimeca
+ *
+ *  This library is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License
+ *  along with this library.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+#ifndef OTMESHING_MESHFILE_HXX
+#define OTMESHING_MESHFILE_HXX
+
+#include <openturns/PersistentObject.hxx>
+#include <openturns/StorageManager.hxx>
+#include <openturns/Mesh.hxx>
+#include "otmeshing/otmeshingprivate.hxx"
+
+namespace OTMESHING
+{
+
+class MeshFileMapping;
+
+/**
+ * @class MeshFile
+ *
+ * Binary mesh file made of a header, a contiguous vertex block and a
+ * contiguous simplex block with 32 or 64-bit indices, read through a
+ * read-only memory mapping
+ */
+class OTMESHING_API MeshFile
+  : public OT::PersistentObject
+{
+  CLASSNAME
+
+public:
+  /** Default constructor */
+  MeshFile();
+
+  /** Map an existing file, only the header and the simplex indices are read */
+  explicit MeshFile(const OT::FileName & fileName);
+
+  /** Virtual constructor method */
+  MeshFile * clone() const override;
+
+  /** Write a mesh, with 32-bit indices when compactIndices is true */
+  static void Write(const OT::Mesh & mesh,
+                    const OT::FileName & fileName,
+                    const OT::Bool compactIndices = true);
+
+  /** File name accessor */
+  OT::FileName getFileName() const;
+
+  /** Header accessors */
+  OT::UnsignedInteger getDimension() const;
+  OT::UnsignedInteger getVerticesNumber() const;
+  OT::UnsignedInteger getSimplicesNumber() const;
+  OT::UnsignedInteger getIndexSize() const;
+
+  /** Random access to the mapped blocks */
+  OT::Point getVertex(const OT::UnsignedInteger index) const;
+  OT::Indices getSimplex(const OT::UnsignedInteger index) const;
+
+  /** Mapped blocks, valid as long as the file is mapped by a copy of this object */
+  const OT::Scalar * getVerticesData() const;
+  const void * getSimplicesData() const;
+
+  /** Copy of the mapped blocks into a mesh */
+  OT::Mesh getMesh() const;
+
+  /** String converter */
+  OT::String __repr__() const override;
+
+  /** Method save() stores the object through the StorageManager */
+  void save(OT::Advocate & adv) const override;
+
+  /** Method load() reloads the object from the StorageManager */
+  void load(OT::Advocate & adv) override;
+
+private:
+  void initialize();
+  void checkMapped() const;
+
+  OT::FileName fileName_;
+
+  // the mapping is read-only, so it is shared by copies
+  OT::Pointer<MeshFileMapping> mapping_;
+
+}; /* class MeshFile */
+
+} /* namespace OTMESHING */
+
+#endif /* OTMESHING_MESHFILE_HXX */
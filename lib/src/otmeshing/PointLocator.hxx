@@ -0,0 +1,108 @@
+//                                               -*- C++ -*-
+/**
+ *  @brief Batch point location in a mesh
+ *
+ *  Copyright 2005-2026 Airbus-EDF-IMACS-ONERA-Phimeca
+ *
+ *  This library is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License
+ *  along with this library.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+#ifndef OTMESHING_POINTLOCATOR_HXX
+#define OTMESHING_POINTLOCATOR_HXX
+
+#include <openturns/Mesh.hxx>
+#include "otmeshing/BoundingBoxTree.hxx"
+#include "otmeshing/KDTree2.hxx"
+
+namespace OTMESHING
+{
+
+/**
+ * @class PointLocator
+ *
+ * Simplex containing each point of a sample, with its barycentric coordinates.
+ * The points are sorted along a Morton curve and each one is located by a walk
+ * through the simplex adjacency started from the simplex of the previous one,
+ * the bounding box tree is used when the walk leaves the mesh.
+ */
+class OTMESHING_API PointLocator
+  : public OT::PersistentObject
+{
+  CLASSNAME
+
+public:
+  /** Default constructor */
+  PointLocator();
+
+  /** Parameters constructor */
+  explicit PointLocator(const OT::Mesh & mesh);
+
+  /** Virtual constructor method */
+  PointLocator * clone() const override;
+
+  /** Indexed mesh accessor */
+  OT::Mesh getMesh() const;
+
+  /** Index of the simplex containing each point, the number of simplices for the points outside of the mesh */
+  OT::UnsignedInteger query(const OT::Point & x) const;
+  OT::Indices query(const OT::Sample & sample) const;
+
+  /** Same with the barycentric coordinates of the points in their simplex, null outside of the mesh */
+  OT::Indices query(const OT::Sample & sample, OT::Sample & barycentricCoordinates) const;
+
+  /** Barycentric interpolation of values given at the vertices, NaN outside of the mesh */
+  OT::Sample interpolate(const OT::Sample & vertexValues, const OT::Sample & sample) const;
+
+  /** Tolerance on the barycentric coordinates of the points on the boundary of a simplex */
+  void setBarycentricCoordinatesEpsilon(const OT::Scalar barycentricCoordinatesEpsilon);
+  OT::Scalar getBarycentricCoordinatesEpsilon() const;
+
+  /** String converter */
+  OT::String __repr__() const override;
+
+  /** Method save() stores the object through the StorageManager */
+  void save(OT::Advocate & adv) const override;
+
+  /** Method load() reloads the object from the StorageManager */
+  void load(OT::Advocate & adv) override;
+
+private:
+  void initialize();
+
+  OT::Mesh mesh_;
+  OT::Scalar barycentricCoordinatesEpsilon_ = 1.0e-12;
+
+  // inverse of the edge matrix of each simplex, row by row, and the flat simplices which have none
+  OT::Sample inverses_;
+  OT::Indices flat_;
+
+  // simplex across the facet opposite to each vertex, the number of simplices on the boundary
+  OT::IndicesCollection neighbours_;
+
+  // one simplex incident to each vertex, where the walks start
+  OT::Indices vertexSimplex_;
+  KDTree2 verticesTree_;
+
+  // candidates of the points the walks could not reach
+  BoundingBoxTree boxTree_;
+
+  // bounding box of the vertices, for the Morton codes
+  OT::Point lowerBound_;
+  OT::Point upperBound_;
+
+}; /* class PointLocator */
+
+} /* namespace OTMESHING */
+
+#endif /* OTMESHING_POINTLOCATOR_HXX */
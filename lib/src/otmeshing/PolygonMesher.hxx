@@ -22,6 +22,7 @@
 #define OTMESHING_POLYGONMESHER_HXX
 
 #include <openturns/Mesh.hxx>
+#include <openturns/PointWithDescription.hxx>
 #include "otmeshing/otmeshingprivate.hxx"
 
 namespace OTMESHING
@@ -51,6 +52,20 @@ public:
   /** Generate mesh */
   virtual OT::Mesh build(const OT::Sample & points) const;
 
+  /** Generate mesh of a polygon with holes */
+  virtual OT::Mesh build(const OT::Sample & outer, const OT::Collection<OT::Sample> & holes) const;
+
+  /** Generate the meshes of several polygons in parallel */
+  OT::Collection<OT::Mesh> buildBatch(const OT::Collection<OT::Sample> & polygons) const;
+
+  /** Generate the meshes of several polygons with holes in parallel, each hole goes to the polygon of its owner index */
+  OT::Collection<OT::Mesh> buildBatch(const OT::Collection<OT::Sample> & outers,
+                                      const OT::Collection<OT::Sample> & holes,
+                                      const OT::Indices & holeOwners) const;
+
+  /** Phase times and counters of the last build, recorded when the MeshingStatistics-Enabled key is true */
+  OT::PointWithDescription getStatistics() const;
+
   /** Method save() stores the object through the StorageManager */
   void save(OT::Advocate & adv) const override;
 
@@ -58,6 +73,7 @@ public:
   void load(OT::Advocate & adv) override;
 
 protected:
+  mutable OT::PointWithDescription statistics_;
 
 private:
 
@@ -0,0 +1,94 @@
+//                                               -*- C++ -*-
+/**
+ *  @brief Signed distance sampled on a regular grid
+ *
+ *  Copyright 2005-2026 Airbus-EDF-IMACS-ONERA-Phimeca
+ *
+ *  This library is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License
+ *  along with this library.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+#ifndef OTMESHING_SIGNEDDISTANCEGRID_HXX
+#define OTMESHING_SIGNEDDISTANCEGRID_HXX
+
+#include <openturns/Interval.hxx>
+#include "otmeshing/MeshDomain2.hxx"
+
+namespace OTMESHING
+{
+
+/**
+ * @class SignedDistanceGrid
+ *
+ * Signed distance to a MeshDomain2 computed exactly at the nodes of a regular
+ * grid, then approximated by multilinear interpolation in the cells.
+ * The points outside of the grid are sent to the exact computation.
+ */
+class OTMESHING_API SignedDistanceGrid
+  : public OT::PersistentObject
+{
+  CLASSNAME
+
+public:
+  /** Default constructor */
+  SignedDistanceGrid();
+
+  /** Grid over the bounding box of the domain, with the given number of cells along each axis */
+  SignedDistanceGrid(const MeshDomain2 & domain,
+                     const OT::Indices & discretization);
+
+  /** Grid over a given interval */
+  SignedDistanceGrid(const MeshDomain2 & domain,
+                     const OT::Interval & bounds,
+                     const OT::Indices & discretization);
+
+  /** Virtual constructor method */
+  SignedDistanceGrid * clone() const override;
+
+  /** Accessors */
+  MeshDomain2 getDomain() const;
+  OT::Interval getBounds() const;
+  OT::Indices getDiscretization() const;
+
+  /** Exact signed distances at the nodes, the first axis varies fastest */
+  OT::Sample getValues() const;
+
+  /** Bound of the interpolation error inside the grid, half the diagonal of a cell */
+  OT::Scalar getErrorBound() const;
+
+  /** Approximate signed distance, exact outside of the grid */
+  OT::Scalar computeDistance(const OT::Point & point) const;
+  OT::Sample computeDistance(const OT::Sample & sample) const;
+
+  /** String converter */
+  OT::String __repr__() const override;
+
+  /** Method save() stores the object through the StorageManager */
+  void save(OT::Advocate & adv) const override;
+
+  /** Method load() reloads the object from the StorageManager */
+  void load(OT::Advocate & adv) override;
+
+private:
+  void initialize();
+
+  MeshDomain2 domain_;
+  OT::Interval bounds_;
+  OT::Indices discretization_;
+  OT::Sample values_;
+
+}; /* class SignedDistanceGrid */
+
+} /* namespace OTMESHING */
+
+#endif /* OTMESHING_SIGNEDDISTANCEGRID_HXX */
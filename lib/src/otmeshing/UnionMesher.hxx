@@ -22,6 +22,8 @@
 #define OTMESHING_UNIONMESHER_HXX
 
 #include <openturns/Mesh.hxx>
+#include <openturns/PointWithDescription.hxx>
+#include "otmeshing/CompactMesh.hxx"
 #include "otmeshing/otmeshingprivate.hxx"
 
 namespace OTMESHING
@@ -36,6 +38,7 @@ class OTMESHING_API UnionMesher
   CLASSNAME
 public:
   typedef OT::Collection<OT::Mesh> MeshCollection;
+  typedef OT::Collection<CompactMesh> CompactMeshCollection;
 
   /** Default constructor */
   UnionMesher();
@@ -52,9 +55,19 @@ public:
   /** Generate mesh */
   virtual OT::Mesh build(const MeshCollection & coll) const;
 
+  /** Generate mesh with 32-bit simplex indices */
+  CompactMesh buildCompact(const CompactMeshCollection & coll) const;
+
   /** Deduplicate vertices */
   static OT::Mesh CompressMesh(const OT::Mesh & mesh);
 
+  /** Overlap resolution flag accessor */
+  void setResolveOverlaps(const OT::Bool resolveOverlaps);
+  OT::Bool getResolveOverlaps() const;
+
+  /** Phase times and counters of the last build, recorded when the MeshingStatistics-Enabled key is true */
+  OT::PointWithDescription getStatistics() const;
+
   /** Method save() stores the object through the StorageManager */
   void save(OT::Advocate & adv) const override;
 
@@ -62,6 +75,10 @@ public:
   void load(OT::Advocate & adv) override;
 
 protected:
+  OT::Mesh buildDisjoint(const MeshCollection & coll) const;
+
+  OT::Bool resolveOverlaps_ = false;
+  mutable OT::PointWithDescription statistics_;
 private:
 
 }; /* class UnionMesher */
@@ -0,0 +1,15 @@
+// SWIG file BoundingBoxTree.i
+
+%{
+#include "otmeshing/BoundingBoxTree.hxx"
+%}
+
+%include BoundingBoxTree_doc.i
+
+%copyctor OTMESHING::BoundingBoxTree;
+
+// release the GIL during the computations
+%thread OTMESHING::BoundingBoxTree::BoundingBoxTree;
+%thread OTMESHING::BoundingBoxTree::queryContaining;
+
+%include otmeshing/BoundingBoxTree.hxx
@@ -0,0 +1,103 @@
+%feature("docstring") OTMESHING::BoundingBoxTree
+"Spatial index over the bounding boxes of the simplices of a mesh.
+
+The boxes are organized in a bounding volume hierarchy built by median
+splits of their centres along the widest axis, with at most 8 boxes per
+leaf. A query only visits the nodes whose box contains the point, so
+its cost does not depend on the size of the largest simplex. This gives
+the candidate simplices for point location.
+
+Parameters
+----------
+mesh : :class:`~openturns.Mesh`
+    Indexed mesh.
+
+Examples
+--------
+>>> import openturns as ot
+>>> import otmeshing
+>>> mesh = ot.IntervalMesher([4] * 2).build(ot.Interval(2))
+>>> tree = otmeshing.BoundingBoxTree(mesh)
+>>> candidates = tree.queryContaining([[0.1, 0.1], [0.6, 0.3]])"
+
+// ---------------------------------------------------------------------
+
+%feature("docstring") OTMESHING::BoundingBoxTree::getMesh
+"Indexed mesh accessor.
+
+Returns
+-------
+mesh : :class:`~openturns.Mesh`
+    Indexed mesh."
+
+// ---------------------------------------------------------------------
+
+%feature("docstring") OTMESHING::BoundingBoxTree::queryContaining
+"Query the simplices whose bounding box contains a point.
+
+Parameters
+----------
+x : sequence of float or 2-d sequence of float
+    Query point or sample of query points.
+
+Returns
+-------
+indices : :class:`~openturns.Indices` or :class:`~openturns.IndicesCollection`
+    Sorted indices of the candidate simplices, one row of variable size
+    per query point."
+
+// ---------------------------------------------------------------------
+
+%feature("docstring") OTMESHING::BoundingBoxTree::queryWithinDistance
+"Query the simplices whose bounding box is within a distance of a point.
+
+The distance to the box of a simplex is a lower bound of the distance to
+the simplex, so the result contains all the simplices within this distance.
+
+Parameters
+----------
+x : sequence of float
+    Query point.
+radius : float
+    Distance, non-negative.
+
+Returns
+-------
+indices : :class:`~openturns.Indices`
+    Sorted indices of the candidate simplices.
+
+Examples
+--------
+>>> import openturns as ot
+>>> import otmeshing
+>>> mesh = ot.IntervalMesher([4] * 2).build(ot.Interval(2))
+>>> tree = otmeshing.BoundingBoxTree(mesh)
+>>> len(tree.queryWithinDistance([-0.1, 0.1], 0.15))
+2"
+
+// ---------------------------------------------------------------------
+
+%feature("docstring") OTMESHING::BoundingBoxTree::queryIntersecting
+"Query the simplices whose bounding box intersects an interval.
+
+This gives the candidate pairs of simplices of two meshes whose boxes
+overlap, without testing all the pairs.
+
+Parameters
+----------
+box : :class:`~openturns.Interval`
+    Query interval.
+
+Returns
+-------
+indices : :class:`~openturns.Indices`
+    Sorted indices of the candidate simplices.
+
+Examples
+--------
+>>> import openturns as ot
+>>> import otmeshing
+>>> mesh = ot.IntervalMesher([4] * 2).build(ot.Interval(2))
+>>> tree = otmeshing.BoundingBoxTree(mesh)
+>>> len(tree.queryIntersecting(ot.Interval([0.1, 0.1], [0.2, 0.2])))
+2"
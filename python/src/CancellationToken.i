@@ -0,0 +1,83 @@
+// SWIG file CancellationToken.i
+
+%{
+#include "otmeshing/CancellationToken.hxx"
+
+namespace OTMESHING
+{
+
+/* Forwards the progress of a build to a python callable, the build runs without the GIL */
+static void PythonProgressCallback(OT::Scalar fraction, const char * phase, void * state)
+{
+  SWIG_PYTHON_THREAD_BEGIN_BLOCK;
+  PyObject * result = PyObject_CallFunction(static_cast<PyObject *>(state), "ds", fraction, phase);
+  // an exception raised by the callable interrupts the build
+  if (!result)
+    OT::handleException();
+  Py_DECREF(result);
+  SWIG_PYTHON_THREAD_END_BLOCK;
+}
+
+/* Releases the reference held by the copies of a mesher, possibly from a thread without the GIL */
+static void ReleasePythonProgressCallback(void * state)
+{
+  SWIG_PYTHON_THREAD_BEGIN_BLOCK;
+  Py_DECREF(static_cast<PyObject *>(state));
+  SWIG_PYTHON_THREAD_END_BLOCK;
+}
+
+/* The mesher and its copies hold a strong reference to the callable */
+template <class MesherType>
+static void SetPythonProgressCallback(MesherType & mesher, PyObject * callback)
+{
+  if (callback == Py_None)
+    mesher.setProgressCallback(nullptr);
+  else if (PyCallable_Check(callback))
+  {
+    Py_INCREF(callback);
+    mesher.setProgressCallback(&PythonProgressCallback, OTMESHING::ProgressCallbackState(callback, &ReleasePythonProgressCallback));
+  }
+  else
+    throw OT::InvalidArgumentException(HERE) << "Expected a callable or None as progress callback";
+}
+
+}
+%}
+
+%include CancellationToken_doc.i
+
+%copyctor OTMESHING::CancellationToken;
+
+// raised as a RuntimeError, told apart with IsInterruption
+%ignore OTMESHING::InterruptionException;
+
+%include otmeshing/CancellationToken.hxx
+
+%pythoncode %{
+def _SetProgressCallback(self, callback):
+    """
+    Progress callback accessor.
+
+    Parameters
+    ----------
+    callback : callable or None
+        Called as ``callback(fraction, phase)`` during the builds, with the
+        fraction done in :math:`[0, 1]` and the name of the current phase.
+        It is called at most once per percent, and once at the start of each
+        phase. An exception raised by the callback interrupts the build.
+        None removes the callback.
+
+    Examples
+    --------
+    >>> import openturns as ot
+    >>> import otmeshing
+    >>> points = ot.Normal(2).getSample(100)
+    >>> mesher = otmeshing.CloudMesher()
+    >>> phases = set()
+    >>> mesher.setProgressCallback(lambda fraction, phase: phases.add(phase))
+    >>> mesh = mesher.build(points)
+    >>> sorted(phases)
+    ['done', 'extraction', 'insertion']
+    """
+    self._setProgressCallback(callback)
+%}
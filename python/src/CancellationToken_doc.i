@@ -0,0 +1,92 @@
+%feature("docstring") OTMESHING::CancellationToken
+"Cooperative cancellation of the builds.
+
+A token is given to a mesher with its `setCancellationToken` method. The long
+builds check it regularly, between simplex pairs, Nef unions or batches of
+points, and stop by raising an exception once :meth:`cancel` has been called.
+The check happens between two steps, so a build stops after the step
+in progress.
+
+The copies of a token share the same state, and the heavy builds release the
+GIL, so the token can be cancelled from another thread.
+
+Examples
+--------
+>>> import openturns as ot
+>>> import otmeshing
+>>> token = otmeshing.CancellationToken()
+>>> mesher = otmeshing.CloudMesher()
+>>> mesher.setCancellationToken(token)
+>>> token.cancel()
+>>> try:
+...     mesh = mesher.build(ot.Normal(2).getSample(100))
+... except RuntimeError:
+...     print('cancelled')
+cancelled"
+
+// ---------------------------------------------------------------------
+
+%feature("docstring") OTMESHING::CancellationToken::cancel
+"Request the cancellation.
+
+The builds sharing the token stop at their next check."
+
+// ---------------------------------------------------------------------
+
+%feature("docstring") OTMESHING::CancellationToken::reset
+"Withdraw the cancellation request.
+
+The token can then be used for new builds."
+
+// ---------------------------------------------------------------------
+
+%feature("docstring") OTMESHING::CancellationToken::isCancelled
+"Cancellation request accessor.
+
+Returns
+-------
+cancelled : bool
+    Whether :meth:`cancel` was called since the creation or the last :meth:`reset`."
+
+// ---------------------------------------------------------------------
+
+%feature("docstring") OTMESHING::CancellationToken::GetInterruptionPrefix
+"Interruption message prefix accessor.
+
+Returns
+-------
+prefix : str
+    Prefix of the message of the exceptions raised by the builds stopped by
+    a cancellation token or a time budget."
+
+// ---------------------------------------------------------------------
+
+%feature("docstring") OTMESHING::CancellationToken::IsInterruption
+"Test whether an exception comes from an interrupted build.
+
+Parameters
+----------
+message : str
+    Message of the exception.
+
+Returns
+-------
+interrupted : bool
+    Whether the build was stopped by a cancellation token or a time budget,
+    as opposed to a failure. The message of an interruption starts with the
+    name of its dedicated exception type, so a failure quoting the
+    interruption prefix is not mistaken for an interruption.
+
+Examples
+--------
+>>> import openturns as ot
+>>> import otmeshing
+>>> token = otmeshing.CancellationToken()
+>>> token.cancel()
+>>> mesher = otmeshing.CloudMesher()
+>>> mesher.setCancellationToken(token)
+>>> try:
+...     mesher.build(ot.Normal(2).getSample(100))
+... except RuntimeError as exc:
+...     print(otmeshing.CancellationToken.IsInterruption(str(exc)))
+True"
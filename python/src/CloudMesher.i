@@ -8,4 +8,75 @@
 
 %copyctor OTMESHING::CloudMesher;
 
+// release the GIL during the computations
+%thread OTMESHING::CloudMesher::build;
+%thread OTMESHING::CloudMesher::buildCompact;
+
+// the raw buffer overload is reached through buildFromArray
+%ignore OTMESHING::CloudMesher::build(const OT::Scalar * data, const OT::UnsignedInteger size, const OT::UnsignedInteger dimension) const;
+
+// the C callback is reached through the python setProgressCallback
+%ignore OTMESHING::CloudMesher::setProgressCallback;
+
 %include otmeshing/CloudMesher.hxx
+
+%extend OTMESHING::CloudMesher {
+
+void _setProgressCallback(PyObject * callback)
+{
+  OTMESHING::SetPythonProgressCallback(*self, callback);
+}
+
+%pythoncode %{
+setProgressCallback = _SetProgressCallback
+%}
+}
+
+%extend OTMESHING::CloudMesher {
+
+PyObject * _buildFromArray(PyObject * points) const
+{
+  const OTMESHING::ScalarBuffer buffer(points);
+  OT::Mesh mesh;
+  {
+    SWIG_PYTHON_THREAD_BEGIN_ALLOW;
+    mesh = self->build(buffer.data(), buffer.getSize(), buffer.getDimension());
+    SWIG_PYTHON_THREAD_END_ALLOW;
+  }
+  return OTMESHING::MeshArrayViews(mesh);
+}
+
+%pythoncode %{
+def buildFromArray(self, points):
+    """
+    Generate the mesh from a numpy array without copy.
+
+    Parameters
+    ----------
+    points : array-like
+        C-contiguous float64 array of shape (n, d) supporting the buffer protocol,
+        it is read in place.
+
+    Returns
+    -------
+    vertices : :class:`numpy.ndarray`
+        Read-only float64 array of shape (m, d) viewing the vertices buffer.
+    simplices : :class:`numpy.ndarray`
+        Read-only unsigned integer array viewing the simplices buffer.
+
+    See also
+    --------
+    build, MeshArrays
+
+    Examples
+    --------
+    >>> import numpy as np
+    >>> import otmeshing
+    >>> points = np.random.default_rng(0).random((100, 2))
+    >>> vertices, simplices = otmeshing.CloudMesher().buildFromArray(points)
+    >>> vertices.shape[1], simplices.shape[1]
+    (2, 3)
+    """
+    return _ArrayViews(self._buildFromArray(points))
+%}
+}
@@ -37,3 +37,169 @@ Returns
 -------
 mesh : :class:`~openturns.Mesh`
     The mesh built."
+
+// ---------------------------------------------------------------------
+
+%feature("docstring") OTMESHING::CloudMesher::buildCompact
+"Triangulate a set of points with 32-bit simplex indices.
+
+The simplices are extracted directly into the compact storage, which
+halves the memory of the indices compared to :meth:`build`.
+
+Parameters
+----------
+points : :class:`~openturns.Sample`
+    A set of points.
+
+Returns
+-------
+mesh : :class:`~otmeshing.CompactMesh`
+    The mesh built."
+
+// ---------------------------------------------------------------------
+
+%feature("docstring") OTMESHING::CloudMesher::getStatistics
+"Statistics accessor.
+
+The phase wall-times and counters of the last build are only recorded when
+the `MeshingStatistics-Enabled` key of :class:`openturns.ResourceMap` is
+set to True, otherwise the result is empty.
+
+Returns
+-------
+statistics : :py:class:`openturns.PointWithDescription`
+    Phase wall-times in seconds: *insertionTime*, *extractionTime*,
+    *estimationTime*, the counters *simplicesProduced*, *memoryFallbacks*,
+    the predictions *estimatedSimplices*, *estimatedMemory* made when a
+    memory budget is set, and *peakMemory*, the high-water mark of the
+    resident memory of the whole process in bytes since it started, read
+    at the end of the build: it is not reset between builds and also
+    accounts for the memory used before the build."
+
+// ---------------------------------------------------------------------
+
+%feature("docstring") OTMESHING::CloudMesher::estimate
+"Predict the cost of a build.
+
+The points are triangulated by evenly strided sub-samples of growing size,
+up to a few thousand points or a few hundred thousand simplices, and the
+number of simplices is extrapolated linearly from the two largest ones.
+The number of simplices of a Delaunay triangulation grows very fast with the
+dimension, about 30 per point in dimension 4 and 5000 in dimension 7 for
+uniform points, so this is cheap compared to the build it predicts.
+
+Parameters
+----------
+points : :class:`~openturns.Sample`
+    A set of points.
+
+Returns
+-------
+estimation : :py:class:`openturns.PointWithDescription`
+    The predicted *simplicesNumber* and *memory* in bytes, which
+    accounts for the triangulation and the output mesh.
+
+Examples
+--------
+>>> import openturns as ot
+>>> import otmeshing
+>>> points = ot.Normal(3).getSample(5000)
+>>> mesher = otmeshing.CloudMesher(otmeshing.CloudMesher.DELAUNAY)
+>>> estimation = mesher.estimate(points)
+>>> simplicesNumber = mesher.build(points).getSimplicesNumber()
+>>> abs(estimation[0] / simplicesNumber - 1.0) < 0.2
+True"
+
+// ---------------------------------------------------------------------
+
+%feature("docstring") OTMESHING::CloudMesher::setMaximumMemory
+"Memory budget accessor.
+
+When a budget is set, the build is first estimated with :meth:`estimate`.
+A build predicted above the budget fails before allocating the triangulation,
+or falls back to the basic triangulation, see :meth:`setMemoryFallback`.
+
+Parameters
+----------
+maximumMemory : int
+    Budget of each build in bytes, no budget when zero (default)."
+
+// ---------------------------------------------------------------------
+
+%feature("docstring") OTMESHING::CloudMesher::getMaximumMemory
+"Memory budget accessor.
+
+Returns
+-------
+maximumMemory : int
+    Budget of each build in bytes, no budget when zero."
+
+// ---------------------------------------------------------------------
+
+%feature("docstring") OTMESHING::CloudMesher::setMemoryFallback
+"Memory fallback flag accessor.
+
+Parameters
+----------
+memoryFallback : bool
+    Whether a Delaunay build predicted above the memory budget uses the basic
+    triangulation instead, when it fits. The basic triangulation only splits
+    the simplex containing an interior point, so it has far fewer simplices.
+    Default is False: the build fails."
+
+// ---------------------------------------------------------------------
+
+%feature("docstring") OTMESHING::CloudMesher::getMemoryFallback
+"Memory fallback flag accessor.
+
+Returns
+-------
+memoryFallback : bool
+    Whether a Delaunay build predicted above the memory budget uses the basic
+    triangulation instead."
+
+// ---------------------------------------------------------------------
+
+%feature("docstring") OTMESHING::CloudMesher::setCancellationToken
+"Cancellation token accessor.
+
+The token is checked every few thousand inserted points or extracted simplices, a cancelled token makes
+the build raise an exception at the next check.
+
+Parameters
+----------
+token : :class:`~otmeshing.CancellationToken`
+    Token shared with the code that may cancel the build."
+
+// ---------------------------------------------------------------------
+
+%feature("docstring") OTMESHING::CloudMesher::getCancellationToken
+"Cancellation token accessor.
+
+Returns
+-------
+token : :class:`~otmeshing.CancellationToken`
+    Token checked during the builds, sharing its state with the one given."
+
+// ---------------------------------------------------------------------
+
+%feature("docstring") OTMESHING::CloudMesher::setMaximumTimeDuration
+"Time budget accessor.
+
+The elapsed wall-clock time is compared to the budget at the same points as
+the cancellation token, the build raises an exception once it is exceeded.
+
+Parameters
+----------
+maximumTimeDuration : float
+    Budget of each build in seconds, no budget when not positive (default)."
+
+// ---------------------------------------------------------------------
+
+%feature("docstring") OTMESHING::CloudMesher::getMaximumTimeDuration
+"Time budget accessor.
+
+Returns
+-------
+maximumTimeDuration : float
+    Budget of each build in seconds, no budget when not positive."
@@ -0,0 +1,58 @@
+// SWIG file CompactMesh.i
+
+%{
+#include "otmeshing/CompactMesh.hxx"
+%}
+
+%include CompactMesh_doc.i
+
+%copyctor OTMESHING::CompactMesh;
+
+// release the GIL during the computations
+%thread OTMESHING::CompactMesh::CompactMesh;
+%thread OTMESHING::CompactMesh::getMesh;
+
+// the raw indices are reached through getArrays
+%ignore OTMESHING::CompactMesh::CompactMesh(const OT::Sample & vertices, IndexStorage && simplices);
+%ignore OTMESHING::CompactMesh::getSimplicesData;
+
+%include otmeshing/CompactMesh.hxx
+
+%extend OTMESHING::CompactMesh {
+
+PyObject * _getArrayViews() const
+{
+  static swig_type_info * compactMeshType = SWIG_TypeQuery("OTMESHING::CompactMesh *");
+  const Py_ssize_t simplicesNumber = self->getSimplicesNumber();
+  // the view holds a copy sharing the indices
+  PyObject * simplices = OTMESHING::ArrayView(SWIG_NewPointerObj(new OTMESHING::CompactMesh(*self), compactMeshType, SWIG_POINTER_OWN),
+                                              simplicesNumber ? self->getSimplicesData() : 0,
+                                              Py_BuildValue("(nn)", simplicesNumber, static_cast<Py_ssize_t>(self->getDimension() + 1)),
+                                              'u', sizeof(std::uint32_t));
+  return Py_BuildValue("(NN)", OTMESHING::SampleArrayView(self->getVertices()), simplices);
+}
+
+%pythoncode %{
+def getArrays(self):
+    """
+    Vertices and simplices as numpy arrays without copy.
+
+    Returns
+    -------
+    vertices : :class:`numpy.ndarray`
+        Read-only float64 array of shape (n, d) viewing the vertices.
+    simplices : :class:`numpy.ndarray`
+        Read-only uint32 array of shape (m, d + 1) viewing the simplices.
+
+    Examples
+    --------
+    >>> import openturns as ot
+    >>> import otmeshing
+    >>> mesh = ot.IntervalMesher([2] * 2).build(ot.Interval([0.0] * 2, [1.0] * 2))
+    >>> vertices, simplices = otmeshing.CompactMesh(mesh).getArrays()
+    >>> simplices.dtype, simplices.shape
+    (dtype('uint32'), (8, 3))
+    """
+    return _ArrayViews(self._getArrayViews())
+%}
+}
@@ -0,0 +1,101 @@
+%feature("docstring") OTMESHING::CompactMesh
+"Mesh with 32-bit simplex indices.
+
+The simplices of :class:`~openturns.Mesh` are stored with 64-bit indices.
+This container stores them on 32 bits, which halves the memory and the
+bandwidth of the indices, for meshes of less than :math:`2^{32}` vertices.
+It is produced by :meth:`CloudMesher.buildCompact` and
+:meth:`UnionMesher.buildCompact`, and consumed by
+:meth:`MeshDomain2.ComputeDistance` without conversion.
+
+The indices are immutable and shared by the copies.
+
+Parameters
+----------
+mesh : :class:`~openturns.Mesh`
+    Mesh to convert, its vertices are shared.
+
+Examples
+--------
+>>> import openturns as ot
+>>> import otmeshing
+>>> mesh = ot.IntervalMesher([2] * 3).build(ot.Interval([0.0] * 3, [1.0] * 3))
+>>> compactMesh = otmeshing.CompactMesh(mesh)
+>>> compactMesh.getSimplicesNumber()
+48
+>>> mesh2 = compactMesh.getMesh()"
+
+// ---------------------------------------------------------------------
+
+%feature("docstring") OTMESHING::CompactMesh::getDimension
+"Dimension accessor.
+
+Returns
+-------
+dimension : int
+    Dimension of the vertices."
+
+// ---------------------------------------------------------------------
+
+%feature("docstring") OTMESHING::CompactMesh::getVerticesNumber
+"Number of vertices accessor.
+
+Returns
+-------
+number : int
+    Number of vertices."
+
+// ---------------------------------------------------------------------
+
+%feature("docstring") OTMESHING::CompactMesh::getVertices
+"Vertices accessor.
+
+Returns
+-------
+vertices : :class:`~openturns.Sample`
+    Vertices."
+
+// ---------------------------------------------------------------------
+
+%feature("docstring") OTMESHING::CompactMesh::getSimplicesNumber
+"Number of simplices accessor.
+
+Returns
+-------
+number : int
+    Number of simplices."
+
+// ---------------------------------------------------------------------
+
+%feature("docstring") OTMESHING::CompactMesh::getSimplices
+"Simplices accessor.
+
+Returns
+-------
+simplices : :class:`~openturns.IndicesCollection`
+    Vertex indices of the simplices, widened to 64 bits."
+
+// ---------------------------------------------------------------------
+
+%feature("docstring") OTMESHING::CompactMesh::getSimplex
+"Simplex accessor.
+
+Parameters
+----------
+index : int
+    Simplex index.
+
+Returns
+-------
+simplex : :class:`~openturns.Indices`
+    Vertex indices of the simplex."
+
+// ---------------------------------------------------------------------
+
+%feature("docstring") OTMESHING::CompactMesh::getMesh
+"Conversion to a mesh.
+
+Returns
+-------
+mesh : :class:`~openturns.Mesh`
+    Mesh sharing the vertices, with 64-bit indices."
@@ -8,8 +8,27 @@
 
 %copyctor OTMESHING::ConvexDecompositionMesher;
 
+// release the GIL during the computations
+%thread OTMESHING::ConvexDecompositionMesher::build;
+%thread OTMESHING::ConvexDecompositionMesher::IsConvex;
+
+// the C callback is reached through the python setProgressCallback
+%ignore OTMESHING::ConvexDecompositionMesher::setProgressCallback;
+
 %include otmeshing/ConvexDecompositionMesher.hxx
 
+%extend OTMESHING::ConvexDecompositionMesher {
+
+void _setProgressCallback(PyObject * callback)
+{
+  OTMESHING::SetPythonProgressCallback(*self, callback);
+}
+
+%pythoncode %{
+setProgressCallback = _SetProgressCallback
+%}
+}
+
 %{
 #include "openturns/Mesh.hxx"
 namespace OT {
@@ -1,27 +1,78 @@
 %feature("docstring") OTMESHING::ConvexDecompositionMesher
-"Build a convex decomposition."
+"Build a convex decomposition.
+
+Parameters
+----------
+decompositionMethod : int
+    Decomposition method to use, either:
+
+    - ConvexDecompositionMesher.EXACT (default), exact decomposition in dimension 3
+      and greedy merge of the simplices into convex cells otherwise
+    - ConvexDecompositionMesher.APPROXIMATE, approximate decomposition of a volumetric mesh
+
+Notes
+-----
+When the dimension equals the intrinsic dimension (except the exact method in
+dimension 3), adjacent simplices are merged greedily across their shared facets
+as long as every vertex of the cell lies inside every boundary facet
+hyperplane, in the spirit of Hertel-Mehlhorn.
+
+The approximate method recursively bisects the simplices of the mesh by their
+centroids, along the largest extent, starting from the most concave part.
+The concavity of a part is the relative volume excess of its convex hull.
+The splitting stops when all the parts are within the concavity tolerance
+or when the maximum number of parts is reached.
+Each part is returned as its convex hull, so the union of the parts covers
+the mesh with a volume error bounded by the concavity of the parts.
+The hulls are not clipped: the hulls of two parts may overlap, so the
+parts form a cover of the mesh rather than a partition.
+The hull of a part is built from the vertices of its boundary only, which
+are obtained from the boundary of its parent and the bisection cut.
+
+Examples
+--------
+>>> import openturns as ot
+>>> import otmeshing
+>>> mesher = otmeshing.ConvexDecompositionMesher(otmeshing.ConvexDecompositionMesher.APPROXIMATE)
+>>> mesher.setConcavityTolerance(0.01)
+>>> mesher.setMaximumPartNumber(8)"
 
 // ---------------------------------------------------------------------
 
 %feature("docstring") OTMESHING::ConvexDecompositionMesher::build
 "Build a convex decomposition.
 
+In dimension 3 the exact decomposition works on a Nef polyhedron.
+For a volumetric mesh it is built from the boundary surface of the
+tetrahedra, the faces shared by two tetrahedra cancelling out.
+When this surface is not a closed manifold or self-intersects, as for
+overlapping tetrahedra, the tetrahedra are merged by a balanced tree
+of pairwise unions instead.
+
 Parameters
 ----------
 mesh : :class:`~openturns.Mesh`
-    A polyhedra of dimension 3 defined from a surface mesh (of intrinsic dimension 2).
+    A polyhedra of dimension 3 defined from a surface mesh (of intrinsic dimension 2)
+    or a volumetric mesh (of intrinsic dimension 3).
 
 Returns
 -------
 decomposition : sequence of :class:`~openturns.Mesh`
-    A sequence of non-convex polyhedra."
+    A sequence of convex polyhedra."
 
 // ---------------------------------------------------------------------
 
 %feature("docstring") OTMESHING::ConvexDecompositionMesher::IsConvex
 "Test whether a mesh is convex.
 
-We test the volume of the mesh versus the volume of its convex hull.
+The boundary facets are the facets of a single simplex for a volumetric mesh,
+or the simplices themselves for a surface mesh of intrinsic dimension one
+less than the dimension. The boundary must be closed, connected through its
+ridges and consistently oriented, and it must be locally convex: across each
+ridge, the vertex of one facet off the ridge lies on the inner side of the
+hyperplane of the other facet. In dimension 2 the boundary must also wind
+only once. The cost is linear in the number of facets and the check exits
+on the first violation.
 
 Parameters
 ----------
@@ -33,3 +84,111 @@ Returns
 isConvex : bool
     Whether the mesh is convex.
 "
+
+// ---------------------------------------------------------------------
+
+%feature("docstring") OTMESHING::ConvexDecompositionMesher::setConcavityTolerance
+"Concavity tolerance accessor.
+
+Only used by the approximate method.
+
+Parameters
+----------
+concavityTolerance : float
+    Relative volume excess of the hull allowed for each part, default is 0.05."
+
+// ---------------------------------------------------------------------
+
+%feature("docstring") OTMESHING::ConvexDecompositionMesher::getConcavityTolerance
+"Concavity tolerance accessor.
+
+Returns
+-------
+concavityTolerance : float
+    Relative volume excess of the hull allowed for each part."
+
+// ---------------------------------------------------------------------
+
+%feature("docstring") OTMESHING::ConvexDecompositionMesher::setMaximumPartNumber
+"Maximum number of parts accessor.
+
+Only used by the approximate method.
+
+Parameters
+----------
+maximumPartNumber : int
+    Maximum number of parts, 0 means no limit, default is 64."
+
+// ---------------------------------------------------------------------
+
+%feature("docstring") OTMESHING::ConvexDecompositionMesher::getMaximumPartNumber
+"Maximum number of parts accessor.
+
+Returns
+-------
+maximumPartNumber : int
+    Maximum number of parts."
+
+// ---------------------------------------------------------------------
+
+%feature("docstring") OTMESHING::ConvexDecompositionMesher::getStatistics
+"Statistics accessor.
+
+The phase wall-times and counters of the last build are only recorded when
+the `MeshingStatistics-Enabled` key of :class:`openturns.ResourceMap` is
+set to True, otherwise the result is empty.
+
+Returns
+-------
+statistics : :py:class:`openturns.PointWithDescription`
+    Phase wall-times in seconds: *nefBuildTime*, *decompositionTime*,
+    *conversionTime*, *fanTime*, *mergeTime*, *bisectionTime*,
+    and the counters *piecesProduced*, *treeReductions*, *bisections*,
+    *volumeError*."
+
+// ---------------------------------------------------------------------
+
+%feature("docstring") OTMESHING::ConvexDecompositionMesher::setCancellationToken
+"Cancellation token accessor.
+
+The token is checked between the Nef unions, the converted volumes and
+the bisections, a cancelled token makes
+the build raise an exception at the next check.
+
+Parameters
+----------
+token : :class:`~otmeshing.CancellationToken`
+    Token shared with the code that may cancel the build."
+
+// ---------------------------------------------------------------------
+
+%feature("docstring") OTMESHING::ConvexDecompositionMesher::getCancellationToken
+"Cancellation token accessor.
+
+Returns
+-------
+token : :class:`~otmeshing.CancellationToken`
+    Token checked during the builds, sharing its state with the one given."
+
+// ---------------------------------------------------------------------
+
+%feature("docstring") OTMESHING::ConvexDecompositionMesher::setMaximumTimeDuration
+"Time budget accessor.
+
+The elapsed wall-clock time is compared to the budget at the same points as
+the cancellation token, the build raises an exception once it is exceeded.
+
+Parameters
+----------
+maximumTimeDuration : float
+    Budget of each build in seconds, no budget when not positive (default)."
+
+// ---------------------------------------------------------------------
+
+%feature("docstring") OTMESHING::ConvexDecompositionMesher::getMaximumTimeDuration
+"Time budget accessor.
+
+Returns
+-------
+maximumTimeDuration : float
+    Budget of each build in seconds, no budget when not positive."
@@ -8,4 +8,59 @@
 
 %copyctor OTMESHING::ConvexHullMesher;
 
+// release the GIL during the computations
+%thread OTMESHING::ConvexHullMesher::build;
+
+// the raw buffer overload is reached through buildFromArray
+%ignore OTMESHING::ConvexHullMesher::build(const OT::Scalar * data, const OT::UnsignedInteger size, const OT::UnsignedInteger dimension) const;
+
 %include otmeshing/ConvexHullMesher.hxx
+
+%extend OTMESHING::ConvexHullMesher {
+
+PyObject * _buildFromArray(PyObject * points) const
+{
+  const OTMESHING::ScalarBuffer buffer(points);
+  OT::Mesh mesh;
+  {
+    SWIG_PYTHON_THREAD_BEGIN_ALLOW;
+    mesh = self->build(buffer.data(), buffer.getSize(), buffer.getDimension());
+    SWIG_PYTHON_THREAD_END_ALLOW;
+  }
+  return OTMESHING::MeshArrayViews(mesh);
+}
+
+%pythoncode %{
+def buildFromArray(self, points):
+    """
+    Generate the convex hull mesh from a numpy array without copy.
+
+    Parameters
+    ----------
+    points : array-like
+        C-contiguous float64 array of shape (n, d) supporting the buffer protocol,
+        it is read in place.
+
+    Returns
+    -------
+    vertices : :class:`numpy.ndarray`
+        Read-only float64 array of shape (m, d) viewing the vertices buffer.
+    simplices : :class:`numpy.ndarray`
+        Read-only unsigned integer array viewing the simplices buffer.
+
+    See also
+    --------
+    build, MeshArrays
+
+    Examples
+    --------
+    >>> import numpy as np
+    >>> import otmeshing
+    >>> points = np.random.default_rng(0).random((100, 3))
+    >>> vertices, simplices = otmeshing.ConvexHullMesher().buildFromArray(points)
+    >>> vertices.shape[1], simplices.shape[1]
+    (3, 4)
+    """
+    return _ArrayViews(self._buildFromArray(points))
+%}
+}
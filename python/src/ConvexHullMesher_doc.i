@@ -25,3 +25,18 @@ Returns
 -------
 mesh : :class:`~openturns.Mesh`
     The convex hull."
+
+// ---------------------------------------------------------------------
+
+%feature("docstring") OTMESHING::ConvexHullMesher::getStatistics
+"Statistics accessor.
+
+The phase wall-times and counters of the last build are only recorded when
+the `MeshingStatistics-Enabled` key of :class:`openturns.ResourceMap` is
+set to True, otherwise the result is empty.
+
+Returns
+-------
+statistics : :py:class:`openturns.PointWithDescription`
+    Phase wall-times in seconds: *hullTime*, *extractionTime*,
+    and the counter *facetsProduced*."
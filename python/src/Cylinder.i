@@ -6,6 +6,12 @@
 
 %include Cylinder_doc.i
 
+// release the GIL during the computations
+%thread OTMESHING::Cylinder::getVertices;
+%thread OTMESHING::Cylinder::getMesh;
+%thread OTMESHING::Cylinder::contains;
+%thread OTMESHING::Cylinder::computeDistance;
+
 %include otmeshing/Cylinder.hxx
 
 %copyctor OTMESHING::Cylinder;
@@ -1,6 +1,11 @@
 %feature("docstring") OTMESHING::Cylinder
 "Generalized cylinder.
 
+The cylinder is the product of a base mesh, in the coordinates that are not
+injected, with an interval in the injected coordinates. It is a domain:
+point containment and signed distances are computed from the base domain
+and the interval, without meshing the product.
+
 Parameters
 ----------
 base : :py:class:`openturns.Mesh`
@@ -42,6 +47,22 @@ vertices : :py:class:`openturns.Sample`
 
 // ---------------------------------------------------------------------
 
+%feature("docstring") OTMESHING::Cylinder::getMesh
+"Product mesh accessor.
+
+The mesh is the product of the base mesh and of the regular grid of the
+extension. Each grid cell is split into simplices by the Kuhn triangulation,
+and each product of a base simplex with a cell simplex is split by the
+staircase triangulation, which is conforming as vertices are ordered globally.
+No Delaunay triangulation is involved.
+
+Returns
+-------
+mesh : :py:class:`openturns.Mesh`
+    Cylinder mesh, whose vertices are given by :meth:`getVertices`."
+
+// ---------------------------------------------------------------------
+
 %feature("docstring") OTMESHING::Cylinder::getBoundingBox
 "Bounding box accessor.
 
@@ -58,4 +79,41 @@ bbox : :py:class:`openturns.Interval`
 Returns
 -------
 volume : float
-    Cylinder volume."
\ No newline at end of file
+    Cylinder volume."
+// ---------------------------------------------------------------------
+
+%feature("docstring") OTMESHING::Cylinder::contains
+"Check if points are inside the cylinder.
+
+The point is inside if its projection on the base coordinates is inside the
+base mesh and its injected coordinates are inside the extension interval.
+
+Parameters
+----------
+point : sequence of float or 2-d sequence of float
+    Point or sample of points.
+
+Returns
+-------
+isInside : bool or sequence of bool
+    Whether the points are inside."
+
+// ---------------------------------------------------------------------
+
+%feature("docstring") OTMESHING::Cylinder::computeDistance
+"Compute the signed distance to the cylinder.
+
+With :math:`d_b` the signed distance to the base and :math:`d_e` the signed
+distance to the extension interval, the distance to the product is
+:math:`\\sqrt{d_b^2+d_e^2}` when both are positive and :math:`\\max(d_b, d_e)`
+otherwise. It is negative inside the cylinder.
+
+Parameters
+----------
+point : sequence of float or 2-d sequence of float
+    Point or sample of points.
+
+Returns
+-------
+distance : float or :py:class:`openturns.Sample`
+    Signed distance."
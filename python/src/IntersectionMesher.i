@@ -70,6 +70,26 @@ namespace OT {
 
 %include IntersectionMesher_doc.i
 
+// release the GIL during the computations
+%thread OTMESHING::IntersectionMesher::build;
+%thread OTMESHING::IntersectionMesher::buildConvex;
+%thread OTMESHING::IntersectionMesher::buildCylinder;
+
+// the C callback is reached through the python setProgressCallback
+%ignore OTMESHING::IntersectionMesher::setProgressCallback;
+
 %include otmeshing/IntersectionMesher.hxx
 
+%extend OTMESHING::IntersectionMesher {
+
+void _setProgressCallback(PyObject * callback)
+{
+  OTMESHING::SetPythonProgressCallback(*self, callback);
+}
+
+%pythoncode %{
+setProgressCallback = _SetProgressCallback
+%}
+}
+
 %copyctor OTMESHING::IntersectionMesher;
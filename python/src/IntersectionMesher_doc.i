@@ -80,3 +80,97 @@ Returns
 recompress : bool
     Whether to eliminate duplicate vertices.
 "
+
+// ---------------------------------------------------------------------
+
+%feature("docstring") OTMESHING::IntersectionMesher::setCompact
+"Compaction flag accessor.
+
+When enabled, adjacent convex pieces of each pairwise intersection, ie
+sharing at least a facet, are merged whenever their union is convex and its
+triangulation from the extreme points does not need more simplices, before
+the next reduction level. The triangulation is not guaranteed to be minimal.
+Compaction is disabled by default.
+The savings in pieces, simplices and time are recorded in the statistics.
+
+Parameters
+----------
+compact : bool
+    Whether to merge adjacent convex pieces.
+"
+
+// ---------------------------------------------------------------------
+
+%feature("docstring") OTMESHING::IntersectionMesher::getCompact
+"Compaction flag accessor.
+
+Returns
+-------
+compact : bool
+    Whether to merge adjacent convex pieces.
+"
+
+// ---------------------------------------------------------------------
+
+%feature("docstring") OTMESHING::IntersectionMesher::getStatistics
+"Statistics accessor.
+
+The phase wall-times and counters of the last build are only recorded when
+the `MeshingStatistics-Enabled` key of :class:`openturns.ResourceMap` is
+set to True, otherwise the result is empty.
+
+Returns
+-------
+statistics : :py:class:`openturns.PointWithDescription`
+    Phase wall-times in seconds: *cddTime*, *triangulationTime*,
+    *compactionTime*, *unionTime*, *compressTime*, *cylinderMeshTime*,
+    and the counters *pairsTested*, *pairsPruned*, *cddCalls*,
+    *piecesProduced*, *verticesDeduplicated*, *reductionLevels*, and with
+    compaction *piecesAfterCompaction*, *simplicesBeforeCompaction* and
+    *simplicesAfterCompaction*."
+
+// ---------------------------------------------------------------------
+
+%feature("docstring") OTMESHING::IntersectionMesher::setCancellationToken
+"Cancellation token accessor.
+
+The token is checked between the simplex pairs and the reduction levels, a cancelled token makes
+the build raise an exception at the next check.
+
+Parameters
+----------
+token : :class:`~otmeshing.CancellationToken`
+    Token shared with the code that may cancel the build."
+
+// ---------------------------------------------------------------------
+
+%feature("docstring") OTMESHING::IntersectionMesher::getCancellationToken
+"Cancellation token accessor.
+
+Returns
+-------
+token : :class:`~otmeshing.CancellationToken`
+    Token checked during the builds, sharing its state with the one given."
+
+// ---------------------------------------------------------------------
+
+%feature("docstring") OTMESHING::IntersectionMesher::setMaximumTimeDuration
+"Time budget accessor.
+
+The elapsed wall-clock time is compared to the budget at the same points as
+the cancellation token, the build raises an exception once it is exceeded.
+
+Parameters
+----------
+maximumTimeDuration : float
+    Budget of each build in seconds, no budget when not positive (default)."
+
+// ---------------------------------------------------------------------
+
+%feature("docstring") OTMESHING::IntersectionMesher::getMaximumTimeDuration
+"Time budget accessor.
+
+Returns
+-------
+maximumTimeDuration : float
+    Budget of each build in seconds, no budget when not positive."
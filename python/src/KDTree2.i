@@ -0,0 +1,16 @@
+// SWIG file KDTree2.i
+
+%{
+#include "otmeshing/KDTree2.hxx"
+%}
+
+%include KDTree2_doc.i
+
+%copyctor OTMESHING::KDTree2;
+
+// release the GIL during the computations
+%thread OTMESHING::KDTree2::KDTree2;
+%thread OTMESHING::KDTree2::queryNearest;
+%thread OTMESHING::KDTree2::queryRadius;
+
+%include otmeshing/KDTree2.hxx
@@ -0,0 +1,64 @@
+%feature("docstring") OTMESHING::KDTree2
+"Spatial index over a set of points.
+
+The tree is built once and can be queried many times, the batch queries
+are run in parallel over the points of the sample.
+
+Parameters
+----------
+points : :class:`~openturns.Sample`
+    Indexed points.
+
+Examples
+--------
+>>> import openturns as ot
+>>> import otmeshing
+>>> points = ot.JointDistribution([ot.Uniform()] * 2).getSample(100)
+>>> tree = otmeshing.KDTree2(points)
+>>> nearest = tree.queryNearest([[0.0, 0.0], [0.5, 0.5]], 3)
+>>> neighbours = tree.queryRadius([[0.0, 0.0], [0.5, 0.5]], 0.2)"
+
+// ---------------------------------------------------------------------
+
+%feature("docstring") OTMESHING::KDTree2::getPoints
+"Indexed points accessor.
+
+Returns
+-------
+points : :class:`~openturns.Sample`
+    Indexed points."
+
+// ---------------------------------------------------------------------
+
+%feature("docstring") OTMESHING::KDTree2::queryNearest
+"Query the nearest points.
+
+Parameters
+----------
+x : sequence of float or 2-d sequence of float
+    Query point or sample of query points.
+k : int
+    Number of neighbours, bounded by the number of indexed points.
+
+Returns
+-------
+indices : :class:`~openturns.Indices` or :class:`~openturns.IndicesCollection`
+    Indices of the nearest points, by increasing distance, one row per query point."
+
+// ---------------------------------------------------------------------
+
+%feature("docstring") OTMESHING::KDTree2::queryRadius
+"Query the points within a given radius.
+
+Parameters
+----------
+x : sequence of float or 2-d sequence of float
+    Query point or sample of query points.
+radius : float
+    Search radius.
+
+Returns
+-------
+indices : :class:`~openturns.Indices` or :class:`~openturns.IndicesCollection`
+    Indices of the points within the radius, by increasing distance,
+    one row of variable size per query point."
@@ -6,6 +6,85 @@
 
 %include MeshDomain2_doc.i
 
+// release the GIL during the computations
+%thread OTMESHING::MeshDomain2::MeshDomain2;
+%thread OTMESHING::MeshDomain2::computeDistance;
+%thread OTMESHING::MeshDomain2::ComputeDistance;
+
+// the raw buffer overload is reached through computeDistanceFromArray
+%ignore OTMESHING::MeshDomain2::computeDistance(const OT::Scalar * points, const OT::UnsignedInteger size, const OT::UnsignedInteger dimension) const;
+
+// the outputs are returned by computeProjection(points)
+%ignore OTMESHING::MeshDomain2::computeProjection(const OT::Sample & points, OT::Sample & closestPoints, OT::Indices & facetIndices, OT::Sample & normals) const;
+
 %include otmeshing/MeshDomain2.hxx
 
 %copyctor OTMESHING::MeshDomain2;
+
+%extend OTMESHING::MeshDomain2 {
+
+PyObject * computeProjection(const OT::Sample & points) const
+{
+  static swig_type_info * indicesType = SWIG_TypeQuery("OT::Indices *");
+  static swig_type_info * sampleType = SWIG_TypeQuery("OT::Sample *");
+  OT::Sample * distances = new OT::Sample;
+  OT::Sample * closestPoints = new OT::Sample;
+  OT::Indices * facetIndices = new OT::Indices;
+  OT::Sample * normals = new OT::Sample;
+  {
+    SWIG_PYTHON_THREAD_BEGIN_ALLOW;
+    *distances = self->computeProjection(points, *closestPoints, *facetIndices, *normals);
+    SWIG_PYTHON_THREAD_END_ALLOW;
+  }
+  return Py_BuildValue("(NNNN)", SWIG_NewPointerObj(distances, sampleType, SWIG_POINTER_OWN),
+                       SWIG_NewPointerObj(closestPoints, sampleType, SWIG_POINTER_OWN),
+                       SWIG_NewPointerObj(facetIndices, indicesType, SWIG_POINTER_OWN),
+                       SWIG_NewPointerObj(normals, sampleType, SWIG_POINTER_OWN));
+}
+
+PyObject * _computeDistanceFromArray(PyObject * points) const
+{
+  const OTMESHING::ScalarBuffer buffer(points);
+  OT::Sample distances;
+  {
+    SWIG_PYTHON_THREAD_BEGIN_ALLOW;
+    distances = self->computeDistance(buffer.data(), buffer.getSize(), buffer.getDimension());
+    SWIG_PYTHON_THREAD_END_ALLOW;
+  }
+  return Py_BuildValue("(N)", OTMESHING::SampleArrayView(distances, true));
+}
+
+%pythoncode %{
+def computeDistanceFromArray(self, points):
+    """
+    Compute the signed distances of a numpy array of points without copy.
+
+    Parameters
+    ----------
+    points : array-like
+        C-contiguous float64 array of shape (n, d) supporting the buffer protocol,
+        it is read in place.
+
+    Returns
+    -------
+    distances : :class:`numpy.ndarray`
+        Read-only float64 array of shape (n,) viewing the distances buffer,
+        negative inside the domain.
+
+    See also
+    --------
+    computeDistance
+
+    Examples
+    --------
+    >>> import numpy as np
+    >>> import openturns as ot
+    >>> import otmeshing
+    >>> mesh = ot.IntervalMesher([2] * 2).build(ot.Interval([0.0] * 2, [1.0] * 2))
+    >>> domain = otmeshing.MeshDomain2(mesh)
+    >>> domain.computeDistanceFromArray(np.array([[0.5, 0.5], [2.0, 0.5]]))
+    array([-0.5,  1. ])
+    """
+    return _ArrayViews(self._computeDistanceFromArray(points))[0]
+%}
+}
@@ -1,6 +1,18 @@
 %feature("docstring") OTMESHING::MeshDomain2
 "Adaptor to convert a Mesh to a Domain, with signed distance.
 
+The boundary facets are extracted and their search structures are built
+once, when the domain is built or loaded, then shared by all the queries and
+by the copies of the domain.
+In dimension 2 and 3 the distance to the boundary is computed with CGAL AABB
+trees; the inside test casts a ray through the tree of the boundary edges in
+dimension 2 and uses the tree of the boundary surface in dimension 3.
+In the other dimensions the point is projected exactly on the facet of the nearest centroid
+in a :class:`~otmeshing.KDTree2`, then on the facets whose bounding box in a
+:class:`~otmeshing.BoundingBoxTree` is closer, and it is inside when a
+simplex whose box contains it contains it too.
+The query points are processed in parallel.
+
 Parameters
 ----------
 mesh : :class:`~openturns.Mesh`
@@ -19,3 +31,97 @@ the mesh of the unit square
 >>> p = [5.0] * dim
 >>> distance = domain.computeDistance(p)
 "
+
+// ---------------------------------------------------------------------
+
+%feature("docstring") OTMESHING::MeshDomain2::getStatistics
+"Statistics accessor.
+
+The phase wall-times and counters of the last distance computation are only recorded when
+the `MeshingStatistics-Enabled` key of :class:`openturns.ResourceMap` is
+set to True, otherwise the result is empty.
+
+Returns
+-------
+statistics : :py:class:`openturns.PointWithDescription`
+    Phase wall-times in seconds: *treeBuildTime*, the time taken to build
+    the search structures of the boundary once with the domain, *queryTime*,
+    and the counters *boundaryFacets*, *queriesNumber*."
+
+// ---------------------------------------------------------------------
+
+%feature("docstring") OTMESHING::MeshDomain2::computeProjection
+"Compute the signed distances with the closest points of the boundary.
+
+The closest points, their facets and the normals are obtained by the same
+pass over the boundary trees as the distances.
+
+Parameters
+----------
+points : 2-d sequence of float
+    Query points.
+
+Returns
+-------
+distances : :class:`~openturns.Sample`
+    Signed distances, negative inside the domain.
+closestPoints : :class:`~openturns.Sample`
+    Closest point of the boundary to each query point.
+facetIndices : :class:`~openturns.Indices`
+    Index of the facet of each closest point among the simplices of
+    :meth:`getBoundary`. A closest point on a vertex or an edge shared by
+    several facets gets one of them.
+normals : :class:`~openturns.Sample`
+    Outward unit normal of each facet.
+
+Examples
+--------
+>>> import openturns as ot
+>>> import otmeshing
+>>> mesh = ot.IntervalMesher([2] * 2).build(ot.Interval([0.0] * 2, [1.0] * 2))
+>>> domain = otmeshing.MeshDomain2(mesh)
+>>> distances, closestPoints, facetIndices, normals = domain.computeProjection([[0.5, 0.2], [0.5, 1.5]])
+>>> [round(d, 6) for d in distances.asPoint()]
+[-0.2, 0.5]
+>>> (closestPoints[1] - ot.Point([0.5, 1.0])).norm() < 1e-12
+True
+>>> (normals[1] - ot.Point([0.0, 1.0])).norm() < 1e-12
+True"
+
+// ---------------------------------------------------------------------
+
+%feature("docstring") OTMESHING::MeshDomain2::getBoundary
+"Boundary accessor.
+
+Returns
+-------
+boundary : :class:`~openturns.Mesh`
+    Mesh of the facets referenced by a single simplex of the mesh, sharing
+    its vertices. The facets are not oriented."
+
+// ---------------------------------------------------------------------
+
+%feature("docstring") OTMESHING::MeshDomain2::ComputeDistance
+"Compute the signed distances to a mesh with 32-bit indices.
+
+The boundary is extracted from the 32-bit indices in place, the mesh is
+not converted.
+
+Parameters
+----------
+mesh : :class:`~otmeshing.CompactMesh`
+    Volumetric mesh, closed in dimension 3.
+points : :class:`~openturns.Sample`
+    Query points.
+
+Returns
+-------
+distances : :class:`~openturns.Sample`
+    Signed distances, negative inside the mesh.
+
+Examples
+--------
+>>> import openturns as ot
+>>> import otmeshing
+>>> mesh = ot.IntervalMesher([2] * 2).build(ot.Interval([0.0] * 2, [1.0] * 2))
+>>> distances = otmeshing.MeshDomain2.ComputeDistance(otmeshing.CompactMesh(mesh), [[0.5, 0.5]])"
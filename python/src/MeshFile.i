@@ -0,0 +1,67 @@
+// SWIG file MeshFile.i
+
+%{
+#include "otmeshing/MeshFile.hxx"
+%}
+
+%include MeshFile_doc.i
+
+%copyctor OTMESHING::MeshFile;
+
+// release the GIL during the computations
+%thread OTMESHING::MeshFile::Write;
+%thread OTMESHING::MeshFile::getMesh;
+
+// the mapped blocks are reached through getArrays
+%ignore OTMESHING::MeshFile::getVerticesData;
+%ignore OTMESHING::MeshFile::getSimplicesData;
+
+%include otmeshing/MeshFile.hxx
+
+%extend OTMESHING::MeshFile {
+
+PyObject * _getArrayViews() const
+{
+  static swig_type_info * meshFileType = SWIG_TypeQuery("OTMESHING::MeshFile *");
+  const Py_ssize_t dimension = self->getDimension();
+  const Py_ssize_t verticesNumber = self->getVerticesNumber();
+  const Py_ssize_t simplicesNumber = self->getSimplicesNumber();
+  // each view holds a copy sharing the mapping
+  PyObject * vertices = OTMESHING::ArrayView(SWIG_NewPointerObj(new OTMESHING::MeshFile(*self), meshFileType, SWIG_POINTER_OWN),
+                                             verticesNumber ? self->getVerticesData() : 0,
+                                             Py_BuildValue("(nn)", verticesNumber, dimension), 'f', sizeof(OT::Scalar));
+  PyObject * simplices = OTMESHING::ArrayView(SWIG_NewPointerObj(new OTMESHING::MeshFile(*self), meshFileType, SWIG_POINTER_OWN),
+                                              simplicesNumber ? self->getSimplicesData() : 0,
+                                              Py_BuildValue("(nn)", simplicesNumber, dimension + 1), 'u', self->getIndexSize());
+  return Py_BuildValue("(NN)", vertices, simplices);
+}
+
+%pythoncode %{
+def getArrays(self):
+    """
+    Mapped blocks as numpy arrays without copy.
+
+    Returns
+    -------
+    vertices : :class:`numpy.ndarray`
+        Read-only float64 array of shape (n, d) viewing the vertex block.
+    simplices : :class:`numpy.ndarray`
+        Read-only uint32 or uint64 array of shape (m, d + 1) viewing the simplex block.
+
+    Notes
+    -----
+    The pages are read from the file on access and the arrays keep the file mapped.
+
+    Examples
+    --------
+    >>> import openturns as ot
+    >>> import otmeshing
+    >>> mesh = ot.IntervalMesher([2] * 2).build(ot.Interval([0.0] * 2, [1.0] * 2))
+    >>> otmeshing.MeshFile.Write(mesh, 'mesh.otm')
+    >>> vertices, simplices = otmeshing.MeshFile('mesh.otm').getArrays()
+    >>> simplices.dtype, simplices.shape
+    (dtype('uint32'), (8, 3))
+    """
+    return _ArrayViews(self._getArrayViews())
+%}
+}
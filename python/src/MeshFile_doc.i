@@ -0,0 +1,136 @@
+%feature("docstring") OTMESHING::MeshFile
+"Memory-mapped binary mesh file.
+
+The file holds a fixed-size header, then a contiguous block of float64 vertices
+and a contiguous block of 32 or 64-bit simplex indices, both 64-byte aligned.
+Opening a file maps it read-only, reads the header and checks that the
+simplex indices are less than the number of vertices, so that a corrupted file
+is rejected with a TypeError; the vertices are not read, their pages are loaded
+by the system when they are accessed.
+
+The file uses the native byte order of the machine that wrote it, it is
+rejected on a machine of the other byte order.
+
+Parameters
+----------
+fileName : str
+    Path of a file written by :meth:`Write`.
+
+Examples
+--------
+>>> import openturns as ot
+>>> import otmeshing
+>>> mesh = ot.IntervalMesher([2] * 3).build(ot.Interval([0.0] * 3, [1.0] * 3))
+>>> otmeshing.MeshFile.Write(mesh, 'mesh.otm')
+>>> meshFile = otmeshing.MeshFile('mesh.otm')
+>>> meshFile.getSimplicesNumber()
+48
+>>> domain = otmeshing.MeshDomain2(meshFile.getMesh())"
+
+// ---------------------------------------------------------------------
+
+%feature("docstring") OTMESHING::MeshFile::Write
+"Write a mesh.
+
+Parameters
+----------
+mesh : :class:`~openturns.Mesh`
+    Mesh to write.
+fileName : str
+    Path of the file, overwritten if it exists.
+compactIndices : bool, optional
+    Whether the simplex indices are stored on 32 bits instead of 64 bits.
+    Default is True, it requires less than :math:`2^{32}` vertices."
+
+// ---------------------------------------------------------------------
+
+%feature("docstring") OTMESHING::MeshFile::getFileName
+"File name accessor.
+
+Returns
+-------
+fileName : str
+    Path of the mapped file."
+
+// ---------------------------------------------------------------------
+
+%feature("docstring") OTMESHING::MeshFile::getDimension
+"Dimension accessor.
+
+Returns
+-------
+dimension : int
+    Dimension of the vertices."
+
+// ---------------------------------------------------------------------
+
+%feature("docstring") OTMESHING::MeshFile::getVerticesNumber
+"Number of vertices accessor.
+
+Returns
+-------
+number : int
+    Number of vertices."
+
+// ---------------------------------------------------------------------
+
+%feature("docstring") OTMESHING::MeshFile::getSimplicesNumber
+"Number of simplices accessor.
+
+Returns
+-------
+number : int
+    Number of simplices."
+
+// ---------------------------------------------------------------------
+
+%feature("docstring") OTMESHING::MeshFile::getIndexSize
+"Index size accessor.
+
+Returns
+-------
+size : int
+    Size in bytes of the stored simplex indices, 4 or 8."
+
+// ---------------------------------------------------------------------
+
+%feature("docstring") OTMESHING::MeshFile::getVertex
+"Read a vertex from the mapped block.
+
+Parameters
+----------
+index : int
+    Vertex index.
+
+Returns
+-------
+vertex : :class:`~openturns.Point`
+    Vertex."
+
+// ---------------------------------------------------------------------
+
+%feature("docstring") OTMESHING::MeshFile::getSimplex
+"Read a simplex from the mapped block.
+
+Parameters
+----------
+index : int
+    Simplex index.
+
+Returns
+-------
+simplex : :class:`~openturns.Indices`
+    Vertex indices of the simplex."
+
+// ---------------------------------------------------------------------
+
+%feature("docstring") OTMESHING::MeshFile::getMesh
+"Copy the mapped blocks into a mesh.
+
+The blocks are copied as they are, without any parsing, the 32-bit indices
+are widened.
+
+Returns
+-------
+mesh : :class:`~openturns.Mesh`
+    Stored mesh."
@@ -0,0 +1,38 @@
+// SWIG file PointLocator.i
+
+%{
+#include "otmeshing/PointLocator.hxx"
+%}
+
+%include PointLocator_doc.i
+
+%copyctor OTMESHING::PointLocator;
+
+// release the GIL during the computations
+%thread OTMESHING::PointLocator::PointLocator;
+%thread OTMESHING::PointLocator::query;
+%thread OTMESHING::PointLocator::interpolate;
+
+// the coordinates are returned by queryWithCoordinates
+%ignore OTMESHING::PointLocator::query(const OT::Sample & sample, OT::Sample & barycentricCoordinates) const;
+
+%include otmeshing/PointLocator.hxx
+
+%extend OTMESHING::PointLocator {
+
+PyObject * queryWithCoordinates(const OT::Sample & sample) const
+{
+  static swig_type_info * indicesType = SWIG_TypeQuery("OT::Indices *");
+  static swig_type_info * sampleType = SWIG_TypeQuery("OT::Sample *");
+  OT::Indices * simplexIndices = new OT::Indices;
+  OT::Sample * barycentricCoordinates = new OT::Sample;
+  {
+    SWIG_PYTHON_THREAD_BEGIN_ALLOW;
+    *simplexIndices = self->query(sample, *barycentricCoordinates);
+    SWIG_PYTHON_THREAD_END_ALLOW;
+  }
+  return Py_BuildValue("(NN)", SWIG_NewPointerObj(simplexIndices, indicesType, SWIG_POINTER_OWN),
+                       SWIG_NewPointerObj(barycentricCoordinates, sampleType, SWIG_POINTER_OWN));
+}
+
+}
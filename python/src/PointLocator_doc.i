@@ -0,0 +1,140 @@
+%feature("docstring") OTMESHING::PointLocator
+"Batch point location in a volumetric mesh.
+
+Finds the simplex containing each query point and its barycentric
+coordinates, for instance to interpolate values given at the vertices of a
+mesh built by :class:`~otmeshing.CloudMesher`.
+
+The query points are sorted along a Morton curve and split into blocks
+processed in parallel. In a block, each point is located by a walk through the
+simplex adjacency, crossing the facet of the most negative barycentric
+coordinate, started from the simplex of the previous point, which is close.
+The first walk of a block starts next to the nearest vertex found by a
+:class:`~otmeshing.KDTree2`. When a walk leaves the mesh, which happens for
+the points outside of the mesh or behind a concave part of its boundary, the
+candidates of a :class:`~otmeshing.BoundingBoxTree` are tested instead.
+
+Parameters
+----------
+mesh : :class:`~openturns.Mesh`
+    Volumetric mesh, its dimension and intrinsic dimension must be equal.
+
+Examples
+--------
+>>> import openturns as ot
+>>> import otmeshing
+>>> mesh = ot.IntervalMesher([4] * 2).build(ot.Interval(2))
+>>> locator = otmeshing.PointLocator(mesh)
+>>> simplexIndices = locator.query([[0.1, 0.1], [0.6, 0.3], [2.0, 2.0]])
+>>> simplexIndices[2] == mesh.getSimplicesNumber()
+True"
+
+// ---------------------------------------------------------------------
+
+%feature("docstring") OTMESHING::PointLocator::getMesh
+"Indexed mesh accessor.
+
+Returns
+-------
+mesh : :class:`~openturns.Mesh`
+    Indexed mesh."
+
+// ---------------------------------------------------------------------
+
+%feature("docstring") OTMESHING::PointLocator::query
+"Locate points.
+
+Parameters
+----------
+x : sequence of float or 2-d sequence of float
+    Query point or sample of query points.
+
+Returns
+-------
+index : int or :class:`~openturns.Indices`
+    Index of the simplex containing each point, the number of simplices of the
+    mesh for the points outside of it. A point on a facet shared by several
+    simplices gets one of them."
+
+// ---------------------------------------------------------------------
+
+%feature("docstring") OTMESHING::PointLocator::queryWithCoordinates
+"Locate points with their barycentric coordinates.
+
+Parameters
+----------
+sample : 2-d sequence of float
+    Query points.
+
+Returns
+-------
+simplexIndices : :class:`~openturns.Indices`
+    Index of the simplex containing each point, the number of simplices of the
+    mesh for the points outside of it.
+barycentricCoordinates : :class:`~openturns.Sample`
+    Coordinates of each point with respect to the vertices of its simplex, in
+    the order of the simplex, of dimension :math:`d + 1`. They are null for the
+    points outside of the mesh.
+
+Examples
+--------
+>>> import openturns as ot
+>>> import otmeshing
+>>> mesh = ot.IntervalMesher([4] * 2).build(ot.Interval(2))
+>>> locator = otmeshing.PointLocator(mesh)
+>>> simplexIndices, coordinates = locator.queryWithCoordinates([[0.1, 0.1]])
+>>> vertices = mesh.getVertices().select(mesh.getSimplices()[simplexIndices[0]])
+>>> point = coordinates[0][0] * vertices[0] + coordinates[0][1] * vertices[1] + coordinates[0][2] * vertices[2]
+>>> [round(xi, 6) for xi in point]
+[0.1, 0.1]"
+
+// ---------------------------------------------------------------------
+
+%feature("docstring") OTMESHING::PointLocator::interpolate
+"Barycentric interpolation.
+
+Parameters
+----------
+vertexValues : 2-d sequence of float
+    Values at the vertices of the mesh, one row per vertex.
+sample : 2-d sequence of float
+    Query points.
+
+Returns
+-------
+values : :class:`~openturns.Sample`
+    Values interpolated linearly in the simplex containing each point,
+    NaN for the points outside of the mesh.
+
+Examples
+--------
+>>> import openturns as ot
+>>> import otmeshing
+>>> mesh = ot.IntervalMesher([4] * 2).build(ot.Interval(2))
+>>> f = ot.SymbolicFunction(['x', 'y'], ['2 * x - y'])
+>>> locator = otmeshing.PointLocator(mesh)
+>>> values = locator.interpolate(f(mesh.getVertices()), [[0.3, 0.7]])
+>>> round(values[0, 0], 6)
+-0.1"
+
+// ---------------------------------------------------------------------
+
+%feature("docstring") OTMESHING::PointLocator::setBarycentricCoordinatesEpsilon
+"Barycentric coordinates tolerance accessor.
+
+Parameters
+----------
+epsilon : float
+    A point is in a simplex when all its barycentric coordinates are
+    larger than :math:`-\epsilon`. Default is :math:`10^{-12}`."
+
+// ---------------------------------------------------------------------
+
+%feature("docstring") OTMESHING::PointLocator::getBarycentricCoordinatesEpsilon
+"Barycentric coordinates tolerance accessor.
+
+Returns
+-------
+epsilon : float
+    A point is in a simplex when all its barycentric coordinates are
+    larger than :math:`-\epsilon`."
@@ -6,6 +6,10 @@
 
 %include PolygonMesher_doc.i
 
+// release the GIL during the computations
+%thread OTMESHING::PolygonMesher::build;
+%thread OTMESHING::PolygonMesher::buildBatch;
+
 %include otmeshing/PolygonMesher.hxx
 
 %copyctor OTMESHING::PolygonMesher;
@@ -1,6 +1,11 @@
 %feature("docstring") OTMESHING::PolygonMesher
 "2-d Polygon meshing algorithm.
 
+The polygon is meshed by a constrained Delaunay triangulation whose vertices
+carry their input index, the edges of the outer ring and of the holes being
+the constraints. The triangles are kept according to the parity of their
+nesting level, so that the holes are left empty.
+
 Examples
 --------
 Triangulate a parallelogram:
@@ -8,7 +13,13 @@ Triangulate a parallelogram:
 >>> import otmeshing
 >>> mesher = otmeshing.PolygonMesher()
 >>> polyline = [[0, 0], [3, 0], [4, 2], [1, 2]]
->>> triangulation = mesher.build(polyline)"
+>>> triangulation = mesher.build(polyline)
+
+Triangulate a square with a square hole:
+
+>>> outer = [[0, 0], [3, 0], [3, 3], [0, 3]]
+>>> hole = [[1, 1], [1, 2], [2, 2], [2, 1]]
+>>> triangulation = mesher.build(outer, [hole])"
 
 // ---------------------------------------------------------------------
 
@@ -22,8 +33,56 @@ polyline : :py:class:`openturns.Sample`
     The polygon must be simple (with no redundant vertex).
     The vertices can be of dimension greater than 2,
     but the polygon itsef should be within a single plane.
+holes : sequence of :py:class:`openturns.Sample`, optional
+    Ordered sets of vertices defining the holes, in the plane of the polygon,
+    nested in it and disjoint from each other.
 
 Returns
 -------
 mesh : :py:class:`openturns.Mesh`
-    The triangulation generated."
+    The triangulation generated.
+    Its vertices are the vertices of the polygon followed by those of the holes."
+
+// ---------------------------------------------------------------------
+
+%feature("docstring") OTMESHING::PolygonMesher::buildBatch
+"Generate the meshes of several polygons in parallel.
+
+Parameters
+----------
+polylines : sequence of :py:class:`openturns.Sample`
+    Polygons, as in :meth:`build`.
+holes : sequence of :py:class:`openturns.Sample`, optional
+    Holes of all the polygons, as in :meth:`build`.
+holeOwners : sequence of int, optional
+    Index of the polygon of each hole.
+
+Returns
+-------
+meshes : sequence of :py:class:`openturns.Mesh`
+    The triangulations generated, in the same order.
+
+Examples
+--------
+>>> import otmeshing
+>>> mesher = otmeshing.PolygonMesher()
+>>> outers = [[[0, 0], [3, 0], [3, 3], [0, 3]], [[4, 0], [5, 0], [5, 1], [4, 1]]]
+>>> holes = [[[1, 1], [1, 2], [2, 2], [2, 1]]]
+>>> triangulations = mesher.buildBatch(outers, holes, [0])
+>>> [round(t.getVolume(), 6) for t in triangulations]
+[8.0, 1.0]"
+
+// ---------------------------------------------------------------------
+
+%feature("docstring") OTMESHING::PolygonMesher::getStatistics
+"Statistics accessor.
+
+The phase wall-times and counters of the last build are only recorded when
+the `MeshingStatistics-Enabled` key of :class:`openturns.ResourceMap` is
+set to True, otherwise the result is empty.
+
+Returns
+-------
+statistics : :py:class:`openturns.PointWithDescription`
+    Phase wall-time in seconds *triangulationTime*,
+    and the counters *simplicesProduced*, *piecesProduced*."
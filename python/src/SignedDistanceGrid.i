@@ -0,0 +1,15 @@
+// SWIG file SignedDistanceGrid.i
+
+%{
+#include "otmeshing/SignedDistanceGrid.hxx"
+%}
+
+%include SignedDistanceGrid_doc.i
+
+%copyctor OTMESHING::SignedDistanceGrid;
+
+// release the GIL during the computations
+%thread OTMESHING::SignedDistanceGrid::SignedDistanceGrid;
+%thread OTMESHING::SignedDistanceGrid::computeDistance;
+
+%include otmeshing/SignedDistanceGrid.hxx
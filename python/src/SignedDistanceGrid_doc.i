@@ -0,0 +1,100 @@
+%feature("docstring") OTMESHING::SignedDistanceGrid
+"Signed distance to a mesh domain sampled on a regular grid.
+
+The exact signed distance of :class:`~otmeshing.MeshDomain2` is computed in
+parallel at the nodes of a regular grid when the object is built. The distance
+of a point inside the grid is then the multilinear interpolation of the values
+at the corners of its cell, at a cost independent of the size of the mesh.
+The points outside of the grid get the exact distance.
+
+As the signed distance is 1-Lipschitz and the interpolation weights are
+convex, the interpolation error is less than half the diagonal of a cell, see
+:meth:`getErrorBound`.
+
+Parameters
+----------
+domain : :class:`~otmeshing.MeshDomain2`
+    Domain.
+bounds : :class:`~openturns.Interval`, optional
+    Grid bounds, the bounding box of the vertices of the domain by default.
+discretization : sequence of int
+    Number of cells along each axis.
+
+Examples
+--------
+>>> import openturns as ot
+>>> import otmeshing
+>>> mesh = ot.IntervalMesher([2] * 2).build(ot.Interval([0.0] * 2, [1.0] * 2))
+>>> domain = otmeshing.MeshDomain2(mesh)
+>>> grid = otmeshing.SignedDistanceGrid(domain, ot.Interval([-1.0] * 2, [2.0] * 2), [60] * 2)
+>>> distance = grid.computeDistance([0.5, 0.4])
+>>> abs(distance - domain.computeDistance([0.5, 0.4])) <= grid.getErrorBound()
+True"
+
+// ---------------------------------------------------------------------
+
+%feature("docstring") OTMESHING::SignedDistanceGrid::computeDistance
+"Compute the approximate signed distance.
+
+Parameters
+----------
+x : sequence of float or 2-d sequence of float
+    Query point or sample of query points.
+
+Returns
+-------
+distance : float or :class:`~openturns.Sample`
+    Signed distance, negative inside the domain. It is interpolated in the grid
+    and exact outside of it."
+
+// ---------------------------------------------------------------------
+
+%feature("docstring") OTMESHING::SignedDistanceGrid::getErrorBound
+"Interpolation error bound accessor.
+
+Returns
+-------
+errorBound : float
+    Bound of the absolute error on the distance of the points inside the grid,
+    half the diagonal of a cell."
+
+// ---------------------------------------------------------------------
+
+%feature("docstring") OTMESHING::SignedDistanceGrid::getDomain
+"Domain accessor.
+
+Returns
+-------
+domain : :class:`~otmeshing.MeshDomain2`
+    Domain."
+
+// ---------------------------------------------------------------------
+
+%feature("docstring") OTMESHING::SignedDistanceGrid::getBounds
+"Grid bounds accessor.
+
+Returns
+-------
+bounds : :class:`~openturns.Interval`
+    Grid bounds."
+
+// ---------------------------------------------------------------------
+
+%feature("docstring") OTMESHING::SignedDistanceGrid::getDiscretization
+"Discretization accessor.
+
+Returns
+-------
+discretization : :class:`~openturns.Indices`
+    Number of cells along each axis."
+
+// ---------------------------------------------------------------------
+
+%feature("docstring") OTMESHING::SignedDistanceGrid::getValues
+"Node values accessor.
+
+Returns
+-------
+values : :class:`~openturns.Sample`
+    Exact signed distances at the nodes of the grid, the index along the first
+    axis varies fastest."
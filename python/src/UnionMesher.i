@@ -8,6 +8,73 @@
 
 %include UnionMesher_doc.i
 
+// release the GIL during the computations
+%thread OTMESHING::UnionMesher::build;
+%thread OTMESHING::UnionMesher::CompressMesh;
+
+// the collection of compact meshes is converted by _buildCompact
+%ignore OTMESHING::UnionMesher::buildCompact;
+
 %include otmeshing/UnionMesher.hxx
 
 %copyctor OTMESHING::UnionMesher;
+
+%extend OTMESHING::UnionMesher {
+
+OTMESHING::CompactMesh _buildCompact(PyObject * pyObj) const
+{
+  static swig_type_info * compactMeshType = SWIG_TypeQuery("OTMESHING::CompactMesh *");
+  if (!PySequence_Check(pyObj))
+    throw OT::InvalidArgumentException(HERE) << "Expected a sequence of CompactMesh";
+  const Py_ssize_t size = PySequence_Size(pyObj);
+  OTMESHING::UnionMesher::CompactMeshCollection coll(size);
+  for (Py_ssize_t i = 0; i < size; ++ i)
+  {
+    PyObject * item = PySequence_GetItem(pyObj, i);
+    void * ptr = 0;
+    const int res = SWIG_ConvertPtr(item, &ptr, compactMeshType, 0);
+    Py_XDECREF(item);
+    if (!SWIG_IsOK(res))
+      throw OT::InvalidArgumentException(HERE) << "Expected a sequence of CompactMesh, item " << i << " is not";
+    coll[i] = *reinterpret_cast<OTMESHING::CompactMesh *>(ptr);
+  }
+  OTMESHING::CompactMesh result;
+  {
+    SWIG_PYTHON_THREAD_BEGIN_ALLOW;
+    result = self->buildCompact(coll);
+    SWIG_PYTHON_THREAD_END_ALLOW;
+  }
+  return result;
+}
+
+%pythoncode %{
+def buildCompact(self, coll):
+    """
+    Generate a mesh with 32-bit indices from the union of meshes.
+
+    The disjoint union is concatenated without widening the indices,
+    the overlap resolution goes through :meth:`build`.
+
+    Parameters
+    ----------
+    coll : sequence of :class:`CompactMesh`
+        Meshes, assumed non-overlapping unless overlap resolution is enabled.
+
+    Returns
+    -------
+    mesh : :class:`CompactMesh`
+        The mesh of the union.
+
+    Examples
+    --------
+    >>> import openturns as ot
+    >>> import otmeshing
+    >>> mesh1 = ot.IntervalMesher([1] * 2).build(ot.Interval([0.0] * 2, [1.0] * 2))
+    >>> mesh2 = ot.IntervalMesher([1] * 2).build(ot.Interval([2.0] * 2, [3.0] * 2))
+    >>> coll = [otmeshing.CompactMesh(mesh1), otmeshing.CompactMesh(mesh2)]
+    >>> otmeshing.UnionMesher().buildCompact(coll).getSimplicesNumber()
+    4
+    """
+    return self._buildCompact(coll)
+%}
+}
@@ -1,5 +1,10 @@
 %feature("docstring") OTMESHING::UnionMesher
-"Union of disjoint meshes.
+"Union of meshes.
+
+By default the meshes are assumed disjoint and are simply concatenated.
+When overlap resolution is enabled each simplex is clipped against the
+simplices of the previous meshes so that overlapping regions are only
+covered once.
 
 Examples
 --------
@@ -14,12 +19,12 @@ Examples
 // ---------------------------------------------------------------------
 
 %feature("docstring") OTMESHING::UnionMesher::build
-"Generate a mesh from the union of disjoint meshes.
+"Generate a mesh from the union of meshes.
 
 Parameters
 ----------
 coll : sequence of :py:class:`openturns.Mesh`
-    Non-overlapping meshes.
+    Meshes, assumed non-overlapping unless overlap resolution is enabled.
 
 Returns
 -------
@@ -31,7 +36,10 @@ mesh : :py:class:`openturns.Mesh`
 %feature("docstring") OTMESHING::UnionMesher::CompressMesh
 "Deduplicate mesh vertices.
 
-A k-D tree radius search is used to filter out duplicate vertices.
+Vertices are snapped to a hash grid of the size of the tolerance and
+each vertex is mapped to the first vertex found within tolerance in the
+neighbouring cells. Simplices collapsed by the deduplication, duplicate
+simplices and vertices no longer referenced are dropped.
 
 Parameters
 ----------
@@ -41,5 +49,48 @@ mesh : :py:class:`openturns.Mesh`
 Returns
 -------
 compressedMesh : :py:class:`openturns.Mesh`
-    The crompressed mesh.
+    The compressed mesh.
 "
+
+// ---------------------------------------------------------------------
+
+%feature("docstring") OTMESHING::UnionMesher::setResolveOverlaps
+"Overlap resolution flag accessor.
+
+When enabled, the simplices of each mesh are clipped against the simplices
+of the previous meshes: the convex difference is computed from the
+H-representations of the simplices and the convex pieces are triangulated,
+then the vertices are deduplicated.
+This requires cddlib.
+
+Parameters
+----------
+resolveOverlaps : bool
+    Whether overlaps are removed, default is False."
+
+// ---------------------------------------------------------------------
+
+%feature("docstring") OTMESHING::UnionMesher::getResolveOverlaps
+"Overlap resolution flag accessor.
+
+Returns
+-------
+resolveOverlaps : bool
+    Whether overlaps are removed."
+
+// ---------------------------------------------------------------------
+
+%feature("docstring") OTMESHING::UnionMesher::getStatistics
+"Statistics accessor.
+
+The phase wall-times and counters of the last build are only recorded when
+the `MeshingStatistics-Enabled` key of :class:`openturns.ResourceMap` is
+set to True, otherwise the result is empty.
+
+Returns
+-------
+statistics : :py:class:`openturns.PointWithDescription`
+    Phase wall-times in seconds: *concatenationTime*, and with overlap
+    resolution *clippingTime*, *triangulationTime*, *compressTime*,
+    and the counters *pairsTested*, *pairsPruned*, *cddCalls*,
+    *piecesProduced*, *clippedSimplices*, *verticesDeduplicated*."
@@ -0,0 +1,157 @@
+// SWIG file otmeshing_buffer.i
+
+%{
+namespace OTMESHING
+{
+
+/* Borrowed view over a C-contiguous 2-d float64 buffer such as a numpy array, nothing is copied */
+class ScalarBuffer
+{
+public:
+  explicit ScalarBuffer(PyObject * pyObj)
+  {
+    if (PyObject_GetBuffer(pyObj, &view_, PyBUF_C_CONTIGUOUS | PyBUF_FORMAT) < 0)
+    {
+      PyErr_Clear();
+      throw OT::InvalidArgumentException(HERE) << "Expected a C-contiguous array supporting the buffer protocol";
+    }
+    // skip the native byte order prefixes
+    const char * format = view_.format;
+    if (format && ((*format == '@') || (*format == '=') || (*format == (PY_LITTLE_ENDIAN ? '<' : '>'))))
+      ++ format;
+    if ((view_.ndim != 2) || !format || (OT::String(format) != "d"))
+    {
+      const int ndim = view_.ndim;
+      PyBuffer_Release(&view_);
+      throw OT::InvalidArgumentException(HERE) << "Expected a 2-d array of float64, got ndim=" << ndim;
+    }
+  }
+
+  ~ScalarBuffer()
+  {
+    PyBuffer_Release(&view_);
+  }
+
+  const OT::Scalar * data() const
+  {
+    return static_cast<const OT::Scalar *>(view_.buf);
+  }
+
+  OT::UnsignedInteger getSize() const
+  {
+    return view_.shape[0];
+  }
+
+  OT::UnsignedInteger getDimension() const
+  {
+    return view_.shape[1];
+  }
+
+private:
+  ScalarBuffer(const ScalarBuffer &) = delete;
+  ScalarBuffer & operator=(const ScalarBuffer &) = delete;
+
+  Py_buffer view_;
+};
+
+/* Pair (owner, __array_interface__) describing a read-only C++ buffer, the owner keeps the buffer alive */
+static PyObject * ArrayView(PyObject * owner, const void * data, PyObject * shape, const char typeCode, const size_t itemSize)
+{
+  // numpy refuses null pointers, even for empty arrays
+  static const OT::Scalar empty = 0.0;
+  const OT::String typestr(OT::OSS() << (PY_LITTLE_ENDIAN ? '<' : '>') << typeCode << itemSize);
+  PyObject * address = PyLong_FromVoidPtr(const_cast<void *>(data ? data : &empty));
+  return Py_BuildValue("(N{s:N,s:s,s:(NO),s:i})", owner,
+                       "shape", shape,
+                       "typestr", typestr.c_str(),
+                       "data", address, Py_True,
+                       "version", 3);
+}
+
+/* The owner shares the sample buffer, it cannot be modified in place as it is copied on write */
+static PyObject * SampleArrayView(const OT::Sample & sample, const bool flatten = false)
+{
+  static swig_type_info * sampleType = SWIG_TypeQuery("OT::Sample *");
+  OT::Sample * owner = new OT::Sample(sample);
+  const Py_ssize_t size = owner->getSize();
+  const Py_ssize_t dimension = owner->getDimension();
+  const OT::Scalar * data = size ? owner->getImplementation()->data() : 0;
+  PyObject * shape = flatten ? Py_BuildValue("(n)", size * dimension) : Py_BuildValue("(nn)", size, dimension);
+  return ArrayView(SWIG_NewPointerObj(owner, sampleType, SWIG_POINTER_OWN), data, shape, 'f', sizeof(OT::Scalar));
+}
+
+/* The simplices of a mesh all have the same number of vertices so the collection is a 2-d array */
+static PyObject * IndicesArrayView(const OT::IndicesCollection & indices, const OT::UnsignedInteger width)
+{
+  static swig_type_info * indicesType = SWIG_TypeQuery("OT::IndicesCollection *");
+  OT::IndicesCollection * owner = new OT::IndicesCollection(indices);
+  const Py_ssize_t size = owner->getSize();
+  const OT::UnsignedInteger * data = size ? &(*owner->cbegin_at(0)) : 0;
+  PyObject * shape = Py_BuildValue("(nn)", size, static_cast<Py_ssize_t>(width));
+  return ArrayView(SWIG_NewPointerObj(owner, indicesType, SWIG_POINTER_OWN), data, shape, 'u', sizeof(OT::UnsignedInteger));
+}
+
+static PyObject * MeshArrayViews(const OT::Mesh & mesh)
+{
+  return Py_BuildValue("(NN)", SampleArrayView(mesh.getVertices()),
+                       IndicesArrayView(mesh.getSimplices(), mesh.getDimension() + 1));
+}
+
+}
+%}
+
+%inline %{
+PyObject * _MeshArrayViews(const OT::Mesh & mesh)
+{
+  return OTMESHING::MeshArrayViews(mesh);
+}
+%}
+
+%pythoncode %{
+class _ArrayView(object):
+    """Exposes a C++ buffer to numpy, the view holds the owner of the buffer."""
+
+    def __init__(self, owner, interface):
+        self.owner = owner
+        self.__array_interface__ = interface
+
+
+def _ArrayViews(views):
+    import numpy
+
+    return tuple(numpy.asarray(_ArrayView(*view)) for view in views)
+
+
+def MeshArrays(mesh):
+    """
+    Mesh vertices and simplices as numpy arrays without copy.
+
+    Parameters
+    ----------
+    mesh : :py:class:`openturns.Mesh`
+        The mesh.
+
+    Returns
+    -------
+    vertices : :class:`numpy.ndarray`
+        Read-only float64 array of shape (n, d) viewing the vertices buffer.
+    simplices : :class:`numpy.ndarray`
+        Read-only unsigned integer array of shape (m, d + 1) viewing the simplices buffer.
+
+    Notes
+    -----
+    The arrays share the memory of the mesh and stay valid after the mesh
+    is released or modified: a modified mesh gets its own copy of the data.
+    Use :meth:`numpy.ndarray.copy` to get writable arrays.
+
+    Examples
+    --------
+    >>> import openturns as ot
+    >>> import otmeshing
+    >>> mesh = ot.IntervalMesher([2] * 2).build(ot.Interval([0.0] * 2, [1.0] * 2))
+    >>> vertices, simplices = otmeshing.MeshArrays(mesh)
+    >>> vertices.shape, simplices.shape
+    ((9, 2), (8, 3))
+    """
+    return _ArrayViews(_MeshArrayViews(mesh))
+%}
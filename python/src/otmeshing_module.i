@@ -1,6 +1,6 @@
 // SWIG file otmeshing_module.i
 
-%module(docstring="otmeshing module") otmeshing
+%module(docstring="otmeshing module", threads="1") otmeshing
 
 %{
 #include <openturns/OT.hxx>
@@ -16,13 +16,24 @@
 %import base_module.i
 %import uncertainty_module.i
 
+// the GIL is kept by default, it is only released by the heavy methods marked with %thread
+%nothread;
+
 // The new classes
 %include otmeshing/otmeshingprivate.hxx
+%include otmeshing_buffer.i
+%include KDTree2.i
+%include BoundingBoxTree.i
+%include CancellationToken.i
+%include CompactMesh.i
 %include CloudMesher.i
 %include ConvexHullMesher.i
 %include ConvexDecompositionMesher.i
 %include Cylinder.i
 %include IntersectionMesher.i
 %include MeshDomain2.i
+%include MeshFile.i
+%include PointLocator.i
 %include PolygonMesher.i
+%include SignedDistanceGrid.i
 %include UnionMesher.i
@@ -0,0 +1,55 @@
+#! /usr/bin/env python
+
+import openturns as ot
+import otmeshing
+
+ot.TESTPREAMBLE()
+
+for dim in [2, 3]:
+    mesh = ot.IntervalMesher([5] * dim).build(ot.Interval(dim))
+    tree = otmeshing.BoundingBoxTree(mesh)
+    print(tree)
+    vertices = mesh.getVertices()
+    simplices = mesh.getSimplices()
+    queries = ot.JointDistribution([ot.Uniform(-0.2, 1.2)] * dim).getSample(50)
+    candidates = tree.queryContaining(queries)
+    assert len(candidates) == len(queries)
+    for i in range(len(queries)):
+        # brute force bounding box containment
+        expected = []
+        for s in range(len(simplices)):
+            box = vertices.select(simplices[s])
+            if all(box.getMin()[k] <= queries[i, k] <= box.getMax()[k] for k in range(dim)):
+                expected.append(s)
+        assert list(candidates[i]) == expected, f"{i=}"
+        assert list(tree.queryContaining(queries[i])) == expected
+        # the simplex containing the point is among the candidates
+        inside = [s for s in expected if ot.MeshDomain(ot.Mesh(vertices, [simplices[s]])).contains(queries[i])]
+        assert (len(inside) > 0) == ot.Interval(dim).contains(queries[i])
+
+# one large simplex among many small ones
+mesh = ot.IntervalMesher([20, 20]).build(ot.Interval(2))
+vertices = mesh.getVertices()
+simplices = [list(s) for s in mesh.getSimplices()]
+vertices.add([[-1.0, -1.0], [3.0, -1.0], [-1.0, 3.0]])
+n = len(vertices)
+simplices.append([n - 3, n - 2, n - 1])
+tree = otmeshing.BoundingBoxTree(ot.Mesh(vertices, simplices))
+candidates = tree.queryContaining([[0.51, 0.52], [2.5, 2.5]])
+assert len(simplices) - 1 in candidates[0]
+assert len(candidates[0]) <= 5, f"{candidates[0]=}"
+assert list(candidates[1]) == [len(simplices) - 1]
+
+# boxes intersecting an interval
+mesh = ot.IntervalMesher([5, 5]).build(ot.Interval(2))
+tree = otmeshing.BoundingBoxTree(mesh)
+vertices = mesh.getVertices()
+simplices = mesh.getSimplices()
+box = ot.Interval([0.3, 0.1], [0.5, 0.25])
+expected = []
+for s in range(len(simplices)):
+    simplex = vertices.select(simplices[s])
+    lower, upper = simplex.getMin(), simplex.getMax()
+    if all(lower[k] <= box.getUpperBound()[k] and box.getLowerBound()[k] <= upper[k] for k in range(2)):
+        expected.append(s)
+assert list(tree.queryIntersecting(box)) == expected
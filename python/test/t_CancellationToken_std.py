@@ -0,0 +1,116 @@
+#! /usr/bin/env python
+
+import threading
+import time
+import openturns as ot
+import otmeshing
+
+ot.TESTPREAMBLE()
+
+# copies share the state
+token = otmeshing.CancellationToken()
+print(token)
+assert not token.isCancelled()
+copy = otmeshing.CancellationToken(token)
+copy.cancel()
+assert token.isCancelled()
+token.reset()
+assert not copy.isCancelled()
+
+# a cancelled token stops the build
+points = ot.Normal(3).getSample(20000)
+mesher = otmeshing.CloudMesher(otmeshing.CloudMesher.DELAUNAY)
+mesher.setCancellationToken(token)
+token.cancel()
+try:
+    mesher.build(points)
+    raise AssertionError("build should have been cancelled")
+except RuntimeError as exc:
+    print(exc)
+    assert "cancelled" in str(exc)
+    assert otmeshing.CancellationToken.IsInterruption(str(exc))
+token.reset()
+assert mesher.build(points).getSimplicesNumber() > 0
+
+# a failure quoting the interruption prefix is not an interruption
+prefix = otmeshing.CancellationToken.GetInterruptionPrefix()
+assert not otmeshing.CancellationToken.IsInterruption(f"InternalException : {prefix}CloudMesher cancelled")
+
+# cancellation from another thread, the build releases the GIL
+large = ot.Normal(3).getSample(200000)
+timer = threading.Timer(0.05, token.cancel)
+timer.start()
+t0 = time.perf_counter()
+try:
+    mesher.build(large)
+    print("build finished before the cancellation")
+except RuntimeError as exc:
+    print(exc, f"after {time.perf_counter() - t0:.3f}s")
+timer.join()
+token.reset()
+
+# time budget
+mesher.setMaximumTimeDuration(1e-6)
+assert mesher.getMaximumTimeDuration() == 1e-6
+try:
+    mesher.build(large)
+    raise AssertionError("build should have exceeded its budget")
+except RuntimeError as exc:
+    print(exc)
+    assert "maximum time duration" in str(exc)
+mesher.setMaximumTimeDuration(0.0)
+
+# progress reports, increasing fractions in [0, 1]
+reports = []
+mesher.setProgressCallback(lambda fraction, phase: reports.append((fraction, phase)))
+mesh = mesher.build(points)
+fractions = [fraction for fraction, phase in reports]
+print(reports[:3], len(reports))
+assert fractions == sorted(fractions)
+assert fractions[0] == 0.0 and fractions[-1] == 1.0
+assert {phase for fraction, phase in reports} == {"insertion", "extraction", "done"}
+
+# the copies of the mesher keep the callable alive
+copied = []
+mesher.setProgressCallback(lambda fraction, phase: copied.append(phase))
+clone = otmeshing.CloudMesher(mesher)
+mesher.setProgressCallback(None)
+clone.build(points)
+assert copied[-1] == "done"
+del clone
+
+# an exception raised by the callback interrupts the build
+def stop(fraction, phase):
+    if phase == "extraction":
+        raise ValueError("stop")
+
+
+mesher.setProgressCallback(stop)
+try:
+    mesher.build(points)
+    raise AssertionError("build should have been interrupted")
+except Exception as exc:
+    print(exc)
+    # a failure, not a cancellation
+    assert not otmeshing.CancellationToken.IsInterruption(str(exc))
+mesher.setProgressCallback(None)
+
+# convex decomposition of an L-shaped volumetric mesh
+mesh1 = ot.IntervalMesher([3] * 3).build(ot.Interval([0.0] * 3, [2.0] * 3))
+mesh2 = ot.IntervalMesher([3, 3, 1]).build(ot.Interval([2.0, 0.0, 0.0], [4.0, 2.0, 2.0 / 3.0]))
+mesh = otmeshing.UnionMesher.CompressMesh(otmeshing.UnionMesher().build([mesh1, mesh2]))
+for method in [otmeshing.ConvexDecompositionMesher.EXACT, otmeshing.ConvexDecompositionMesher.APPROXIMATE]:
+    decomposer = otmeshing.ConvexDecompositionMesher(method)
+    phases = []
+    decomposer.setProgressCallback(lambda fraction, phase: phases.append(phase))
+    parts = decomposer.build(mesh)
+    print(method, len(parts), sorted(set(phases)))
+    assert phases[-1] == "done"
+    decomposer.setCancellationToken(token)
+    token.cancel()
+    try:
+        decomposer.build(mesh)
+        raise AssertionError("decomposition should have been cancelled")
+    except RuntimeError as exc:
+        print(exc)
+    token.reset()
@@ -51,3 +51,50 @@ for dim in range(1, 5):
     assert triangulation.isValid()
     vol_ref = math.pi**(dim / 2) / math.gamma(dim / 2 + 1)
     ott.assert_almost_equal(vol, vol_ref, 0.1, 0.0)
+
+# pre-flight estimation and memory budget
+ot.RandomGenerator.SetSeed(0)
+points = ot.Normal(4).getSample(6000)
+mesher = otmeshing.CloudMesher(otmeshing.CloudMesher.DELAUNAY)
+estimation = mesher.estimate(points)
+print(f"estimation={estimation}")
+assert list(estimation.getDescription()) == ["simplicesNumber", "memory"]
+ot.ResourceMap.AddAsBool("MeshingStatistics-Enabled", True)
+mesher.setMaximumMemory(int(10 * estimation[1]))
+assert mesher.getMaximumMemory() == int(10 * estimation[1])
+triangulation = mesher.build(points)
+simplicesNumber = triangulation.getSimplicesNumber()
+print(f"simplices={simplicesNumber} relative error={estimation[0] / simplicesNumber - 1.0:.3f}")
+ott.assert_almost_equal(estimation[0], simplicesNumber, 0.3, 0.0)
+statistics = mesher.getStatistics()
+names = list(statistics.getDescription())
+print(statistics)
+for name in ["estimatedSimplices", "estimatedMemory", "peakMemory"]:
+    assert name in names, name
+
+# fail fast above the budget, or fall back to the basic triangulation
+mesher.setMaximumMemory(int(0.5 * estimation[1]))
+try:
+    mesher.build(points)
+    raise AssertionError("build should have exceeded the memory budget")
+except RuntimeError as exc:
+    print(exc)
+mesher.setMemoryFallback(True)
+assert mesher.getMemoryFallback()
+fallback = mesher.build(points)
+assert fallback.getSimplicesNumber() < simplicesNumber
+assert "memoryFallbacks" in list(mesher.getStatistics().getDescription())
+
+# the memory controls are saved
+study = ot.Study()
+study.setStorageManager(ot.XMLStorageManager("cloud.xml"))
+study.add("mesher", mesher)
+study.save()
+study = ot.Study()
+study.setStorageManager(ot.XMLStorageManager("cloud.xml"))
+study.load()
+mesher2 = otmeshing.CloudMesher()
+study.fillObject("mesher", mesher2)
+assert mesher2.getMaximumMemory() == mesher.getMaximumMemory()
+assert mesher2.getMemoryFallback()
+ot.ResourceMap.AddAsBool("MeshingStatistics-Enabled", False)
@@ -0,0 +1,62 @@
+#! /usr/bin/env python
+
+import openturns as ot
+import openturns.testing as ott
+import otmeshing as otm
+
+
+def simplices_list(simplices):
+    return [list(s) for s in simplices]
+
+
+ot.TESTPREAMBLE()
+
+# conversions
+mesh = ot.IntervalMesher([3, 4]).build(ot.Interval([0.0] * 2, [1.0] * 2))
+compactMesh = otm.CompactMesh(mesh)
+print(compactMesh)
+assert compactMesh.getDimension() == 2
+assert compactMesh.getVerticesNumber() == mesh.getVerticesNumber()
+assert compactMesh.getSimplicesNumber() == mesh.getSimplicesNumber()
+assert compactMesh.getSimplex(3) == mesh.getSimplex(3)
+assert simplices_list(compactMesh.getSimplices()) == simplices_list(mesh.getSimplices())
+mesh2 = compactMesh.getMesh()
+ott.assert_almost_equal(mesh2.getVertices(), mesh.getVertices(), 0.0, 0.0)
+assert simplices_list(mesh2.getSimplices()) == simplices_list(mesh.getSimplices())
+
+# invalid index
+try:
+    otm.CompactMesh(ot.Sample([[0.0], [1.0]]), ot.IndicesCollection([[0, 2]]))
+    raise AssertionError("expected a failure")
+except TypeError:
+    pass
+
+# native production by CloudMesher
+for dim in [1, 2, 3]:
+    points = ot.JointDistribution([ot.Uniform()] * dim).getSample(300)
+    mesher = otm.CloudMesher(otm.CloudMesher.DELAUNAY)
+    mesh = mesher.build(points)
+    compactMesh = mesher.buildCompact(points)
+    ott.assert_almost_equal(compactMesh.getVertices(), mesh.getVertices(), 0.0, 0.0)
+    assert simplices_list(compactMesh.getSimplices()) == simplices_list(mesh.getSimplices())
+
+# native union
+meshes = [ot.IntervalMesher([2] * 3).build(ot.Interval([2.0 * i] * 3, [2.0 * i + 1.0] * 3)) for i in range(3)]
+union = otm.UnionMesher().build(meshes)
+compactUnion = otm.UnionMesher().buildCompact([otm.CompactMesh(m) for m in meshes])
+ott.assert_almost_equal(compactUnion.getVertices(), union.getVertices(), 0.0, 0.0)
+assert simplices_list(compactUnion.getSimplices()) == simplices_list(union.getSimplices())
+
+# native distance
+query = ot.JointDistribution([ot.Uniform(-1.0, 6.0)] * 3).getSample(200)
+ott.assert_almost_equal(otm.MeshDomain2.ComputeDistance(compactUnion, query), otm.MeshDomain2(union).computeDistance(query))
+
+# views
+try:
+    import numpy as np
+
+    vertices, simplices = compactUnion.getArrays()
+    assert simplices.dtype == np.uint32
+    np.testing.assert_array_equal(simplices, np.array(union.getSimplices()))
+except ImportError:
+    pass
@@ -1,5 +1,6 @@
 #! /usr/bin/env python
 
+import math
 import openturns as ot
 import openturns.testing as ott
 import otmeshing
@@ -28,6 +29,21 @@ print(mesh.getVolume())
 assert mesh.isValid()
 assert not otmeshing.ConvexDecompositionMesher.IsConvex(mesh)
 
+# convexity checks of volumetric and surface meshes
+cube = ot.IntervalMesher([3] * 3).build(ot.Interval(3))
+assert otmeshing.ConvexDecompositionMesher.IsConvex(cube)
+assert otmeshing.ConvexDecompositionMesher.IsConvex(otmeshing.ConvexHullMesher().build(cube.getVertices()))
+twoCubes = otmeshing.UnionMesher().build([cube, ot.IntervalMesher([1] * 3).build(ot.Interval([2.0] * 3, [3.0] * 3))])
+assert not otmeshing.ConvexDecompositionMesher.IsConvex(twoCubes)
+# closed polygons
+square = ot.Mesh([[0.0, 0.0], [1.0, 0.0], [1.0, 1.0], [0.0, 1.0]], [[0, 1], [1, 2], [2, 3], [3, 0]])
+assert otmeshing.ConvexDecompositionMesher.IsConvex(square)
+lshape = ot.Mesh([[0.0, 0.0], [2.0, 0.0], [2.0, 1.0], [1.0, 1.0], [1.0, 2.0], [0.0, 2.0]], [[i, (i + 1) % 6] for i in range(6)])
+assert not otmeshing.ConvexDecompositionMesher.IsConvex(lshape)
+# a spiral winding twice is locally convex but not convex
+spiral = [[(1.0 + 0.01 * t) * math.cos(t), (1.0 + 0.01 * t) * math.sin(t)] for t in [4.0 * math.pi * i / 40 for i in range(40)]]
+assert not otmeshing.ConvexDecompositionMesher.IsConvex(ot.Mesh(spiral, [[i, (i + 1) % 40] for i in range(40)]))
+
 # build decomposition
 mesher = otmeshing.ConvexDecompositionMesher()
 print("mesher=", mesher)
@@ -57,6 +73,46 @@ for i, convex in enumerate(decomposition):
     volume_sum += convex.getVolume()
 ott.assert_almost_equal(volume_sum, 15.0)
 
+# 3d conforming volumetric mesh, decomposed from its boundary surface
+mesh1 = ot.IntervalMesher([3] * 3).build(ot.Interval([0.0] * 3, [2.0] * 3))
+mesh2 = ot.IntervalMesher([3, 3, 1]).build(ot.Interval([2.0, 0.0, 0.0], [4.0, 2.0, 2.0 / 3.0]))
+mesh = otmeshing.UnionMesher.CompressMesh(otmeshing.UnionMesher().build([mesh1, mesh2]))
+decomposition = mesher.build(mesh)
+volume_sum = 0.0
+for i, convex in enumerate(decomposition):
+    volume_sum += convex.getVolume()
+    assert otmeshing.ConvexDecompositionMesher.IsConvex(convex)
+ott.assert_almost_equal(volume_sum, 32.0 / 3.0)
+
+# a box whose facets have collinear vertices, the fan skips the flat triangles
+box = ot.IntervalMesher([2, 1, 1]).build(ot.Interval([0.0] * 3, [2.0, 1.0, 1.0]))
+decomposition = mesher.build(box)
+volume_sum = 0.0
+for convex in decomposition:
+    volume_sum += convex.getVolume()
+    assert min(convex.computeSimplicesVolume()) > 1e-10
+ott.assert_almost_equal(volume_sum, 2.0)
+
+# approximate decomposition of an L-shaped volumetric mesh
+approximate = otmeshing.ConvexDecompositionMesher(otmeshing.ConvexDecompositionMesher.APPROXIMATE)
+approximate.setConcavityTolerance(1e-6)
+approximate.setMaximumPartNumber(0)
+print("approximate=", approximate)
+decomposition = approximate.build(mesh)
+volume_sum = 0.0
+for i, convex in enumerate(decomposition):
+    volume_sum += convex.getVolume()
+    assert otmeshing.ConvexDecompositionMesher.IsConvex(convex)
+print(f"approximate parts={len(decomposition)} {volume_sum=}")
+ott.assert_almost_equal(volume_sum, 32.0 / 3.0)
+
+# the part budget bounds the number of parts, with a hull volume excess
+approximate.setConcavityTolerance(0.0)
+approximate.setMaximumPartNumber(2)
+decomposition = approximate.build(mesh)
+assert len(decomposition) <= 2
+assert sum(convex.getVolume() for convex in decomposition) >= 32.0 / 3.0 - 1e-8
+
 # Create a 4-D torus
 f = ot.SymbolicFunction(["x0", "x1", "x2", "x3"], ["(x0^2 + x1^2 + x2^2 + x3^2 + 3)^2 - 16 * (x0^2 + x1^2)"])
 levelSet = ot.LevelSet(f, ot.LessOrEqual(), 0.0)
@@ -72,6 +128,8 @@ volume_sum = 0.0
 for i, convex in enumerate(decomposition):
     volume_sum += convex.getVolume()
 ott.assert_almost_equal(volume_sum, mesh.getVolume())
+# adjacent simplices are merged into larger convex cells
+assert len(decomposition) < mesh.getSimplicesNumber()
 
 # Create a 2-D torus, i.e two disks
 f = ot.SymbolicFunction(["x0", "x1"], ["(x0^2 + x1^2 + 3)^2 - 16 * (x0^2)"])
@@ -87,4 +145,20 @@ decomposition = mesher.build(mesh)
 volume_sum = 0.0
 for i, convex in enumerate(decomposition):
     volume_sum += convex.getVolume()
+    assert otmeshing.ConvexDecompositionMesher.IsConvex(convex)
 ott.assert_almost_equal(volume_sum, mesh.getVolume())
+# adjacent simplices are merged into larger convex cells
+assert len(decomposition) < mesh.getSimplicesNumber()
+
+# 2-D rectangle made of two grids: the simplices merge into a few convex cells
+mesh1 = ot.IntervalMesher([4, 4]).build(ot.Interval([0.0, 0.0], [2.0, 2.0]))
+mesh2 = ot.IntervalMesher([4, 4]).build(ot.Interval([2.0, 0.0], [4.0, 2.0]))
+mesh = otmeshing.UnionMesher.CompressMesh(otmeshing.UnionMesher().build([mesh1, mesh2]))
+decomposition = mesher.build(mesh)
+print(f"rectangle parts={len(decomposition)}")
+assert len(decomposition) < mesh.getSimplicesNumber() // 4
+volume_sum = 0.0
+for convex in decomposition:
+    volume_sum += convex.getVolume()
+    assert otmeshing.ConvexDecompositionMesher.IsConvex(convex)
+ott.assert_almost_equal(volume_sum, 8.0)
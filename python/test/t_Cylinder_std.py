@@ -42,6 +42,33 @@ extension2 = ot.Interval([-H2 / 2] * (dim - 2), [H2 / 2] * (dim - 2))
 injection2 = [0] + list(range(3, dim))
 cyl2 = otm.Cylinder(base2, extension2, injection2, M)
 
+print("Product meshes")
+for cyl in [cyl1, cyl2]:
+    mesh = cyl.getMesh()
+    assert mesh.isValid()
+    assert mesh.getVertices() == cyl.getVertices()
+    ott.assert_almost_equal(mesh.getVolume(), cyl.getVolume())
+# square base extended over a 2-d box
+square = ot.IntervalMesher([2, 2]).build(ot.Interval(2))
+cyl = otm.Cylinder(square, ot.Interval([0.0] * 2, [2.0, 3.0]), [1, 3], 3)
+mesh = cyl.getMesh()
+assert mesh.getDimension() == 4
+assert mesh.getVerticesNumber() == 9 * 16
+assert mesh.getSimplicesNumber() == 8 * 9 * 2 * 6
+ott.assert_almost_equal(mesh.getVolume(), 6.0)
+
+print("Domain queries")
+cyl = otm.Cylinder(square, ot.Interval([0.0], [2.0]), [2], 2)
+points = [[0.5, 0.5, 1.0], [2.0, 0.5, 3.0], [0.5, 0.5, 3.0], [0.5, 2.0, 1.0]]
+expected = [-0.5, 2.0**0.5, 1.0, 1.0]
+assert list(cyl.contains(points)) == [True, False, False, False]
+assert cyl.contains(points[0])
+ott.assert_almost_equal(cyl.computeDistance(points), [[d] for d in expected])
+ott.assert_almost_equal(cyl.computeDistance(points[1]), expected[1])
+# consistent with the distance to the product mesh
+domain = otm.MeshDomain2(cyl.getMesh())
+ott.assert_almost_equal(domain.computeDistance(points), [[d] for d in expected])
+
 print("Mesh cylinder 1")
 method = otm.CloudMesher.BASIC
 mesh1 = otm.CloudMesher(method).build(cyl1.getVertices())
@@ -0,0 +1,59 @@
+#! /usr/bin/env python
+
+import openturns as ot
+import otmeshing
+
+ot.TESTPREAMBLE()
+
+dim = 3
+meshes = [ot.IntervalMesher([2] * dim).build(ot.Interval([0.1 * i] * dim, [3.0 + 0.1 * i] * dim)) for i in range(3)]
+mesher = otmeshing.IntersectionMesher()
+
+# progress over the reduction levels
+reports = []
+mesher.setProgressCallback(lambda fraction, phase: reports.append((fraction, phase)))
+reference = mesher.build(meshes)
+fractions = [fraction for fraction, phase in reports]
+print(len(reports), reports[-1])
+assert fractions == sorted(fractions)
+assert 0.0 <= fractions[0] and fractions[-1] == 1.0
+assert reports[-1][1] == "done"
+mesher.setProgressCallback(None)
+
+# cancellation between the simplex pairs
+token = otmeshing.CancellationToken()
+mesher.setCancellationToken(token)
+token.cancel()
+try:
+    mesher.build(meshes)
+    raise AssertionError("intersection should have been cancelled")
+except RuntimeError as exc:
+    print(exc)
+    assert "cancelled" in str(exc)
+token.reset()
+assert mesher.build(meshes).getSimplicesNumber() == reference.getSimplicesNumber()
+
+# cancellation from the callback, at the second pair
+def cancelLater(fraction, phase):
+    if fraction > 0.5:
+        token.cancel()
+
+
+mesher.setProgressCallback(cancelLater)
+try:
+    mesher.build(meshes)
+    raise AssertionError("intersection should have been cancelled")
+except RuntimeError as exc:
+    print(exc)
+    assert otmeshing.CancellationToken.IsInterruption(str(exc))
+token.reset()
+mesher.setProgressCallback(None)
+
+# time budget
+mesher.setMaximumTimeDuration(1e-6)
+try:
+    mesher.build(meshes)
+    raise AssertionError("intersection should have exceeded its budget")
+except RuntimeError as exc:
+    print(exc)
+    assert "maximum time duration" in str(exc)
@@ -0,0 +1,70 @@
+#! /usr/bin/env python
+
+import openturns as ot
+import openturns.testing as ott
+import otmeshing
+
+ot.TESTPREAMBLE()
+
+dim = 3
+mesh1 = ot.IntervalMesher([2] * dim).build(ot.Interval([0.0] * dim, [3.0] * dim))
+mesh2 = ot.IntervalMesher([2] * dim).build(ot.Interval([1.0] * dim, [4.0] * dim))
+mesher = otmeshing.IntersectionMesher()
+
+# disabled by default, the key is registered with the module
+assert ot.ResourceMap.HasKey("MeshingStatistics-Enabled")
+assert not ot.ResourceMap.GetAsBool("MeshingStatistics-Enabled")
+mesher.build([mesh1, mesh2])
+assert mesher.getStatistics().getDimension() == 0
+
+ot.ResourceMap.AddAsBool("MeshingStatistics-Enabled", True)
+mesher.build([mesh1, mesh2])
+statistics = mesher.getStatistics()
+print(statistics)
+names = list(statistics.getDescription())
+for name in ["pairsTested", "pairsPruned", "cddCalls", "piecesProduced", "cddTime", "verticesDeduplicated"]:
+    assert name in names, name
+tested = statistics[names.index("pairsTested")]
+pruned = statistics[names.index("pairsPruned")]
+assert tested == mesh1.getSimplicesNumber() * mesh2.getSimplicesNumber()
+assert 0 < pruned < tested
+assert statistics[names.index("piecesProduced")] > 0
+
+# the record is reset by each build
+mesher.build([mesh1, mesh2])
+assert mesher.getStatistics()[names.index("pairsTested")] == tested
+
+# a single record per call, whatever the nested steps
+mesher.buildConvex([mesh1, mesh2])
+convexNames = list(mesher.getStatistics().getDescription())
+cddCalls = mesher.getStatistics()[convexNames.index("cddCalls")]
+mesher.buildConvex([mesh1, mesh2])
+assert mesher.getStatistics()[convexNames.index("cddCalls")] == cddCalls
+assert "reductionLevels" not in convexNames
+
+# compaction counters
+compactMesher = otmeshing.IntersectionMesher()
+compactMesher.setCompact(True)
+compactMesher.build([mesh1, mesh2])
+compactStatistics = compactMesher.getStatistics()
+compactNames = list(compactStatistics.getDescription())
+for name in ["compactionTime", "piecesAfterCompaction", "simplicesBeforeCompaction", "simplicesAfterCompaction"]:
+    assert name in compactNames, name
+assert compactStatistics[compactNames.index("piecesAfterCompaction")] <= compactStatistics[compactNames.index("piecesProduced")]
+# merging never adds simplices nor changes the volume
+assert compactStatistics[compactNames.index("simplicesAfterCompaction")] <= compactStatistics[compactNames.index("simplicesBeforeCompaction")]
+compactVolume = compactMesher.build([mesh1, mesh2]).getVolume()
+ott.assert_almost_equal(compactVolume, mesher.build([mesh1, mesh2]).getVolume(), 1e-6)
+
+# nested meshers
+union = otmeshing.UnionMesher()
+union.build([mesh1, mesh2])
+assert "concatenationTime" in union.getStatistics().getDescription()
+cloud = otmeshing.CloudMesher()
+triangulation = cloud.build(mesh1.getVertices())
+cloudStatistics = cloud.getStatistics()
+assert cloudStatistics[list(cloudStatistics.getDescription()).index("simplicesProduced")] == triangulation.getSimplicesNumber()
+domain = otmeshing.MeshDomain2(mesh1)
+domain.computeDistance(ot.Normal(dim).getSample(10))
+assert "treeBuildTime" in domain.getStatistics().getDescription()
+ot.ResourceMap.AddAsBool("MeshingStatistics-Enabled", False)
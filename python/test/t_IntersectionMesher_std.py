@@ -26,6 +26,17 @@ for compression in [False, True]:
             print(bmesh)
             # bmesh.exportToVTKFile("/tmp/boundary.vtk")
 
+# merge convex pieces between reduction levels
+mesher.setCompact(True)
+for dim in range(2, 5):
+    mesh1 = ot.IntervalMesher([2] * dim).build(ot.Interval([0.0] * dim, [3.0] * dim))
+    mesh2 = ot.IntervalMesher([1] * dim).build(ot.Interval([1.0] * dim, [4.0] * dim))
+    intersection = mesher.build([mesh1, mesh2])
+    volume = intersection.getVolume()
+    print(f"{dim=} compact intersection={intersection} {volume=:.3g}")
+    ott.assert_almost_equal(volume, 2.0**dim)
+mesher.setCompact(False)
+
 # empty/self intersection
 dim = 3
 mesh1 = ot.IntervalMesher([1] * dim).build(ot.Interval([0.0] * dim, [1.0] * dim))
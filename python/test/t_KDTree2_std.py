@@ -0,0 +1,48 @@
+#! /usr/bin/env python
+
+import openturns as ot
+import openturns.testing as ott
+import otmeshing
+
+ot.TESTPREAMBLE()
+
+for dim in [2, 3]:
+    points = ot.JointDistribution([ot.Uniform()] * dim).getSample(200)
+    tree = otmeshing.KDTree2(points)
+    print(tree)
+    queries = ot.JointDistribution([ot.Uniform()] * dim).getSample(20)
+
+    # kNN against brute force
+    k = 5
+    nearest = tree.queryNearest(queries, k)
+    assert len(nearest) == len(queries)
+    for i in range(len(queries)):
+        distances = [(points[j] - queries[i]).norm() for j in range(len(points))]
+        expected = sorted(range(len(points)), key=lambda j: distances[j])[:k]
+        assert list(nearest[i]) == expected, f"{i=} {list(nearest[i])} {expected}"
+        assert list(tree.queryNearest(queries[i], k)) == expected
+
+    # radius search against brute force, ragged rows
+    radius = 0.2
+    neighbours = tree.queryRadius(queries, radius)
+    for i in range(len(queries)):
+        expected = set(j for j in range(len(points)) if (points[j] - queries[i]).norm() <= radius)
+        assert set(neighbours[i]) == expected
+        assert set(tree.queryRadius(queries[i], radius)) == expected
+
+    # k larger than the sample
+    assert len(tree.queryNearest(queries[0], 1000)) == len(points)
+
+    # persistence, the index is rebuilt on load
+    study = ot.Study()
+    fileName = "kdtree2.xml"
+    study.setStorageManager(ot.XMLStorageManager(fileName))
+    study.add("tree", tree)
+    study.save()
+    study = ot.Study()
+    study.setStorageManager(ot.XMLStorageManager(fileName))
+    study.load()
+    tree2 = otmeshing.KDTree2()
+    study.fillObject("tree", tree2)
+    assert [list(row) for row in tree2.queryNearest(queries, k)] == [list(row) for row in nearest]
+    ott.assert_almost_equal(tree2.getPoints(), points)
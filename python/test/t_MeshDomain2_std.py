@@ -36,3 +36,88 @@ for dim in [2, 3]:
     distance = domain.computeDistance(p)
     print(f"b2 {distance=:.6g}")
     ott.assert_almost_equal(distance, 0.1 * dim**0.5)
+
+# general dimension, distance to the unit hypercube
+for dim in [1, 4]:
+    interval = ot.Interval([0.0] * dim, [1.0] * dim)
+    if dim == 1:
+        mesh = ot.IntervalMesher([2]).build(interval)
+    else:
+        # triangulation of a regular grid of the hypercube
+        mesh = otm.CloudMesher(otm.CloudMesher.DELAUNAY).build(ot.Box([1] * dim, interval).generate())
+    domain = otm.MeshDomain2(mesh)
+    points = ot.JointDistribution([ot.Uniform(-0.5, 1.5)] * dim).getSample(200)
+    distances = domain.computeDistance(points)
+    for i in range(len(points)):
+        x = points[i]
+        if min(x) >= 0.0 and max(x) <= 1.0:
+            expected = -min(min(x), 1.0 - max(x))
+        else:
+            expected = sum(max(0.0, -xk, xk - 1.0) ** 2 for xk in x) ** 0.5
+        ott.assert_almost_equal(distances[i, 0], expected, 1e-10, 1e-10)
+    print(f"{dim=} {distances[0, 0]=:.6g}")
+
+# closest points, facets and normals
+for dim in [2, 3, 4]:
+    interval = ot.Interval([0.0] * dim, [1.0] * dim)
+    if dim == 4:
+        mesh = otm.CloudMesher(otm.CloudMesher.DELAUNAY).build(ot.Box([1] * dim, interval).generate())
+    else:
+        mesh = ot.IntervalMesher([2] * dim).build(interval)
+    domain = otm.MeshDomain2(mesh)
+    boundary = domain.getBoundary()
+    assert boundary.getVerticesNumber() == mesh.getVerticesNumber()
+    assert boundary.getSimplices().getSize() > 0
+    points = ot.JointDistribution([ot.Uniform(-0.5, 1.5)] * dim).getSample(100)
+    distances, closestPoints, facetIndices, normals = domain.computeProjection(points)
+    ott.assert_almost_equal(distances, domain.computeDistance(points), 1e-12, 1e-12)
+    boundaryVertices = boundary.getVertices()
+    for i in range(len(points)):
+        x = points[i]
+        y = closestPoints[i]
+        # the closest point is on the boundary of the hypercube, at the distance
+        ott.assert_almost_equal((x - y).norm(), abs(distances[i, 0]), 1e-10, 1e-10)
+        assert min(min(y), 1.0 - max(y)) < 1e-10
+        # its facet lies on a face of the hypercube, with the outward normal
+        facetVertices = boundaryVertices.select(boundary.getSimplex(facetIndices[i]))
+        n = normals[i]
+        ott.assert_almost_equal(n.norm(), 1.0)
+        k = max(range(dim), key=lambda j: abs(n[j]))
+        ott.assert_almost_equal(abs(n[k]), 1.0)
+        side = 1.0 if n[k] > 0.0 else 0.0
+        for j in range(dim):
+            ott.assert_almost_equal(facetVertices[j, k], side, 1e-12, 1e-12)
+        ott.assert_almost_equal(y[k], side, 1e-10, 1e-10)
+
+# the structures are built once with the domain: the point queries, the batch
+# queries and the copies of the domain agree, including inside a non-convex polygon
+lshape = otm.PolygonMesher().build(ot.Sample([[0.0, 0.0], [2.0, 0.0], [2.0, 1.0], [1.0, 1.0], [1.0, 2.0], [0.0, 2.0]]))
+for mesh in [lshape, ot.IntervalMesher([2] * 3).build(ot.Interval(3))]:
+    dim = mesh.getDimension()
+    domain = otm.MeshDomain2(mesh)
+    copy = otm.MeshDomain2(domain)
+    points = ot.JointDistribution([ot.Uniform(-0.5, 2.5)] * dim).getSample(50)
+    distances = domain.computeDistance(points)
+    ott.assert_almost_equal(copy.computeDistance(points), distances, 0.0, 0.0)
+    for i in range(len(points)):
+        ott.assert_almost_equal(domain.computeDistance(points[i]), distances[i, 0], 0.0, 0.0)
+    if dim == 2:
+        # the notch of the L is outside
+        assert domain.computeDistance([1.5, 1.5]) > 0.0
+        ott.assert_almost_equal(domain.computeDistance([0.5, 1.5]), -0.5)
+
+# the point queries reuse the trees built with the domain, in every dimension
+ot.ResourceMap.AddAsBool("MeshingStatistics-Enabled", True)
+for dim in [2, 3, 4]:
+    interval = ot.Interval([0.0] * dim, [1.0] * dim)
+    domain = otm.MeshDomain2(otm.CloudMesher(otm.CloudMesher.DELAUNAY).build(ot.Box([1] * dim, interval).generate()))
+    domain.computeDistance([0.5] * dim)
+    first = domain.getStatistics()
+    domain.computeDistance([2.0] * dim)
+    second = domain.getStatistics()
+    names = list(second.getDescription())
+    assert second[names.index("queriesNumber")] == 1
+    assert second[names.index("treeBuildTime")] == first[names.index("treeBuildTime")]
+    grid = otm.SignedDistanceGrid(domain, [4] * dim)
+    ott.assert_almost_equal(grid.computeDistance([0.5] * dim), -0.5, 1e-12, 1e-12)
+ot.ResourceMap.AddAsBool("MeshingStatistics-Enabled", False)
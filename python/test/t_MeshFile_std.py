@@ -0,0 +1,104 @@
+#! /usr/bin/env python
+
+import os
+import struct
+import tempfile
+import openturns as ot
+import openturns.testing as ott
+import otmeshing as otm
+
+ot.TESTPREAMBLE()
+
+work_dir = tempfile.mkdtemp()
+for dim in [2, 3]:
+    points = ot.JointDistribution([ot.Uniform(-1.0, 1.0)] * dim).getSample(500)
+    mesh = otm.CloudMesher(otm.CloudMesher.DELAUNAY).build(points)
+    for compact in [True, False]:
+        fileName = os.path.join(work_dir, f"mesh{dim}_{compact}.otm")
+        otm.MeshFile.Write(mesh, fileName, compact)
+        meshFile = otm.MeshFile(fileName)
+        print(meshFile)
+        assert meshFile.getDimension() == dim
+        assert meshFile.getVerticesNumber() == mesh.getVerticesNumber()
+        assert meshFile.getSimplicesNumber() == mesh.getSimplicesNumber()
+        assert meshFile.getIndexSize() == (4 if compact else 8)
+
+        # random access
+        ott.assert_almost_equal(meshFile.getVertex(7), mesh.getVertex(7), 0.0, 0.0)
+        assert meshFile.getSimplex(5) == mesh.getSimplex(5)
+
+        # round trip
+        mesh2 = meshFile.getMesh()
+        ott.assert_almost_equal(mesh2.getVertices(), mesh.getVertices(), 0.0, 0.0)
+        assert [list(s) for s in mesh2.getSimplices()] == [list(s) for s in mesh.getSimplices()]
+
+        # queries over the stored mesh
+        domain = otm.MeshDomain2(mesh2)
+        query = ot.JointDistribution([ot.Uniform(-1.5, 1.5)] * dim).getSample(100)
+        ott.assert_almost_equal(domain.computeDistance(query), otm.MeshDomain2(mesh).computeDistance(query))
+
+        # views over the mapping
+        try:
+            import numpy as np
+
+            vertices, simplices = meshFile.getArrays()
+            np.testing.assert_array_equal(vertices, np.array(mesh.getVertices()))
+            np.testing.assert_array_equal(simplices, np.array(mesh.getSimplices()))
+            assert simplices.dtype == (np.uint32 if compact else np.uint64)
+            del meshFile
+            assert vertices.sum() == np.array(mesh.getVertices()).sum()
+        except ImportError:
+            pass
+
+# invalid files
+fileName = os.path.join(work_dir, "invalid.otm")
+with open(fileName, "wb") as f:
+    f.write(b"not a mesh file" * 10)
+for name in [fileName, os.path.join(work_dir, "missing.otm")]:
+    try:
+        otm.MeshFile(name)
+        raise AssertionError("expected a failure")
+    except (TypeError, RuntimeError, OSError):
+        pass
+
+# truncated file
+fileName = os.path.join(work_dir, "mesh2_True.otm")
+with open(fileName, "rb") as f:
+    data = f.read()
+with open(fileName, "wb") as f:
+    f.write(data[: len(data) // 2])
+try:
+    otm.MeshFile(fileName)
+    raise AssertionError("expected a failure")
+except TypeError:
+    pass
+
+# corrupted header fields, the overflowing counts are rejected too
+fileName = os.path.join(work_dir, "mesh2_False.otm")
+with open(fileName, "rb") as f:
+    data = f.read()
+for offset, value in [(24, 2**62), (32, 2**61), (16, 0), (56, 0), (64, 2**63)]:
+    corrupted = os.path.join(work_dir, "corrupted.otm")
+    with open(corrupted, "wb") as f:
+        f.write(data[:offset] + struct.pack("=Q", value) + data[offset + 8:])
+    try:
+        otm.MeshFile(corrupted)
+        raise AssertionError(f"expected a failure {offset=}")
+    except TypeError:
+        pass
+
+# corrupted simplex index
+fileName = os.path.join(work_dir, "mesh3_True.otm")
+verticesNumber = otm.MeshFile(fileName).getVerticesNumber()
+with open(fileName, "rb") as f:
+    data = f.read()
+simplicesOffset = struct.unpack("=Q", data[64:72])[0]
+offset = simplicesOffset + 4 * 5
+corrupted = os.path.join(work_dir, "corrupted_index.otm")
+with open(corrupted, "wb") as f:
+    f.write(data[:offset] + struct.pack("=I", verticesNumber) + data[offset + 4:])
+try:
+    otm.MeshFile(corrupted)
+    raise AssertionError("expected a failure")
+except TypeError:
+    pass
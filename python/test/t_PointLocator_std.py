@@ -0,0 +1,70 @@
+#! /usr/bin/env python
+
+import openturns as ot
+import openturns.testing as ott
+import otmeshing
+
+ot.TESTPREAMBLE()
+
+for dim in [2, 3, 4]:
+    # Delaunay triangulation of a cloud, as used for interpolation
+    points = ot.JointDistribution([ot.Uniform(0.0, 1.0)] * dim).getSample(200 * dim)
+    mesh = otmeshing.CloudMesher(otmeshing.CloudMesher.DELAUNAY).build(points)
+    locator = otmeshing.PointLocator(mesh)
+    print(locator)
+    simplicesNumber = mesh.getSimplicesNumber()
+    vertices = mesh.getVertices()
+    simplices = mesh.getSimplices()
+    queries = ot.JointDistribution([ot.Uniform(-0.1, 1.1)] * dim).getSample(500)
+    simplexIndices, coordinates = locator.queryWithCoordinates(queries)
+    assert simplexIndices == locator.query(queries)
+    domain = ot.MeshDomain(mesh)
+    for i in range(len(queries)):
+        s = simplexIndices[i]
+        inside = domain.contains(queries[i])
+        assert (s < simplicesNumber) == inside, f"{dim=} {i=}"
+        if s == simplicesNumber:
+            assert coordinates[i].norm() == 0.0
+            continue
+        assert locator.query(queries[i]) < simplicesNumber
+        # the coordinates reproduce the point
+        assert min(coordinates[i]) >= -1e-10
+        ott.assert_almost_equal(sum(coordinates[i]), 1.0)
+        simplexVertices = vertices.select(simplices[s])
+        reconstructed = ot.Point(dim)
+        for j in range(dim + 1):
+            reconstructed += coordinates[i, j] * simplexVertices[j]
+        ott.assert_almost_equal(reconstructed, queries[i], 1e-10, 1e-10)
+
+    # linear functions are interpolated exactly
+    f = ot.SymbolicFunction(["x" + str(k) for k in range(dim)], ["1 + " + " + ".join(f"{k + 1} * x{k}" for k in range(dim))])
+    values = locator.interpolate(f(vertices), queries)
+    exact = f(queries)
+    for i in range(len(queries)):
+        if simplexIndices[i] < simplicesNumber:
+            ott.assert_almost_equal(values[i], exact[i], 1e-10, 1e-10)
+
+# non-convex mesh: the walks leave the mesh at the notch
+mesh1 = ot.IntervalMesher([3] * 3).build(ot.Interval([0.0] * 3, [2.0] * 3))
+mesh2 = ot.IntervalMesher([3, 3, 1]).build(ot.Interval([2.0, 0.0, 0.0], [4.0, 2.0, 2.0 / 3.0]))
+mesh = otmeshing.UnionMesher.CompressMesh(otmeshing.UnionMesher().build([mesh1, mesh2]))
+locator = otmeshing.PointLocator(mesh)
+queries = ot.JointDistribution([ot.Uniform(-0.5, 4.5), ot.Uniform(-0.5, 2.5), ot.Uniform(-0.5, 2.5)]).getSample(2000)
+simplexIndices = locator.query(queries)
+domain = ot.MeshDomain(mesh)
+for i in range(len(queries)):
+    assert (simplexIndices[i] < mesh.getSimplicesNumber()) == domain.contains(queries[i]), f"{i=}"
+
+# save / load
+study = ot.Study()
+study.setStorageManager(ot.XMLStorageManager("locator.xml"))
+locator.setBarycentricCoordinatesEpsilon(1e-10)
+study.add("locator", locator)
+study.save()
+study = ot.Study()
+study.setStorageManager(ot.XMLStorageManager("locator.xml"))
+study.load()
+loaded = otmeshing.PointLocator()
+study.fillObject("locator", loaded)
+assert loaded.getBarycentricCoordinatesEpsilon() == 1e-10
+assert loaded.query(queries) == simplexIndices
@@ -1,6 +1,7 @@
 #! /usr/bin/env python
 
 import openturns as ot
+import openturns.testing as ott
 import otmeshing
 import math
 
@@ -33,3 +34,42 @@ assert triangulation.getDimension() == 2
 assert triangulation.getVertices() == polyline
 assert len(triangulation.getSimplices()) == 12
 assert triangulation.isValid()
+
+# square with two square holes
+outer = [[0, 0], [5, 0], [5, 3], [0, 3]]
+holes = [[[1, 1], [1, 2], [2, 2], [2, 1]], [[3, 1], [4, 1], [4, 2], [3, 2]]]
+triangulation = mesher.build(outer, holes)
+print("triangulation=", repr(triangulation))
+assert triangulation.getVerticesNumber() == 12
+assert triangulation.isValid()
+ott.assert_almost_equal(triangulation.getVolume(), 13.0)
+
+# invalid holes: outside of the outer ring, nested in another hole, off the plane
+for badHoles in [[[[6, 1], [7, 1], [7, 2], [6, 2]]],
+                 [[[1, 0.5], [2.5, 0.5], [2.5, 2.5], [1, 2.5]], [[1.5, 1], [2, 1], [2, 2], [1.5, 2]]]]:
+    try:
+        mesher.build(outer, badHoles)
+        raise AssertionError("expected a failure")
+    except TypeError:
+        pass
+try:
+    mesher.build([[0, 0, 0], [5, 0, 0], [5, 3, 0], [0, 3, 0]], [[[1, 1, 1], [1, 2, 1], [2, 2, 1], [2, 1, 1]]])
+    raise AssertionError("expected a failure")
+except TypeError:
+    pass
+
+# polygons with holes meshed by batch
+triangulations = mesher.buildBatch([outer, outer], holes, [1, 1])
+ott.assert_almost_equal(triangulations[0].getVolume(), 15.0)
+ott.assert_almost_equal(triangulations[1].getVolume(), 13.0)
+
+# grid-aligned polygons meshed by batch
+polylines = []
+for i in range(50):
+    polylines.append([[i, 0], [i + 1, 0], [i + 1, 1], [i + 0.5, 0.5], [i, 1]])
+triangulations = mesher.buildBatch(polylines)
+assert len(triangulations) == len(polylines)
+for i, triangulation in enumerate(triangulations):
+    assert triangulation.getVertices() == polylines[i]
+    assert len(triangulation.getSimplices()) == 3
+    ott.assert_almost_equal(triangulation.getVolume(), 0.75)
@@ -0,0 +1,50 @@
+#! /usr/bin/env python
+
+import openturns as ot
+import openturns.testing as ott
+import otmeshing
+
+ot.TESTPREAMBLE()
+
+for dim in [2, 3]:
+    mesh = ot.IntervalMesher([3] * dim).build(ot.Interval([0.0] * dim, [1.0] * dim))
+    domain = otmeshing.MeshDomain2(mesh)
+
+    # default bounds: the bounding box of the vertices
+    grid = otmeshing.SignedDistanceGrid(domain, [8] * dim)
+    print(grid)
+    assert grid.getBounds() == ot.Interval([0.0] * dim, [1.0] * dim)
+    assert grid.getValues().getSize() == 9**dim
+
+    bounds = ot.Interval([-0.5] * dim, [1.5] * dim)
+    grid = otmeshing.SignedDistanceGrid(domain, bounds, [40] * dim)
+    errorBound = grid.getErrorBound()
+    ott.assert_almost_equal(errorBound, 0.5 * (dim * 0.05**2) ** 0.5)
+
+    # the nodes are exact
+    nodes = ot.Box([39] * dim, bounds).generate()
+    ott.assert_almost_equal(grid.computeDistance(nodes), domain.computeDistance(nodes), 1e-12, 1e-12)
+
+    # interpolated inside the grid within the bound, exact outside
+    queries = ot.JointDistribution([ot.Uniform(-1.0, 2.0)] * dim).getSample(1000)
+    approximate = grid.computeDistance(queries)
+    exact = domain.computeDistance(queries)
+    for i in range(len(queries)):
+        if bounds.contains(queries[i]):
+            assert abs(approximate[i, 0] - exact[i, 0]) <= errorBound, f"{dim=} {i=}"
+        else:
+            ott.assert_almost_equal(approximate[i], exact[i], 1e-12, 1e-12)
+    ott.assert_almost_equal(grid.computeDistance(queries[0]), approximate[0, 0])
+
+# save / load, the node values are not recomputed
+study = ot.Study()
+study.setStorageManager(ot.XMLStorageManager("grid.xml"))
+study.add("grid", grid)
+study.save()
+study = ot.Study()
+study.setStorageManager(ot.XMLStorageManager("grid.xml"))
+study.load()
+grid2 = otmeshing.SignedDistanceGrid()
+study.fillObject("grid", grid2)
+assert grid2.getValues() == grid.getValues()
+ott.assert_almost_equal(grid2.computeDistance(queries), approximate)
@@ -0,0 +1,42 @@
+#! /usr/bin/env python
+
+import openturns as ot
+import openturns.testing as ott
+import otmeshing
+
+ot.TESTPREAMBLE()
+
+mesher = otmeshing.UnionMesher()
+mesher.setResolveOverlaps(True)
+assert mesher.getResolveOverlaps()
+
+# two overlapping cubes: the common part must be counted once
+for dim in range(2, 4):
+    mesh1 = ot.IntervalMesher([1] * dim).build(ot.Interval([0.0] * dim, [2.0] * dim))
+    mesh2 = ot.IntervalMesher([1] * dim).build(ot.Interval([1.0] * dim, [3.0] * dim))
+    union = mesher.build([mesh1, mesh2])
+    volume = union.getVolume()
+    print(f"{dim=} {volume=}")
+    ott.assert_almost_equal(volume, 2.0 * 2.0**dim - 1.0)
+
+    # the result is invariant by containment
+    union = mesher.build([mesh1, mesh1])
+    ott.assert_almost_equal(union.getVolume(), 2.0**dim)
+
+    # disjoint meshes are unchanged
+    mesh3 = ot.IntervalMesher([1] * dim).build(ot.Interval([4.0] * dim, [5.0] * dim))
+    union = mesher.build([mesh1, mesh3])
+    assert union.getSimplicesNumber() == mesh1.getSimplicesNumber() + mesh3.getSimplicesNumber()
+    ott.assert_almost_equal(union.getVolume(), 2.0**dim + 1.0)
+
+# the broad phase only tests the pairs of simplices whose boxes overlap
+ot.ResourceMap.AddAsBool("MeshingStatistics-Enabled", True)
+mesh1 = ot.IntervalMesher([8, 8]).build(ot.Interval([0.0] * 2, [2.0] * 2))
+mesh2 = ot.IntervalMesher([2, 2]).build(ot.Interval([1.5] * 2, [3.0] * 2))
+mesh3 = ot.IntervalMesher([2, 2]).build(ot.Interval([2.5, -1.0], [4.0, 0.5]))
+union = mesher.build([mesh1, mesh2, mesh3])
+ott.assert_almost_equal(union.getVolume(), 4.0 + 2.25 - 0.25 + 2.25)
+statistics = mesher.getStatistics()
+tested = statistics[list(statistics.getDescription()).index("pairsTested")]
+assert tested < mesh2.getSimplicesNumber() * mesh1.getSimplicesNumber(), f"{tested=}"
+ot.ResourceMap.AddAsBool("MeshingStatistics-Enabled", False)
@@ -18,3 +18,23 @@ for dim in range(2, 6):
     volume = union.getVolume()
     print(f"{dim=} {volume=}")
     ott.assert_almost_equal(union.getVolume(), 2.0)
+
+# vertex deduplication of two adjacent cubes, with a duplicated simplex
+for dim in range(2, 5):
+    mesh1 = ot.IntervalMesher([1] * dim).build(ot.Interval([0.0] * dim, [1.0] * dim))
+    mesh2 = ot.IntervalMesher([1] * dim).build(ot.Interval([1.0] + [0.0] * (dim - 1), [2.0] + [1.0] * (dim - 1)))
+    union = mesher.build([mesh1, mesh1, mesh2])
+    compressed = otmeshing.UnionMesher.CompressMesh(union)
+    print(f"{dim=} compressed={compressed}")
+    assert compressed.isValid()
+    assert compressed.getVerticesNumber() == 3 * 2 ** (dim - 1)
+    assert compressed.getSimplicesNumber() == mesh1.getSimplicesNumber() + mesh2.getSimplicesNumber()
+    ott.assert_almost_equal(compressed.getVolume(), 2.0)
+
+# adjacent along the last axis, the components beyond the third are also snapped
+for dim in range(4, 6):
+    mesh1 = ot.IntervalMesher([1] * dim).build(ot.Interval([0.0] * dim, [1.0] * dim))
+    mesh2 = ot.IntervalMesher([1] * dim).build(ot.Interval([0.0] * (dim - 1) + [1.0], [1.0] * (dim - 1) + [2.0]))
+    compressed = otmeshing.UnionMesher.CompressMesh(mesher.build([mesh1, mesh2]))
+    assert compressed.getVerticesNumber() == 3 * 2 ** (dim - 1)
+    ott.assert_almost_equal(compressed.getVolume(), 2.0)
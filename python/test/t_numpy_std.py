@@ -0,0 +1,62 @@
+#! /usr/bin/env python
+
+import numpy as np
+import openturns as ot
+import openturns.testing as ott
+import otmeshing as otm
+
+ot.TESTPREAMBLE()
+
+rng = np.random.default_rng(0)
+for method in [otm.CloudMesher.BASIC, otm.CloudMesher.DELAUNAY]:
+    for dim in [1, 2, 3]:
+        points = rng.random((200, dim))
+        mesher = otm.CloudMesher(method)
+        vertices, simplices = mesher.buildFromArray(points)
+        print(f"{dim=} {vertices.shape=} {simplices.shape=}")
+
+        # same mesh as the Sample entry point
+        mesh = mesher.build(ot.Sample(points))
+        ott.assert_almost_equal(ot.Sample(vertices), mesh.getVertices())
+        assert simplices.tolist() == [list(s) for s in mesh.getSimplices()]
+
+        # read-only views
+        assert not vertices.flags.writeable and not simplices.flags.writeable
+        assert vertices.dtype == np.float64
+
+        # views of any mesh
+        vertices2, simplices2 = otm.MeshArrays(mesh)
+        np.testing.assert_array_equal(vertices2, vertices)
+        np.testing.assert_array_equal(simplices2, simplices)
+
+# the views outlive the mesh
+mesh = ot.IntervalMesher([3, 4]).build(ot.Interval([0.0] * 2, [1.0] * 2))
+vertices, simplices = otm.MeshArrays(mesh)
+expected = np.array(mesh.getVertices())
+del mesh
+np.testing.assert_array_equal(vertices, expected)
+assert simplices.shape == (24, 3)
+
+# convex hull
+points = rng.random((500, 3))
+vertices, simplices = otm.ConvexHullMesher().buildFromArray(points)
+mesh = otm.ConvexHullMesher().build(points)
+ott.assert_almost_equal(ot.Sample(vertices), mesh.getVertices())
+assert simplices.shape == (mesh.getSimplicesNumber(), 4)
+
+# distances
+for dim in [2, 3]:
+    mesh = ot.IntervalMesher([2] * dim).build(ot.Interval([0.0] * dim, [1.0] * dim))
+    domain = otm.MeshDomain2(mesh)
+    points = 2.0 * rng.random((1000, dim)) - 0.5
+    distances = domain.computeDistanceFromArray(points)
+    assert distances.shape == (1000,)
+    ott.assert_almost_equal(ot.Sample(distances[:, None]), domain.computeDistance(points))
+
+# invalid inputs
+for bad in [np.ones((10, 2), dtype=np.float32), np.ones(10), np.ones((10, 4))[:, ::2], [[0.0, 1.0]]]:
+    try:
+        otm.CloudMesher().buildFromArray(bad)
+        raise AssertionError("expected a failure")
+    except TypeError:
+        pass
@@ -0,0 +1,58 @@
+#! /usr/bin/env python
+
+import os
+import time
+from concurrent.futures import ThreadPoolExecutor
+import openturns as ot
+import otmeshing
+
+ot.TESTPREAMBLE()
+
+# independent Delaunay triangulations, sequential on the C++ side
+dim = 3
+workers = 4
+tasks = 8
+samples = []
+for i in range(tasks):
+    ot.RandomGenerator.SetSeed(i)
+    samples.append(ot.Normal(dim).getSample(20000))
+mesher = otmeshing.CloudMesher(otmeshing.CloudMesher.DELAUNAY)
+
+t0 = time.perf_counter()
+reference = [mesher.build(sample) for sample in samples]
+sequential = time.perf_counter() - t0
+
+# the same mesher instance is shared by the threads
+t0 = time.perf_counter()
+with ThreadPoolExecutor(max_workers=workers) as executor:
+    meshes = list(executor.map(mesher.build, samples))
+concurrent = time.perf_counter() - t0
+# the speedup depends on the machine load, the threads only have to overlap
+speedup = sequential / concurrent
+print(f"{sequential=:.3f}s {concurrent=:.3f}s {speedup=:.2f}")
+if (os.cpu_count() or 1) > 1:
+    assert speedup > 1.0, f"{speedup=:.2f}"
+for mesh, ref in zip(meshes, reference):
+    assert mesh.getSimplicesNumber() == ref.getSimplicesNumber()
+    assert mesh.getVertices() == ref.getVertices()
+
+# concurrent distance queries and hulls
+domain = otmeshing.MeshDomain2(ot.IntervalMesher([20] * 2).build(ot.Interval(2)))
+queries = [ot.JointDistribution([ot.Uniform(-0.5, 1.5)] * 2).getSample(2000) for i in range(tasks)]
+hullMesher = otmeshing.ConvexHullMesher()
+with ThreadPoolExecutor(max_workers=workers) as executor:
+    distances = list(executor.map(domain.computeDistance, queries))
+    hulls = list(executor.map(hullMesher.build, samples))
+for q, d in zip(queries, distances):
+    assert d == domain.computeDistance(q)
+for sample, hull in zip(samples, hulls):
+    assert hull.getVerticesNumber() == otmeshing.ConvexHullMesher().build(sample).getVerticesNumber()
+
+# concurrent cddlib conversions are serialized, the results do not depend on the threads
+dim = 2
+cubes = [ot.IntervalMesher([3] * dim).build(ot.Interval([0.1 * i] * dim, [1.0 + 0.1 * i] * dim)) for i in range(tasks)]
+pairs = [[cubes[i], cubes[(i + 1) % tasks]] for i in range(tasks)]
+reference = [otmeshing.IntersectionMesher().build(pair).getVolume() for pair in pairs]
+with ThreadPoolExecutor(max_workers=workers) as executor:
+    volumes = list(executor.map(lambda pair: otmeshing.IntersectionMesher().build(pair).getVolume(), pairs))
+assert volumes == reference